@@ -0,0 +1,728 @@
+/* 
+Copyright (c) 2015 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+#include "OpenCV_VX_Functions.h"
+#include <chrono>
+#include <vector>
+
+// number of keypoints reserved for the detector outputs
+#define MAX_KEYPOINTS 100000
+
+// tile size of the batched kernels, and tile grid of the tile benchmark (64 tiles of 256x256)
+#define TILE_SIZE 256
+#define TILE_GRID 8
+
+/************************************************************************************************************
+A benchmark entry: the node under test and the equivalent OpenCV call on the same data.
+Entries without an output image (keypoints, pyramids, reductions) use VX_DF_IMAGE_VIRT as output format.
+*************************************************************************************************************/
+struct BenchKernel
+{
+	const char * name;
+	vx_df_image input_format;
+	int num_inputs;
+	vx_df_image output_format;
+	Size (*output_size)(Size);
+	std::function<vx_node(vx_graph, vx_image *, vx_image, Size)> create;
+	std::function<void(const vector<Mat>&, Mat&, Size)> opencv;
+};
+
+static Size SameSize(Size s) { return s; }
+static Size HalfSize(Size s) { return Size((s.width + 1) / 2, (s.height + 1) / 2); }
+static Size DoubleSize(Size s) { return Size(s.width * 2, s.height * 2); }
+static Size TransposedSize(Size s) { return Size(s.height, s.width); }
+
+static double ClockMsec()
+{
+	return chrono::duration<double, milli>(chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+static vx_context GraphContext(vx_graph graph)
+{
+	return vxGetContext((vx_reference)graph);
+}
+
+static vx_matrix CreateMatrix(vx_graph graph, const Mat& m)
+{
+	vx_matrix matrix = vxCreateMatrix(GraphContext(graph), VX_TYPE_FLOAT32, m.cols, m.rows);
+	Mat f; m.convertTo(f, CV_32F);
+	vxWriteMatrix(matrix, f.ptr());
+	return matrix;
+}
+
+static vx_array CreateKeypoints(vx_graph graph)
+{
+	return vxCreateArray(GraphContext(graph), VX_TYPE_KEYPOINT, MAX_KEYPOINTS);
+}
+
+static vx_image CreateMask(vx_graph graph, Size s)
+{
+	vx_image mask = vxCreateImage(GraphContext(graph), s.width, s.height, VX_DF_IMAGE_U8);
+	vx_rectangle_t rect = { 0, 0, (vx_uint32)s.width, (vx_uint32)s.height };
+	vx_imagepatch_addressing_t addr; void * ptr = NULL;
+	if (vxAccessImagePatch(mask, &rect, 0, &addr, &ptr, VX_WRITE_ONLY) == VX_SUCCESS) {
+		for (int y = 0; y < s.height; y++)
+			memset((vx_uint8 *)ptr + y * addr.stride_y, 255, s.width * addr.stride_x);
+		vxCommitImagePatch(mask, &rect, 0, &addr, ptr);
+	}
+	return mask;
+}
+
+// the image covered by TILE_SIZE x TILE_SIZE tiles, clipped at the right and bottom edges
+static vector<Rect> GetTiles(Size s)
+{
+	vector<Rect> tiles;
+	for (int y = 0; y < s.height; y += TILE_SIZE)
+		for (int x = 0; x < s.width; x += TILE_SIZE)
+			tiles.push_back(Rect(x, y, min(TILE_SIZE, s.width - x), min(TILE_SIZE, s.height - y)));
+	return tiles;
+}
+
+static vx_array CreateTiles(vx_graph graph, Size s)
+{
+	vector<vx_rectangle_t> rects;
+	for (auto& r : GetTiles(s))
+		rects.push_back({ (vx_uint32)r.x, (vx_uint32)r.y, (vx_uint32)(r.x + r.width), (vx_uint32)(r.y + r.height) });
+	vx_array array = vxCreateArray(GraphContext(graph), VX_TYPE_RECTANGLE, rects.size());
+	vxAddArrayItems(array, rects.size(), rects.data(), sizeof(vx_rectangle_t));
+	return array;
+}
+
+// runs an OpenCV call on every tile the way the batched kernels do (stand-alone tiles on the OpenCV thread pool)
+static void ForEachTile(const vector<Mat>& in, Mat& out, Size s, std::function<void(const vector<Mat>&, Mat&)> op)
+{
+	vector<Rect> tiles = GetTiles(s);
+	out.create(s, in[0].type());
+	cv::parallel_for_(Range(0, (int)tiles.size()), CV_Batch_Invoker(tiles, [&](const Rect& r) {
+		vector<Mat> tile_in;
+		for (auto& m : in)
+			tile_in.push_back(CV_Tile(m, r));
+		Mat tile_out = CV_Tile(out, r);
+		op(tile_in, tile_out);
+	}));
+}
+
+// release the helper objects once the node holds its own references
+static vx_node Keep(vx_node node, vx_image obj) { vxReleaseImage(&obj); return node; }
+static vx_node Keep(vx_node node, vx_array obj) { vxReleaseArray(&obj); return node; }
+static vx_node Keep(vx_node node, vx_matrix obj) { vxReleaseMatrix(&obj); return node; }
+static vx_node Keep(vx_node node, vx_pyramid obj) { vxReleasePyramid(&obj); return node; }
+
+/************************************************************************************************************
+The kernels under test, one entry per kernel registered in publishkernels.cpp (contrib kernels excluded)
+*************************************************************************************************************/
+static vector<BenchKernel> GetBenchKernels()
+{
+	Mat K3 = getStructuringElement(MORPH_RECT, Size(3, 3));
+	Mat F3 = (Mat_<float>(3, 3) << 0, -1, 0, -1, 5, -1, 0, -1, 0);
+	Mat KX = getGaussianKernel(5, 1.0, CV_32F), KY = KX.clone();
+	Mat AFF = (Mat_<float>(2, 3) << 0.9f, 0.1f, 4, -0.1f, 0.9f, 8);
+	Mat PER = (Mat_<float>(3, 3) << 0.9f, 0.1f, 4, -0.1f, 0.9f, 8, 0.0001f, 0.0001f, 1);
+	vector<BenchKernel> list = {
+		{ "absdiff", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_absdiff(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::absdiff(in[0], in[1], out); } },
+		{ "absdiff_batch", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_absdiff_batch(g, in[0], in[1], out, rois), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::absdiff(t[0], t[1], o); }); } },
+		{ "adaptivethreshold", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_adaptiveThreshold(g, in[0], out, 255.0f, ADAPTIVE_THRESH_MEAN_C, THRESH_BINARY, 11, 2.0f); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::adaptiveThreshold(in[0], out, 255.0, ADAPTIVE_THRESH_MEAN_C, THRESH_BINARY, 11, 2.0); } },
+		{ "add", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_add(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::add(in[0], in[1], out); } },
+		{ "add_batch", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_add_batch(g, in[0], in[1], out, rois), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::add(t[0], t[1], o); }); } },
+		{ "addweighted", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_addWeighted(g, in[0], 0.5f, in[1], 0.5f, 0.0f, out, CV_8U); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::addWeighted(in[0], 0.5, in[1], 0.5, 0.0, out, CV_8U); } },
+		{ "bilateralfilter", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_bilateralFilter(g, in[0], out, 5, 5, 50.0f, 50.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::bilateralFilter(in[0], out, 5, 50.0, 50.0, BORDER_DEFAULT); } },
+		{ "bitwise_and", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_bitwise_and(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::bitwise_and(in[0], in[1], out); } },
+		{ "bitwise_not", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_bitwise_not(g, in[0], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::bitwise_not(in[0], out); } },
+		{ "bitwise_or", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_bitwise_or(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::bitwise_or(in[0], in[1], out); } },
+		{ "bitwise_xor", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_bitwise_xor(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::bitwise_xor(in[0], in[1], out); } },
+		{ "blur", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_blur(g, in[0], out, 5, 5, -1, -1, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::blur(in[0], out, Size(5, 5), Point(-1, -1), BORDER_DEFAULT); } },
+		{ "blur_batch", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_blur_batch(g, in[0], out, rois, 5, 5, BORDER_DEFAULT), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::blur(t[0], o, Size(5, 5), Point(-1, -1), BORDER_DEFAULT); }); } },
+		{ "boxfilter", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_boxFilter(g, in[0], out, -1, 5, 5, -1, -1, vx_true_e, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::boxFilter(in[0], out, -1, Size(5, 5), Point(-1, -1), true, BORDER_DEFAULT); } },
+		{ "brisk_detect", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_image mask = CreateMask(g, s); vx_array kp = CreateKeypoints(g); return Keep(Keep(vxExtCvNode_BRISKdetect(g, in[0], mask, kp, 30, 3, 1.0f), kp), mask); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<KeyPoint> kp; BRISK::create(30, 3, 1.0f)->detect(in[0], kp); } },
+		{ "buildopticalflowpyramid", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_pyramid pyr = vxCreatePyramid(GraphContext(g), 4, VX_SCALE_PYRAMID_HALF, s.width, s.height, VX_DF_IMAGE_U8); return Keep(vxExtCvNode_buildOpticalFlowPyramid(g, in[0], pyr, 21, 21, 3, vx_false_e, BORDER_REFLECT_101, BORDER_CONSTANT, vx_true_e), pyr); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<Mat> pyr; cv::buildOpticalFlowPyramid(in[0], pyr, Size(21, 21), 3, false, BORDER_REFLECT_101, BORDER_CONSTANT, true); } },
+		{ "buildpyramid", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_pyramid pyr = vxCreatePyramid(GraphContext(g), 4, VX_SCALE_PYRAMID_HALF, s.width, s.height, VX_DF_IMAGE_U8); return Keep(vxExtCvNode_buildPyramid(g, in[0], pyr, 3, BORDER_DEFAULT), pyr); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<Mat> pyr; cv::buildPyramid(in[0], pyr, 3, BORDER_DEFAULT); } },
+		{ "canny", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_Canny(g, in[0], out, 50.0f, 150.0f, 3, vx_false_e); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::Canny(in[0], out, 50.0, 150.0, 3, false); } },
+		{ "compare", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_compare(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::compare(in[0], in[1], out, CMP_EQ); } },
+		{ "convertscaleabs", VX_DF_IMAGE_S16, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_convertScaleAbs(g, in[0], out, 1.0f, 0.0f); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::convertScaleAbs(in[0], out, 1.0, 0.0); } },
+		{ "cornerharris", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_F32_AMD, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_cornerHarris(g, in[0], out, 2, 3, 0.04f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::cornerHarris(in[0], out, 2, 3, 0.04, BORDER_DEFAULT); } },
+		{ "cornermineigenval", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_F32_AMD, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_cornerMinEigenVal(g, in[0], out, 3, 3, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::cornerMinEigenVal(in[0], out, 3, 3, BORDER_DEFAULT); } },
+		{ "countnonzero", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size) { return vxExtCvNode_countNonZero(g, in[0], 0); },
+			[](const vector<Mat>& in, Mat&, Size) { volatile int n = cv::countNonZero(in[0]); (void)n; } },
+		{ "cvtcolor", VX_DF_IMAGE_RGB, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_cvtColor(g, in[0], out, COLOR_RGB2GRAY); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::cvtColor(in[0], out, COLOR_RGB2GRAY); } },
+		{ "dilate", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[K3](vx_graph g, vx_image * in, vx_image out, Size) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_Dilate(g, in[0], out, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out, Size) { cv::dilate(in[0], out, K3, Point(-1, -1), 1, BORDER_CONSTANT); } },
+		{ "distancetransform", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_distanceTransform(g, in[0], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::distanceTransform(in[0], out, CV_DIST_L1, 3, CV_8U); } },
+		{ "divide", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_divide(g, in[0], in[1], out, 1.0f, CV_8U); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::divide(in[0], in[1], out, 1.0, CV_8U); } },
+		{ "erode", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[K3](vx_graph g, vx_image * in, vx_image out, Size) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_Erode(g, in[0], out, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out, Size) { cv::erode(in[0], out, K3, Point(-1, -1), 1, BORDER_CONSTANT); } },
+		{ "fast", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size) { vx_array kp = CreateKeypoints(g); return Keep(vxExtCvNode_FAST(g, in[0], kp, 20, vx_true_e), kp); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<KeyPoint> kp; cv::FAST(in[0], kp, 20, true); } },
+		{ "fastnlmeansdenoising", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_fastNlMeansDenoising(g, in[0], out, 3.0f, 7, 21); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::fastNlMeansDenoising(in[0], out, 3.0f, 7, 21); } },
+		{ "fastnlmeansdenoisingcolored", VX_DF_IMAGE_RGB, 1, VX_DF_IMAGE_RGB, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_fastNlMeansDenoisingColored(g, in[0], out, 3.0f, 3.0f, 7, 21); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::fastNlMeansDenoisingColored(in[0], out, 3.0f, 3.0f, 7, 21); } },
+		{ "filter2d", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[F3](vx_graph g, vx_image * in, vx_image out, Size) { vx_matrix m = CreateMatrix(g, F3); return Keep(vxExtCvNode_filter2D(g, in[0], out, -1, m, -1, -1, 0.0f, BORDER_DEFAULT), m); },
+			[F3](const vector<Mat>& in, Mat& out, Size) { cv::filter2D(in[0], out, -1, F3, Point(-1, -1), 0.0, BORDER_DEFAULT); } },
+		{ "flip", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_flip(g, in[0], out, 1); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::flip(in[0], out, 1); } },
+		{ "gaussianblur", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_GaussianBlur(g, in[0], out, 5, 5, 1.0f, 1.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::GaussianBlur(in[0], out, Size(5, 5), 1.0, 1.0, BORDER_DEFAULT); } },
+		{ "gaussianblur_batch", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_GaussianBlur_batch(g, in[0], out, rois, 5, 5, 1.0f, 1.0f, BORDER_DEFAULT), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::GaussianBlur(t[0], o, Size(5, 5), 1.0, 1.0, BORDER_DEFAULT); }); } },
+		{ "good_features_to_track", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_image mask = CreateMask(g, s); vx_array kp = CreateKeypoints(g); return Keep(Keep(vxExtCvNode_goodFeaturesToTrack(g, in[0], kp, 1000, 0.01f, 10.0f, mask, 3, vx_false_e, 0.04f), kp), mask); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<Point2f> pt; cv::goodFeaturesToTrack(in[0], pt, 1000, 0.01, 10.0, noArray(), 3, false, 0.04); } },
+		{ "integral", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_S32, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_integral(g, in[0], out, CV_32S); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::integral(in[0], out, CV_32S); } },
+		{ "laplacian", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_Laplacian(g, in[0], out, (vx_uint32)-1, 3, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::Laplacian(in[0], out, -1, 3, 1.0, 0.0, BORDER_DEFAULT); } },
+		{ "medianblur", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_medianBlur(g, in[0], out, 5); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::medianBlur(in[0], out, 5); } },
+		{ "medianblur_batch", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_medianBlur_batch(g, in[0], out, rois, 5), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::medianBlur(t[0], o, 5); }); } },
+		{ "morphologyex", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[K3](vx_graph g, vx_image * in, vx_image out, Size) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_morphologyEX(g, in[0], out, MORPH_OPEN, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out, Size) { cv::morphologyEx(in[0], out, MORPH_OPEN, K3, Point(-1, -1), 1, BORDER_CONSTANT); } },
+		{ "mser_detect", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_image mask = CreateMask(g, s); vx_array kp = CreateKeypoints(g); return Keep(Keep(vxExtCvNode_MSERdetect(g, in[0], kp, mask, 5, 60, 14400, 0.25f, 0.2f, 200, 1.01f, 0.003f, 5), kp), mask); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<KeyPoint> kp; MSER::create(5, 60, 14400, 0.25, 0.2, 200, 1.01, 0.003, 5)->detect(in[0], kp); } },
+		{ "multiply", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_multiply(g, in[0], in[1], out, 1.0f, CV_8U); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::multiply(in[0], in[1], out, 1.0, CV_8U); } },
+		{ "norm", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size) { return vxExtCvNode_norm(g, in[0], 0.0f, NORM_L2); },
+			[](const vector<Mat>& in, Mat&, Size) { volatile double n = cv::norm(in[0], NORM_L2); (void)n; } },
+		{ "orb_detect", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_image mask = CreateMask(g, s); vx_array kp = CreateKeypoints(g); return Keep(Keep(vxExtCvNode_ORBdetect(g, in[0], mask, kp, 500, 1.2f, 8, 31, 0, 2, 0, 31), kp), mask); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<KeyPoint> kp; ORB::create(500, 1.2f, 8, 31, 0, 2, ORB::HARRIS_SCORE, 31)->detect(in[0], kp); } },
+		{ "pyrdown", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, HalfSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { return vxExtCvNode_pyrdown(g, in[0], out, (s.width + 1) / 2, (s.height + 1) / 2, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size s) { cv::pyrDown(in[0], out, HalfSize(s), BORDER_DEFAULT); } },
+		{ "pyrup", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, DoubleSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { return vxExtCvNode_pyrup(g, in[0], out, s.width * 2, s.height * 2, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size s) { cv::pyrUp(in[0], out, DoubleSize(s), BORDER_DEFAULT); } },
+		{ "resize", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, HalfSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { return vxExtCvNode_Resize(g, in[0], out, (s.width + 1) / 2, (s.height + 1) / 2, 0.0f, 0.0f, INTER_LINEAR); },
+			[](const vector<Mat>& in, Mat& out, Size s) { cv::resize(in[0], out, HalfSize(s), 0.0, 0.0, INTER_LINEAR); } },
+		{ "scharr", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_S16, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_Scharr(g, in[0], out, CV_16S, 1, 0, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::Scharr(in[0], out, CV_16S, 1, 0, 1.0, 0.0, BORDER_DEFAULT); } },
+		{ "sepfilter2d", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[KX, KY](vx_graph g, vx_image * in, vx_image out, Size) { vx_matrix mx = CreateMatrix(g, KX), my = CreateMatrix(g, KY); return Keep(Keep(vxExtCvNode_sepFilter2D(g, in[0], out, -1, mx, my, -1, -1, 0.0f, BORDER_DEFAULT), mx), my); },
+			[KX, KY](const vector<Mat>& in, Mat& out, Size) { cv::sepFilter2D(in[0], out, -1, KX, KY, Point(-1, -1), 0.0, BORDER_DEFAULT); } },
+		{ "simple_blob_detect", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_VIRT, SameSize,
+			[](vx_graph g, vx_image * in, vx_image, Size s) { vx_image mask = CreateMask(g, s); vx_array kp = CreateKeypoints(g); return Keep(Keep(vxExtCvNode_SimpleBlobDetector(g, in[0], kp, mask), kp), mask); },
+			[](const vector<Mat>& in, Mat&, Size) { vector<KeyPoint> kp; SimpleBlobDetector::create()->detect(in[0], kp); } },
+		{ "sobel", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_S16, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_Sobel(g, in[0], out, CV_16S, 1, 0, 3, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::Sobel(in[0], out, CV_16S, 1, 0, 3, 1.0, 0.0, BORDER_DEFAULT); } },
+		{ "subtract", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_subtract(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::subtract(in[0], in[1], out); } },
+		{ "subtract_batch", VX_DF_IMAGE_U8, 2, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size s) { vx_array rois = CreateTiles(g, s); return Keep(vxExtCvNode_subtract_batch(g, in[0], in[1], out, rois), rois); },
+			[](const vector<Mat>& in, Mat& out, Size s) { ForEachTile(in, out, s, [](const vector<Mat>& t, Mat& o) { cv::subtract(t[0], t[1], o); }); } },
+		{ "threshold", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_threshold(g, in[0], out, 128.0f, 255.0f, THRESH_BINARY); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::threshold(in[0], out, 128.0, 255.0, THRESH_BINARY); } },
+		{ "transpose", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, TransposedSize,
+			[](vx_graph g, vx_image * in, vx_image out, Size) { return vxExtCvNode_transpose(g, in[0], out); },
+			[](const vector<Mat>& in, Mat& out, Size) { cv::transpose(in[0], out); } },
+		{ "warpaffine", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[AFF](vx_graph g, vx_image * in, vx_image out, Size s) { vx_matrix m = CreateMatrix(g, AFF); return Keep(vxExtCvNode_warpAffine(g, in[0], out, m, s.width, s.height, INTER_LINEAR, BORDER_CONSTANT), m); },
+			[AFF](const vector<Mat>& in, Mat& out, Size s) { cv::warpAffine(in[0], out, AFF, s, INTER_LINEAR, BORDER_CONSTANT); } },
+		{ "warpperspective", VX_DF_IMAGE_U8, 1, VX_DF_IMAGE_U8, SameSize,
+			[PER](vx_graph g, vx_image * in, vx_image out, Size s) { vx_matrix m = CreateMatrix(g, PER); return Keep(vxExtCvNode_warpPerspective(g, in[0], out, m, s.width, s.height, INTER_LINEAR, BORDER_CONSTANT), m); },
+			[PER](const vector<Mat>& in, Mat& out, Size s) { cv::warpPerspective(in[0], out, PER, s, INTER_LINEAR, BORDER_CONSTANT); } },
+	};
+	return list;
+}
+
+/************************************************************************************************************
+A tile benchmark entry: the batched node over every tile and the plain node on one tile (an ROI image)
+*************************************************************************************************************/
+struct TileBenchKernel
+{
+	const char * name;
+	int num_inputs;
+	std::function<vx_node(vx_graph, vx_image *, vx_image, vx_array)> batch;
+	std::function<vx_node(vx_graph, vx_image *, vx_image)> single;
+};
+
+/************************************************************************************************************
+The batched kernels registered in publishkernels.cpp, with the same parameters as their plain entries above
+*************************************************************************************************************/
+static vector<TileBenchKernel> GetTileBenchKernels()
+{
+	vector<TileBenchKernel> list = {
+		{ "absdiff_batch", 2,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_absdiff_batch(g, in[0], in[1], out, rois); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_absdiff(g, in[0], in[1], out); } },
+		{ "add_batch", 2,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_add_batch(g, in[0], in[1], out, rois); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_add(g, in[0], in[1], out); } },
+		{ "blur_batch", 1,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_blur_batch(g, in[0], out, rois, 5, 5, BORDER_DEFAULT); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_blur(g, in[0], out, 5, 5, -1, -1, BORDER_DEFAULT); } },
+		{ "gaussianblur_batch", 1,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_GaussianBlur_batch(g, in[0], out, rois, 5, 5, 1.0f, 1.0f, BORDER_DEFAULT); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_GaussianBlur(g, in[0], out, 5, 5, 1.0f, 1.0f, BORDER_DEFAULT); } },
+		{ "medianblur_batch", 1,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_medianBlur_batch(g, in[0], out, rois, 5); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_medianBlur(g, in[0], out, 5); } },
+		{ "subtract_batch", 2,
+			[](vx_graph g, vx_image * in, vx_image out, vx_array rois) { return vxExtCvNode_subtract_batch(g, in[0], in[1], out, rois); },
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_subtract(g, in[0], in[1], out); } },
+	};
+	return list;
+}
+
+/************************************************************************************************************
+Copies between an OpenVX image and a Mat the way the vx_ext_cv bridge does (patch access plus row copies)
+*************************************************************************************************************/
+static vx_status CopyImage(vx_image image, Mat& mat, vx_enum usage)
+{
+	vx_rectangle_t rect = { 0, 0, (vx_uint32)mat.cols, (vx_uint32)mat.rows };
+	vx_imagepatch_addressing_t addr; void * ptr = NULL;
+	vx_status status = vxAccessImagePatch(image, &rect, 0, &addr, &ptr, usage);
+	if (status != VX_SUCCESS)
+		return status;
+	size_t len = mat.cols * mat.elemSize();
+	for (int y = 0; y < mat.rows; y++) {
+		vx_uint8 * row = (vx_uint8 *)ptr + y * addr.stride_y;
+		if (usage == VX_READ_ONLY) memcpy(mat.ptr(y), row, len);
+		else memcpy(row, mat.ptr(y), len);
+	}
+	return vxCommitImagePatch(image, &rect, 0, &addr, ptr);
+}
+
+static const char * FormatName(vx_df_image format)
+{
+	switch (format) {
+	case VX_DF_IMAGE_U8: return "U8";
+	case VX_DF_IMAGE_S16: return "S16";
+	case VX_DF_IMAGE_S32: return "S32";
+	case VX_DF_IMAGE_RGB: return "RGB";
+	case VX_DF_IMAGE_F32_AMD: return "F32";
+	}
+	return "-";
+}
+
+/************************************************************************************************************
+Synthetic random inputs of a kernel, as Mats and as OpenVX images holding the same data
+*************************************************************************************************************/
+static vx_status CreateInputs(vx_context context, const BenchKernel& k, Size size, vector<Mat>& mat_in, vector<vx_image>& img_in)
+{
+	vx_status status = VX_SUCCESS;
+	mat_in.resize(k.num_inputs);
+	img_in.assign(k.num_inputs, nullptr);
+	for (int i = 0; i < k.num_inputs && status == VX_SUCCESS; i++) {
+		mat_in[i].create(size, VX_to_CV_Format(k.input_format));
+		cv::randu(mat_in[i], Scalar::all(1), Scalar::all(255));
+		img_in[i] = vxCreateImage(context, size.width, size.height, k.input_format);
+		status = CopyImage(img_in[i], mat_in[i], VX_WRITE_ONLY);
+	}
+	return status;
+}
+
+/************************************************************************************************************
+Benchmarks one kernel at one resolution and prints one CSV row
+*************************************************************************************************************/
+static vx_status RunBench(vx_context context, const BenchKernel& k, Size size, int iterations, FILE * fp)
+{
+	// synthetic inputs
+	vector<Mat> mat_in;
+	vector<vx_image> img_in;
+	vx_status status = CreateInputs(context, k, size, mat_in, img_in);
+	Size out_size = k.output_size(size);
+	vx_image img_out = nullptr;
+	Mat mat_out;
+	if (k.output_format != VX_DF_IMAGE_VIRT) {
+		img_out = vxCreateImage(context, out_size.width, out_size.height, k.output_format);
+		mat_out.create(out_size, VX_to_CV_Format(k.output_format));
+	}
+
+	// one-node graph
+	vx_graph graph = vxCreateGraph(context);
+	vx_node node = nullptr;
+	if (status == VX_SUCCESS) {
+		node = k.create(graph, img_in.data(), img_out, size);
+		status = vxGetStatus((vx_reference)node);
+	}
+	if (status == VX_SUCCESS)
+		status = vxVerifyGraph(graph);
+	if (status == VX_SUCCESS)
+		status = vxProcessGraph(graph);
+
+	double graph_ms = 0, node_ms = 0, bridge_ms = 0, opencv_ms = 0;
+	if (status == VX_SUCCESS) {
+		// kernel time: wall clock of vxProcessGraph and the node performance counter
+		double t0 = ClockMsec();
+		for (int i = 0; i < iterations && status == VX_SUCCESS; i++)
+			status = vxProcessGraph(graph);
+		graph_ms = (ClockMsec() - t0) / iterations;
+		vx_perf_t perf = { 0 };
+		if (vxQueryNode(node, VX_NODE_ATTRIBUTE_PERFORMANCE, &perf, sizeof(perf)) == VX_SUCCESS)
+			node_ms = perf.avg * 1e-6;
+
+		// bridge copy time: inputs into Mats and the output Mat back into the image
+		vector<Mat> copy_in(k.num_inputs);
+		for (int i = 0; i < k.num_inputs; i++)
+			copy_in[i].create(size, mat_in[i].type());
+		t0 = ClockMsec();
+		for (int i = 0; i < iterations; i++) {
+			for (int j = 0; j < k.num_inputs; j++)
+				CopyImage(img_in[j], copy_in[j], VX_READ_ONLY);
+			if (img_out)
+				CopyImage(img_out, mat_out, VX_WRITE_ONLY);
+		}
+		bridge_ms = (ClockMsec() - t0) / iterations;
+
+		// OpenCV-only time on the same data
+		Mat out;
+		k.opencv(mat_in, out, size);
+		t0 = ClockMsec();
+		for (int i = 0; i < iterations; i++)
+			k.opencv(mat_in, out, size);
+		opencv_ms = (ClockMsec() - t0) / iterations;
+	}
+
+	if (status == VX_SUCCESS) {
+		fprintf(fp, "%s,%d,%d,%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n", k.name, size.width, size.height, FormatName(k.input_format), iterations,
+			graph_ms, node_ms, bridge_ms, opencv_ms, node_ms - opencv_ms);
+	}
+	else {
+		printf("WARNING: %s %dx%d skipped (status = %d)\n", k.name, size.width, size.height, status);
+	}
+	fflush(fp);
+
+	if (node) vxReleaseNode(&node);
+	vxReleaseGraph(&graph);
+	if (img_out) vxReleaseImage(&img_out);
+	for (auto& img : img_in)
+		if (img) vxReleaseImage(&img);
+	return status;
+}
+
+/************************************************************************************************************
+Measures the per-call cost of vxReadScalarValue on the input scalars of one node, which the kernel function
+pays on every execution, and prints it next to the node execution time as one CSV row
+*************************************************************************************************************/
+static vx_status RunScalarBench(vx_context context, const BenchKernel& k, Size size, int iterations, FILE * fp)
+{
+	vector<Mat> mat_in;
+	vector<vx_image> img_in;
+	vx_status status = CreateInputs(context, k, size, mat_in, img_in);
+	Size out_size = k.output_size(size);
+	vx_image img_out = nullptr;
+	if (k.output_format != VX_DF_IMAGE_VIRT)
+		img_out = vxCreateImage(context, out_size.width, out_size.height, k.output_format);
+
+	vx_graph graph = vxCreateGraph(context);
+	vx_node node = nullptr;
+	if (status == VX_SUCCESS) {
+		node = k.create(graph, img_in.data(), img_out, size);
+		status = vxGetStatus((vx_reference)node);
+	}
+	if (status == VX_SUCCESS)
+		status = vxVerifyGraph(graph);
+
+	// input scalars of the node
+	vector<vx_scalar> scalars;
+	vx_uint32 num_params = 0;
+	if (status == VX_SUCCESS)
+		status = vxQueryNode(node, VX_NODE_ATTRIBUTE_PARAMETERS, &num_params, sizeof(num_params));
+	for (vx_uint32 i = 0; i < num_params && status == VX_SUCCESS; i++) {
+		vx_parameter param = vxGetParameterByIndex(node, i);
+		vx_enum type = VX_TYPE_INVALID, direction = VX_OUTPUT;
+		vx_scalar scalar = nullptr;
+		vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_TYPE, &type, sizeof(type));
+		vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_DIRECTION, &direction, sizeof(direction));
+		if (type == VX_TYPE_SCALAR && direction == VX_INPUT)
+			vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &scalar, sizeof(scalar));
+		if (scalar)
+			scalars.push_back(scalar);
+		vxReleaseParameter(&param);
+	}
+
+	double node_ms = 0, read_us = 0;
+	if (status == VX_SUCCESS) {
+		for (int i = 0; i < iterations && status == VX_SUCCESS; i++)
+			status = vxProcessGraph(graph);
+		vx_perf_t perf = { 0 };
+		if (vxQueryNode(node, VX_NODE_ATTRIBUTE_PERFORMANCE, &perf, sizeof(perf)) == VX_SUCCESS)
+			node_ms = perf.avg * 1e-6;
+
+		// enough calls for a stable per-call figure even on nodes with one scalar
+		int reads = max(iterations, 1000);
+		vx_uint64 value = 0;
+		double t0 = ClockMsec();
+		for (int i = 0; i < reads; i++)
+			for (auto& scalar : scalars)
+				vxReadScalarValue(scalar, &value);
+		if (!scalars.empty())
+			read_us = (ClockMsec() - t0) * 1000.0 / ((double)reads * scalars.size());
+	}
+
+	if (status == VX_SUCCESS) {
+		double frame_ms = read_us * scalars.size() / 1000.0;
+		fprintf(fp, "%s,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.2f\n", k.name, size.width, size.height, (int)scalars.size(), iterations,
+			node_ms, read_us, frame_ms, node_ms > 0 ? 100.0 * frame_ms / node_ms : 0.0);
+	}
+	else {
+		printf("WARNING: %s %dx%d skipped (status = %d)\n", k.name, size.width, size.height, status);
+	}
+	fflush(fp);
+
+	for (auto& scalar : scalars)
+		vxReleaseScalar(&scalar);
+	if (node) vxReleaseNode(&node);
+	vxReleaseGraph(&graph);
+	if (img_out) vxReleaseImage(&img_out);
+	for (auto& img : img_in)
+		if (img) vxReleaseImage(&img);
+	return status;
+}
+
+/************************************************************************************************************
+Processes a grid of TILE_GRID x TILE_GRID tiles of TILE_SIZE x TILE_SIZE with one batched node, then with one
+plain node per tile, and prints both graph times as one CSV row
+*************************************************************************************************************/
+static vx_status RunTileBench(vx_context context, const TileBenchKernel& k, int iterations, FILE * fp)
+{
+	vx_status status = VX_SUCCESS;
+	const int tiles = TILE_GRID * TILE_GRID;
+	Size size(TILE_SIZE * TILE_GRID, TILE_SIZE * TILE_GRID);
+
+	// synthetic U8 inputs and the tile rectangles
+	vector<vx_image> img_in(k.num_inputs, nullptr);
+	for (int i = 0; i < k.num_inputs && status == VX_SUCCESS; i++) {
+		Mat mat(size, CV_8UC1);
+		cv::randu(mat, Scalar::all(1), Scalar::all(255));
+		img_in[i] = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+		status = CopyImage(img_in[i], mat, VX_WRITE_ONLY);
+	}
+	vx_image img_out = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+	vector<vx_rectangle_t> rects;
+	for (int y = 0; y < TILE_GRID; y++)
+		for (int x = 0; x < TILE_GRID; x++)
+			rects.push_back({ (vx_uint32)(x * TILE_SIZE), (vx_uint32)(y * TILE_SIZE), (vx_uint32)((x + 1) * TILE_SIZE), (vx_uint32)((y + 1) * TILE_SIZE) });
+	vx_array rois = vxCreateArray(context, VX_TYPE_RECTANGLE, tiles);
+	if (status == VX_SUCCESS)
+		status = vxAddArrayItems(rois, tiles, rects.data(), sizeof(vx_rectangle_t));
+
+	// one batched node over every tile
+	vx_graph batch_graph = vxCreateGraph(context);
+	if (status == VX_SUCCESS) {
+		vx_node node = k.batch(batch_graph, img_in.data(), img_out, rois);
+		status = vxGetStatus((vx_reference)node);
+		if (status == VX_SUCCESS) vxReleaseNode(&node);
+	}
+
+	// one plain node per tile, reading ROI images of the same data; each node writes its own tile image
+	// since several nodes writing into one image would not pass graph verification
+	vx_graph single_graph = vxCreateGraph(context);
+	vector<vx_image> tile_img;
+	for (int t = 0; t < tiles && status == VX_SUCCESS; t++) {
+		vector<vx_image> tile_in(k.num_inputs);
+		for (int i = 0; i < k.num_inputs; i++)
+			tile_img.push_back(tile_in[i] = vxCreateImageFromROI(img_in[i], &rects[t]));
+		vx_image tile_out = vxCreateImage(context, TILE_SIZE, TILE_SIZE, VX_DF_IMAGE_U8);
+		tile_img.push_back(tile_out);
+		vx_node node = k.single(single_graph, tile_in.data(), tile_out);
+		status = vxGetStatus((vx_reference)node);
+		if (status == VX_SUCCESS) vxReleaseNode(&node);
+	}
+
+	double batch_ms = 0, single_ms = 0;
+	vx_graph graphs[2] = { batch_graph, single_graph };
+	double * times[2] = { &batch_ms, &single_ms };
+	for (int g = 0; g < 2 && status == VX_SUCCESS; g++) {
+		status = vxVerifyGraph(graphs[g]);
+		if (status == VX_SUCCESS)
+			status = vxProcessGraph(graphs[g]);
+		double t0 = ClockMsec();
+		for (int i = 0; i < iterations && status == VX_SUCCESS; i++)
+			status = vxProcessGraph(graphs[g]);
+		*times[g] = (ClockMsec() - t0) / iterations;
+	}
+
+	if (status == VX_SUCCESS) {
+		fprintf(fp, "%s,%d,%d,%d,%d,%.4f,%.4f,%.2f\n", k.name, tiles, TILE_SIZE, TILE_SIZE, iterations,
+			batch_ms, single_ms, batch_ms > 0 ? single_ms / batch_ms : 0.0);
+	}
+	else {
+		printf("WARNING: %s %dx%dx%d skipped (status = %d)\n", k.name, tiles, TILE_SIZE, TILE_SIZE, status);
+	}
+	fflush(fp);
+
+	vxReleaseGraph(&single_graph);
+	vxReleaseGraph(&batch_graph);
+	for (auto& img : tile_img)
+		if (img) vxReleaseImage(&img);
+	vxReleaseArray(&rois);
+	vxReleaseImage(&img_out);
+	for (auto& img : img_in)
+		if (img) vxReleaseImage(&img);
+	return status;
+}
+
+int main(int argc, char * argv[])
+{
+	vector<Size> sizes = { Size(320, 240), Size(1280, 720), Size(1920, 1080), Size(3840, 2160) };
+	int iterations = 20;
+	const char * filter = nullptr;
+	const char * fileName = nullptr;
+	bool scalar_read = false, tile_bench = false;
+
+	for (int arg = 1; arg < argc; arg++) {
+		if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+			sizes.clear();
+			for (char * s = strtok(argv[++arg], ","); s; s = strtok(nullptr, ",")) {
+				int w = 0, h = 0;
+				if (sscanf(s, "%dx%d", &w, &h) == 2 && w > 0 && h > 0)
+					sizes.push_back(Size(w, h));
+			}
+		}
+		else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+			iterations = max(1, atoi(argv[++arg]));
+		}
+		else if (!strcmp(argv[arg], "-k") && arg + 1 < argc) {
+			filter = argv[++arg];
+		}
+		else if (!strcmp(argv[arg], "-o") && arg + 1 < argc) {
+			fileName = argv[++arg];
+		}
+		else if (!strcmp(argv[arg], "-s")) {
+			scalar_read = true;
+		}
+		else if (!strcmp(argv[arg], "-t")) {
+			tile_bench = true;
+		}
+		else {
+			printf("Usage: cv_bench [-r WxH[,WxH...]] [-i iterations] [-k kernel] [-o output.csv] [-s] [-t]\n");
+			return -1;
+		}
+	}
+
+	FILE * fp = fileName ? fopen(fileName, "w") : stdout;
+	if (!fp) {
+		printf("ERROR: unable to create: %s\n", fileName);
+		return -1;
+	}
+
+	vx_context context = vxCreateContext();
+	if (vxGetStatus((vx_reference)context) != VX_SUCCESS || vxLoadKernels(context, "vx_ext_cv") != VX_SUCCESS) {
+		printf("ERROR: unable to create OpenVX context with vx_ext_cv kernels\n");
+		return -1;
+	}
+
+	int failures = 0;
+	if (tile_bench) {
+		fprintf(fp, "kernel,tiles,tile_width,tile_height,iterations,batch_ms,single_ms,speedup\n");
+		for (auto& k : GetTileBenchKernels()) {
+			if (filter && strcmp(filter, k.name))
+				continue;
+			if (RunTileBench(context, k, iterations, fp) != VX_SUCCESS)
+				failures++;
+		}
+	}
+	else {
+		if (scalar_read)
+			fprintf(fp, "kernel,width,height,scalars,iterations,node_ms,read_us,read_ms,read_pct\n");
+		else
+			fprintf(fp, "kernel,width,height,format,iterations,graph_ms,node_ms,bridge_ms,opencv_ms,overhead_ms\n");
+		for (auto& k : GetBenchKernels()) {
+			if (filter && strcmp(filter, k.name))
+				continue;
+			for (auto& size : sizes)
+				if ((scalar_read ? RunScalarBench(context, k, size, iterations, fp) : RunBench(context, k, size, iterations, fp)) != VX_SUCCESS)
+					failures++;
+		}
+	}
+
+	vxReleaseContext(&context);
+	if (fp != stdout) fclose(fp);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,493 @@
+/*
+Copyright (c) 2015 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+#include "OpenCV_VX_Functions.h"
+#include <chrono>
+#include <vector>
+#include <string>
+
+/************************************************************************************************************
+A test case: a one-node graph with the given input and output formats, and the equivalent OpenCV call.
+Cases without an OpenCV reference must be rejected by vxVerifyGraph.
+*************************************************************************************************************/
+struct TestCase
+{
+	string name;
+	vector<vx_df_image> input_formats;
+	vx_df_image output_format;
+	std::function<vx_node(vx_graph, vx_image *, vx_image)> create;
+	std::function<void(const vector<Mat>&, Mat&)> opencv;
+};
+
+static double ClockMsec()
+{
+	return chrono::duration<double, milli>(chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+static vx_matrix CreateMatrix(vx_graph graph, const Mat& m)
+{
+	vx_matrix matrix = vxCreateMatrix(vxGetContext((vx_reference)graph), VX_TYPE_FLOAT32, m.cols, m.rows);
+	Mat f; m.convertTo(f, CV_32F);
+	vxWriteMatrix(matrix, f.ptr());
+	return matrix;
+}
+
+// release the helper objects once the node holds its own references
+static vx_node Keep(vx_node node, vx_matrix obj) { vxReleaseMatrix(&obj); return node; }
+
+static const char * FormatName(vx_df_image format)
+{
+	switch (format) {
+	case VX_DF_IMAGE_U8: return "U8";
+	case VX_DF_IMAGE_U16: return "U16";
+	case VX_DF_IMAGE_S16: return "S16";
+	case VX_DF_IMAGE_S32: return "S32";
+	case VX_DF_IMAGE_F32_AMD: return "F32";
+	case VX_DF_IMAGE_RGB: return "RGB";
+	case VX_DF_IMAGE_RGBX: return "RGBX";
+	}
+	return "-";
+}
+
+static int Depth(vx_df_image format)
+{
+	return CV_MAT_DEPTH(VX_to_CV_Format(format));
+}
+
+/************************************************************************************************************
+The test cases: every kernel with widened validators in each format it accepts, plus the combinations
+that the validators must reject because OpenCV would throw or the result would not fit the output image
+*************************************************************************************************************/
+static vector<TestCase> GetTestCases()
+{
+	Mat K3 = getStructuringElement(MORPH_RECT, Size(3, 3));
+	Mat F3 = (Mat_<float>(3, 3) << 0, -1, 0, -1, 5, -1, 0, -1, 0);
+	Mat KX = getGaussianKernel(5, 1.0, CV_32F), KY = KX.clone();
+	vector<vx_df_image> filter_formats = { VX_DF_IMAGE_U8, VX_DF_IMAGE_U16, VX_DF_IMAGE_S16, VX_DF_IMAGE_F32_AMD, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX };
+	vector<vx_df_image> arithm_formats = { VX_DF_IMAGE_U8, VX_DF_IMAGE_U16, VX_DF_IMAGE_S16, VX_DF_IMAGE_S32, VX_DF_IMAGE_F32_AMD, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX };
+	vector<TestCase> list;
+
+	// filters: output format is the input format
+	for (auto f : filter_formats) {
+		list.push_back({ "blur", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_blur(g, in[0], out, 5, 5, -1, -1, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::blur(in[0], out, Size(5, 5), Point(-1, -1), BORDER_DEFAULT); } });
+		list.push_back({ "boxfilter", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_boxFilter(g, in[0], out, -1, 5, 5, -1, -1, vx_true_e, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::boxFilter(in[0], out, -1, Size(5, 5), Point(-1, -1), true, BORDER_DEFAULT); } });
+		list.push_back({ "gaussianblur", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_GaussianBlur(g, in[0], out, 5, 5, 1.0f, 1.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::GaussianBlur(in[0], out, Size(5, 5), 1.0, 1.0, BORDER_DEFAULT); } });
+		list.push_back({ "filter2d", { f }, f,
+			[F3](vx_graph g, vx_image * in, vx_image out) { vx_matrix m = CreateMatrix(g, F3); return Keep(vxExtCvNode_filter2D(g, in[0], out, -1, m, -1, -1, 0.0f, BORDER_DEFAULT), m); },
+			[F3](const vector<Mat>& in, Mat& out) { cv::filter2D(in[0], out, -1, F3, Point(-1, -1), 0.0, BORDER_DEFAULT); } });
+		list.push_back({ "sepfilter2d", { f }, f,
+			[KX, KY](vx_graph g, vx_image * in, vx_image out) { vx_matrix mx = CreateMatrix(g, KX), my = CreateMatrix(g, KY); return Keep(Keep(vxExtCvNode_sepFilter2D(g, in[0], out, -1, mx, my, -1, -1, 0.0f, BORDER_DEFAULT), mx), my); },
+			[KX, KY](const vector<Mat>& in, Mat& out) { cv::sepFilter2D(in[0], out, -1, KX, KY, Point(-1, -1), 0.0, BORDER_DEFAULT); } });
+		list.push_back({ "sobel", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_Sobel(g, in[0], out, -1, 1, 0, 3, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::Sobel(in[0], out, -1, 1, 0, 3, 1.0, 0.0, BORDER_DEFAULT); } });
+		list.push_back({ "scharr", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_Scharr(g, in[0], out, -1, 1, 0, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::Scharr(in[0], out, -1, 1, 0, 1.0, 0.0, BORDER_DEFAULT); } });
+		list.push_back({ "laplacian", { f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_Laplacian(g, in[0], out, (vx_uint32)-1, 3, 1.0f, 0.0f, BORDER_DEFAULT); },
+			[](const vector<Mat>& in, Mat& out) { cv::Laplacian(in[0], out, -1, 3, 1.0, 0.0, BORDER_DEFAULT); } });
+		list.push_back({ "dilate", { f }, f,
+			[K3](vx_graph g, vx_image * in, vx_image out) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_Dilate(g, in[0], out, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out) { cv::dilate(in[0], out, K3, Point(-1, -1), 1, BORDER_CONSTANT); } });
+		list.push_back({ "erode", { f }, f,
+			[K3](vx_graph g, vx_image * in, vx_image out) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_Erode(g, in[0], out, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out) { cv::erode(in[0], out, K3, Point(-1, -1), 1, BORDER_CONSTANT); } });
+		list.push_back({ "morphologyex", { f }, f,
+			[K3](vx_graph g, vx_image * in, vx_image out) { vx_matrix m = CreateMatrix(g, K3); return Keep(vxExtCvNode_morphologyEX(g, in[0], out, MORPH_OPEN, m, -1, -1, 1, BORDER_CONSTANT), m); },
+			[K3](const vector<Mat>& in, Mat& out) { cv::morphologyEx(in[0], out, MORPH_OPEN, K3, Point(-1, -1), 1, BORDER_CONSTANT); } });
+	}
+
+	// arithmetic: both inputs and the output in the same format
+	for (auto f : arithm_formats) {
+		int d = Depth(f);
+		list.push_back({ "add", { f, f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_add(g, in[0], in[1], out); },
+			[d](const vector<Mat>& in, Mat& out) { cv::add(in[0], in[1], out, noArray(), d); } });
+		list.push_back({ "subtract", { f, f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_subtract(g, in[0], in[1], out); },
+			[d](const vector<Mat>& in, Mat& out) { cv::subtract(in[0], in[1], out, noArray(), d); } });
+		list.push_back({ "absdiff", { f, f }, f,
+			[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_absdiff(g, in[0], in[1], out); },
+			[](const vector<Mat>& in, Mat& out) { cv::absdiff(in[0], in[1], out); } });
+		list.push_back({ "multiply", { f, f }, f,
+			[d](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_multiply(g, in[0], in[1], out, 1.0f, d); },
+			[d](const vector<Mat>& in, Mat& out) { cv::multiply(in[0], in[1], out, 1.0, d); } });
+		list.push_back({ "divide", { f, f }, f,
+			[d](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_divide(g, in[0], in[1], out, 1.0f, d); },
+			[d](const vector<Mat>& in, Mat& out) { cv::divide(in[0], in[1], out, 1.0, d); } });
+		list.push_back({ "addweighted", { f, f }, f,
+			[d](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_addWeighted(g, in[0], 0.5f, in[1], 0.5f, 0.0f, out, d); },
+			[d](const vector<Mat>& in, Mat& out) { cv::addWeighted(in[0], 0.5, in[1], 0.5, 0.0, out, d); } });
+	}
+
+	// arithmetic with a wider output depth
+	list.push_back({ "add", { VX_DF_IMAGE_U8, VX_DF_IMAGE_U8 }, VX_DF_IMAGE_S16,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_add(g, in[0], in[1], out); },
+		[](const vector<Mat>& in, Mat& out) { cv::add(in[0], in[1], out, noArray(), CV_16S); } });
+	list.push_back({ "addweighted", { VX_DF_IMAGE_U8, VX_DF_IMAGE_U8 }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_addWeighted(g, in[0], 0.5f, in[1], 0.5f, 0.0f, out, CV_32F); },
+		[](const vector<Mat>& in, Mat& out) { cv::addWeighted(in[0], 0.5, in[1], 0.5, 0.0, out, CV_32F); } });
+
+	// integral: the output format follows sdepth; the kernel writes the top-left part of the (W+1)x(H+1) sums
+	list.push_back({ "integral", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_S32,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_integral(g, in[0], out, CV_32S); },
+		[](const vector<Mat>& in, Mat& out) { Mat sum; cv::integral(in[0], sum, CV_32S); out = sum(Rect(0, 0, in[0].cols, in[0].rows)).clone(); } });
+	list.push_back({ "integral", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_integral(g, in[0], out, CV_32F); },
+		[](const vector<Mat>& in, Mat& out) { Mat sum; cv::integral(in[0], sum, CV_32F); out = sum(Rect(0, 0, in[0].cols, in[0].rows)).clone(); } });
+	list.push_back({ "integral", { VX_DF_IMAGE_F32_AMD }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_integral(g, in[0], out, CV_32F); },
+		[](const vector<Mat>& in, Mat& out) { Mat sum; cv::integral(in[0], sum, CV_32F); out = sum(Rect(0, 0, in[0].cols, in[0].rows)).clone(); } });
+
+	// distanceTransform: L1 distance for both output depths
+	list.push_back({ "distancetransform", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_U8,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_distanceTransform(g, in[0], out); },
+		[](const vector<Mat>& in, Mat& out) { cv::distanceTransform(in[0], out, CV_DIST_L1, 3, CV_8U); } });
+	list.push_back({ "distancetransform", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_distanceTransform(g, in[0], out); },
+		[](const vector<Mat>& in, Mat& out) { cv::distanceTransform(in[0], out, CV_DIST_L1, 3, CV_32F); } });
+
+	// combinations that must fail vxVerifyGraph
+	list.push_back({ "add", { VX_DF_IMAGE_U8, VX_DF_IMAGE_RGB }, VX_DF_IMAGE_U8,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_add(g, in[0], in[1], out); }, nullptr });
+	list.push_back({ "subtract", { VX_DF_IMAGE_U16, VX_DF_IMAGE_S16 }, VX_DF_IMAGE_S16,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_subtract(g, in[0], in[1], out); }, nullptr });
+	list.push_back({ "subtract", { VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB }, VX_DF_IMAGE_U8,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_subtract(g, in[0], in[1], out); }, nullptr });
+	list.push_back({ "absdiff", { VX_DF_IMAGE_U8, VX_DF_IMAGE_U8 }, VX_DF_IMAGE_S16,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_absdiff(g, in[0], in[1], out); }, nullptr });
+	list.push_back({ "absdiff", { VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX }, VX_DF_IMAGE_RGB,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_absdiff(g, in[0], in[1], out); }, nullptr });
+	list.push_back({ "multiply", { VX_DF_IMAGE_U8, VX_DF_IMAGE_U8 }, VX_DF_IMAGE_S16,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_multiply(g, in[0], in[1], out, 1.0f, CV_8U); }, nullptr });
+	list.push_back({ "addweighted", { VX_DF_IMAGE_F32_AMD, VX_DF_IMAGE_S16 }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_addWeighted(g, in[0], 0.5f, in[1], 0.5f, 0.0f, out, CV_32F); }, nullptr });
+	list.push_back({ "sobel", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_S16,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_Sobel(g, in[0], out, -1, 1, 0, 3, 1.0f, 0.0f, BORDER_DEFAULT); }, nullptr });
+	list.push_back({ "blur", { VX_DF_IMAGE_RGBX }, VX_DF_IMAGE_RGB,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_blur(g, in[0], out, 5, 5, -1, -1, BORDER_DEFAULT); }, nullptr });
+	list.push_back({ "integral", { VX_DF_IMAGE_U8 }, VX_DF_IMAGE_F32_AMD,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_integral(g, in[0], out, CV_32S); }, nullptr });
+	list.push_back({ "integral", { VX_DF_IMAGE_F32_AMD }, VX_DF_IMAGE_S32,
+		[](vx_graph g, vx_image * in, vx_image out) { return vxExtCvNode_integral(g, in[0], out, -1); }, nullptr });
+
+	return list;
+}
+
+/************************************************************************************************************
+Copies between an OpenVX image and a Mat of the same size and element size
+*************************************************************************************************************/
+static vx_status CopyImage(vx_image image, Mat& mat, vx_enum usage)
+{
+	vx_rectangle_t rect = { 0, 0, (vx_uint32)mat.cols, (vx_uint32)mat.rows };
+	vx_imagepatch_addressing_t addr; void * ptr = NULL;
+	vx_status status = vxAccessImagePatch(image, &rect, 0, &addr, &ptr, usage);
+	if (status != VX_SUCCESS)
+		return status;
+	size_t len = mat.cols * mat.elemSize();
+	for (int y = 0; y < mat.rows; y++) {
+		vx_uint8 * row = (vx_uint8 *)ptr + y * addr.stride_y;
+		if (usage == VX_READ_ONLY) memcpy(mat.ptr(y), row, len);
+		else memcpy(row, mat.ptr(y), len);
+	}
+	return vxCommitImagePatch(image, &rect, 0, &addr, ptr);
+}
+
+/************************************************************************************************************
+The conversion passes a graph needed around the node before the bridge accepted the format:
+RGBX inputs to RGB and the result back to RGBX, other formats to S16 (RGB for 3 channels) and back
+*************************************************************************************************************/
+static void ConvertForOldBridge(const vector<Mat>& in, const Mat& out)
+{
+	Mat tmp;
+	for (auto& m : in) {
+		if (m.channels() == 4) cv::cvtColor(m, tmp, COLOR_RGBA2RGB);
+		else if (m.depth() != CV_8U && m.depth() != CV_16S) m.convertTo(tmp, CV_MAKETYPE(CV_16S, m.channels()));
+	}
+	Mat back;
+	if (out.channels() == 4) cv::cvtColor(out, back, COLOR_RGBA2RGB), cv::cvtColor(back, tmp, COLOR_RGB2RGBA);
+	else if (out.depth() != CV_8U && out.depth() != CV_16S) out.convertTo(back, CV_MAKETYPE(CV_16S, out.channels())), back.convertTo(tmp, out.type());
+}
+
+static bool NeedsOldConversion(const TestCase& t)
+{
+	bool needed = false;
+	for (auto f : t.input_formats)
+		needed |= (f != VX_DF_IMAGE_U8 && f != VX_DF_IMAGE_S16 && f != VX_DF_IMAGE_RGB);
+	return needed || (t.output_format != VX_DF_IMAGE_U8 && t.output_format != VX_DF_IMAGE_S16 && t.output_format != VX_DF_IMAGE_RGB);
+}
+
+/************************************************************************************************************
+Runs one test case and prints one CSV row; returns false on failure
+*************************************************************************************************************/
+static bool RunTest(vx_context context, const TestCase& t, Size size, int iterations, FILE * fp)
+{
+	bool expect_valid = !!t.opencv;
+	string formats;
+	for (auto f : t.input_formats)
+		formats += string(formats.empty() ? "" : "+") + FormatName(f);
+
+	// synthetic inputs: values in [1..255] (no division by zero), binary images for distanceTransform
+	vector<Mat> mat_in(t.input_formats.size());
+	vector<vx_image> img_in(t.input_formats.size(), nullptr);
+	vx_status status = VX_SUCCESS;
+	for (size_t i = 0; i < mat_in.size(); i++) {
+		mat_in[i].create(size, VX_to_CV_Format(t.input_formats[i]));
+		cv::randu(mat_in[i], Scalar::all(1), Scalar::all(255));
+		if (t.name == "distancetransform")
+			cv::threshold(mat_in[i], mat_in[i], 32, 255, THRESH_BINARY);
+		img_in[i] = vxCreateImage(context, size.width, size.height, t.input_formats[i]);
+		if ((status = CopyImage(img_in[i], mat_in[i], VX_WRITE_ONLY)) != VX_SUCCESS)
+			break;
+	}
+	vx_image img_out = vxCreateImage(context, size.width, size.height, t.output_format);
+
+	// OpenCV reference: a combination that OpenCV rejects must not pass the validators either
+	Mat ref;
+	const char * result = "PASS";
+	if (expect_valid) {
+		try {
+			t.opencv(mat_in, ref);
+		}
+		catch (const cv::Exception&) {
+			result = "FAIL(opencv-rejects)";
+		}
+	}
+
+	// one-node graph
+	vx_graph graph = vxCreateGraph(context);
+	vx_node node = t.create(graph, img_in.data(), img_out);
+	double max_diff = 0, node_ms = 0, conv_ms = 0;
+	if (status == VX_SUCCESS)
+		status = vxGetStatus((vx_reference)node);
+	if (status == VX_SUCCESS && !strcmp(result, "PASS"))
+		status = vxVerifyGraph(graph);
+	if (!expect_valid) {
+		result = (status != VX_SUCCESS) ? "PASS(rejected)" : "FAIL(accepted)";
+	}
+	else if (!strcmp(result, "PASS")) {
+		if (status == VX_SUCCESS)
+			status = vxProcessGraph(graph);
+		Mat mat_out(size, VX_to_CV_Format(t.output_format));
+		if (status == VX_SUCCESS)
+			status = CopyImage(img_out, mat_out, VX_READ_ONLY);
+		if (status != VX_SUCCESS) {
+			result = "FAIL(graph)";
+		}
+		else if (ref.size() != mat_out.size() || ref.type() != mat_out.type()) {
+			result = "FAIL(type)";
+		}
+		else {
+			max_diff = cv::norm(mat_out, ref, NORM_INF);
+			if (max_diff > 0)
+				result = "FAIL(mismatch)";
+
+			// node time, and the time of the conversion passes that the format used to need
+			for (int i = 0; i < iterations && status == VX_SUCCESS; i++)
+				status = vxProcessGraph(graph);
+			vx_perf_t perf = { 0 };
+			if (vxQueryNode(node, VX_NODE_ATTRIBUTE_PERFORMANCE, &perf, sizeof(perf)) == VX_SUCCESS)
+				node_ms = perf.avg * 1e-6;
+			if (NeedsOldConversion(t)) {
+				double t0 = ClockMsec();
+				for (int i = 0; i < iterations; i++)
+					ConvertForOldBridge(mat_in, ref);
+				conv_ms = (ClockMsec() - t0) / iterations;
+			}
+		}
+	}
+
+	fprintf(fp, "%s,%s,%s,%d,%d,%s,%g,%.4f,%.4f\n", t.name.c_str(), formats.c_str(), FormatName(t.output_format),
+		size.width, size.height, result, max_diff, node_ms, conv_ms);
+	fflush(fp);
+
+	if (node) vxReleaseNode(&node);
+	vxReleaseGraph(&graph);
+	vxReleaseImage(&img_out);
+	for (auto& img : img_in)
+		if (img) vxReleaseImage(&img);
+	return !strncmp(result, "PASS", 4);
+}
+
+/************************************************************************************************************
+Writes a scalar parameter between two vxProcessGraph calls without re-verifying the graph: the second
+result must use the new value (addWeighted alpha 0.5 -> 0.25)
+*************************************************************************************************************/
+static bool RunScalarWriteTest(vx_context context, Size size, FILE * fp)
+{
+	vector<Mat> mat_in(2);
+	vector<vx_image> img_in(2);
+	vx_status status = VX_SUCCESS;
+	for (size_t i = 0; i < mat_in.size(); i++) {
+		mat_in[i] = Mat(size, CV_8UC1);
+		cv::randu(mat_in[i], Scalar::all(0), Scalar::all(255));
+		img_in[i] = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+		if (status == VX_SUCCESS)
+			status = CopyImage(img_in[i], mat_in[i], VX_WRITE_ONLY);
+	}
+	vx_image img_out = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+	vx_graph graph = vxCreateGraph(context);
+	vx_node node = vxExtCvNode_addWeighted(graph, img_in[0], 0.5f, img_in[1], 0.5f, 0.0f, img_out, CV_8U);
+	if (status == VX_SUCCESS) status = vxGetStatus((vx_reference)node);
+	if (status == VX_SUCCESS) status = vxVerifyGraph(graph);
+	if (status == VX_SUCCESS) status = vxProcessGraph(graph);
+
+	// change alpha (node parameter 1) and run again without vxVerifyGraph
+	vx_parameter param = vxGetParameterByIndex(node, 1);
+	vx_scalar alpha = nullptr; vx_float32 value = 0.25f;
+	if (status == VX_SUCCESS) status = vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &alpha, sizeof(alpha));
+	if (status == VX_SUCCESS) status = vxWriteScalarValue(alpha, &value);
+	if (status == VX_SUCCESS) status = vxProcessGraph(graph);
+
+	Mat mat_out(size, CV_8UC1), ref;
+	if (status == VX_SUCCESS) status = CopyImage(img_out, mat_out, VX_READ_ONLY);
+	cv::addWeighted(mat_in[0], 0.25, mat_in[1], 0.5, 0.0, ref, CV_8U);
+	double max_diff = (status == VX_SUCCESS) ? cv::norm(mat_out, ref, NORM_INF) : 0;
+	const char * result = (status != VX_SUCCESS) ? "FAIL(graph)" : (max_diff > 0) ? "FAIL(stale-scalar)" : "PASS";
+	fprintf(fp, "scalar_write,U8+U8,U8,%d,%d,%s,%g,0,0\n", size.width, size.height, result, max_diff);
+
+	if (alpha) vxReleaseScalar(&alpha);
+	vxReleaseParameter(&param);
+	vxReleaseNode(&node);
+	vxReleaseGraph(&graph);
+	vxReleaseImage(&img_out);
+	for (auto& img : img_in)
+		vxReleaseImage(&img);
+	return !strcmp(result, "PASS");
+}
+
+/************************************************************************************************************
+Runs blur_batch on two rectangles: tiles that only share an edge must run, tiles that overlap must make
+vxProcessGraph fail since the batched kernels write their tiles concurrently
+*************************************************************************************************************/
+static bool RunBatchOverlapTest(vx_context context, Size size, bool overlap, FILE * fp)
+{
+	Mat mat_in(size, CV_8UC1);
+	cv::randu(mat_in, Scalar::all(0), Scalar::all(255));
+	vx_image img_in = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+	vx_image img_out = vxCreateImage(context, size.width, size.height, VX_DF_IMAGE_U8);
+	vx_status status = CopyImage(img_in, mat_in, VX_WRITE_ONLY);
+
+	// left and right halves, the right one widened by 8 pixels into the left one when overlapping
+	vx_uint32 half = (vx_uint32)size.width / 2, shift = overlap ? 8 : 0;
+	vx_rectangle_t rects[2] = {
+		{ 0, 0, half, (vx_uint32)size.height },
+		{ half - shift, 0, (vx_uint32)size.width, (vx_uint32)size.height },
+	};
+	vx_array rois = vxCreateArray(context, VX_TYPE_RECTANGLE, 2);
+	if (status == VX_SUCCESS) status = vxAddArrayItems(rois, 2, rects, sizeof(vx_rectangle_t));
+
+	vx_graph graph = vxCreateGraph(context);
+	vx_node node = vxExtCvNode_blur_batch(graph, img_in, img_out, rois, 3, 3, BORDER_DEFAULT);
+	if (status == VX_SUCCESS) status = vxGetStatus((vx_reference)node);
+	if (status == VX_SUCCESS) status = vxVerifyGraph(graph);
+	vx_status run_status = (status == VX_SUCCESS) ? vxProcessGraph(graph) : status;
+
+	const char * result;
+	if (status != VX_SUCCESS)
+		result = "FAIL(graph)";
+	else if (overlap)
+		result = (run_status != VX_SUCCESS) ? "PASS(rejected)" : "FAIL(accepted)";
+	else
+		result = (run_status == VX_SUCCESS) ? "PASS" : "FAIL(rejected)";
+	fprintf(fp, "%s,U8,U8,%d,%d,%s,0,0,0\n", overlap ? "blur_batch_overlap" : "blur_batch_adjacent", size.width, size.height, result);
+
+	vxReleaseNode(&node);
+	vxReleaseGraph(&graph);
+	vxReleaseArray(&rois);
+	vxReleaseImage(&img_out);
+	vxReleaseImage(&img_in);
+	return !strncmp(result, "PASS", 4);
+}
+
+int main(int argc, char * argv[])
+{
+	Size size(640, 480);
+	int iterations = 10;
+	const char * filter = nullptr;
+	const char * fileName = nullptr;
+
+	for (int arg = 1; arg < argc; arg++) {
+		if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+			int w = 0, h = 0;
+			if (sscanf(argv[++arg], "%dx%d", &w, &h) == 2 && w > 0 && h > 0)
+				size = Size(w, h);
+		}
+		else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+			iterations = max(1, atoi(argv[++arg]));
+		}
+		else if (!strcmp(argv[arg], "-k") && arg + 1 < argc) {
+			filter = argv[++arg];
+		}
+		else if (!strcmp(argv[arg], "-o") && arg + 1 < argc) {
+			fileName = argv[++arg];
+		}
+		else {
+			printf("Usage: cv_test [-r WxH] [-i iterations] [-k kernel] [-o output.csv]\n");
+			return -1;
+		}
+	}
+
+	FILE * fp = fileName ? fopen(fileName, "w") : stdout;
+	if (!fp) {
+		printf("ERROR: unable to create: %s\n", fileName);
+		return -1;
+	}
+
+	vx_context context = vxCreateContext();
+	if (vxGetStatus((vx_reference)context) != VX_SUCCESS || vxLoadKernels(context, "vx_ext_cv") != VX_SUCCESS) {
+		printf("ERROR: unable to create OpenVX context with vx_ext_cv kernels\n");
+		return -1;
+	}
+
+	int failures = 0;
+	fprintf(fp, "kernel,inputs,output,width,height,result,max_diff,node_ms,conv_ms\n");
+	for (auto& t : GetTestCases()) {
+		if (filter && strcmp(filter, t.name.c_str()))
+			continue;
+		if (!RunTest(context, t, size, iterations, fp))
+			failures++;
+	}
+	if ((!filter || !strcmp(filter, "addweighted")) && !RunScalarWriteTest(context, size, fp))
+		failures++;
+	if (!filter || !strcmp(filter, "blur_batch")) {
+		if (!RunBatchOverlapTest(context, size, false, fp))
+			failures++;
+		if (!RunBatchOverlapTest(context, size, true, fp))
+			failures++;
+	}
+
+	vxReleaseContext(&context);
+	if (fp != stdout) fclose(fp);
+	printf("%d test(s) failed\n", failures);
+	return failures ? 1 : 0;
+}
@@ -71,10 +71,11 @@ void CLoomShellParser::help(bool detailed)
 	Message("        showViewingModule(context);\n");
 	Message("    ~ initialize and schedule\n");
 	Message("        lsInitialize(context);\n");
+	Message("        showInitializeTiming(context);\n");
 	Message("        lsScheduleFrame(context);\n");
 	Message("        lsWaitForCompletion(context);\n");
 	Message("        run(context,frameCount);\n");
-	Message("        runParallel(contextArray,contextCount,frameCount);\n");
+	Message("        runParallel(contextArray,contextCount,frameCount[,frameRate]);\n");
 	Message("    ~ image I/O configuration (not supported with LoomIO)\n");
 	Message("        lsSetCameraBufferStride(context,stride);\n");
 	Message("        lsSetOutputBufferStride(context,stride);\n");
@@ -1025,6 +1025,18 @@ int CLoomShellParser::OnCommand()
 		vx_status status = showRigParams(context_[contextIndex]);
 		if (status) return status;
 	}
+	else if (!_stricmp(command, "showInitializeTiming")) {
+		// parse the command
+		vx_uint32 contextIndex = 0;
+		const char * invalidSyntax = "ERROR: invalid syntax: expects: showInitializeTiming(context);";
+		SYNTAX_CHECK(ParseSkip(s, "("));
+		SYNTAX_CHECK(ParseContextWithErrorCheck(s, contextIndex, invalidSyntax));
+		SYNTAX_CHECK(ParseSkip(s, ")"));
+		SYNTAX_CHECK(ParseEndOfLine(s));
+		// process the command
+		vx_status status = showInitializeTiming(context_[contextIndex]);
+		if (status) return status;
+	}
 	else if (!_stricmp(command, "showCameraConfig")) {
 		// parse the command
 		vx_uint32 contextIndex = 0;
@@ -1412,19 +1424,24 @@ int CLoomShellParser::OnCommand()
 	}
 	else if (!_stricmp(command, "runParallel")) {
 		// parse the command
-		vx_uint32 contextCount = 0, frameCount = 1;
-		const char * invalidSyntax = "ERROR: invalid syntax: expects: runParallel(contextArray,contextCount,frameCount);";
+		vx_uint32 contextCount = 0, frameCount = 1, frameRate = 0;
+		const char * invalidSyntax = "ERROR: invalid syntax: expects: runParallel(contextArray,contextCount,frameCount[,frameRate]);";
 		SYNTAX_CHECK(ParseSkip(s, "("));
 		SYNTAX_CHECK(ParseSkipPattern(s, name_ls));
 		SYNTAX_CHECK(ParseSkip(s, ","));
 		SYNTAX_CHECK(ParseUInt(s, contextCount));
 		SYNTAX_CHECK(ParseSkip(s, ","));
 		SYNTAX_CHECK(ParseUInt(s, frameCount));
+		SYNTAX_CHECK(ParseSkip(s, ""));
+		if (*s == ',') {
+			SYNTAX_CHECK(ParseSkip(s, ","));
+			SYNTAX_CHECK(ParseUInt(s, frameRate));
+		}
 		SYNTAX_CHECK(ParseSkip(s, ")"));
 		SYNTAX_CHECK(ParseEndOfLine(s));
 		if (num_context_ < 2 || contextCount < 2 || contextCount > num_context_) return Error("ERROR: can't run specified contexts in parallel");
 		// process the command
-		vx_status status = runParallel(context_, contextCount, frameCount);
+		vx_status status = runParallel(context_, contextCount, frameCount, frameRate);
 		if (status) return status;
 	}
 	else if (!_stricmp(command, "ls_context")) {
@@ -29,6 +29,10 @@ THE SOFTWARE.
 #include <stdlib.h>
 #include <stdarg.h>
 #include <map>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
 
 #if _WIN32
 #include <windows.h>
@@ -218,54 +222,105 @@ vx_status run(ls_context context, vx_uint32 frameCount)
 	return VX_SUCCESS;
 }
 
-vx_status runParallel(ls_context * context, vx_uint32 contextCount, vx_uint32 frameCount)
+// per-context execution record of runParallel
+struct ParallelRunStats {
+	vx_status status;
+	vx_uint32 count;
+	double msec_first;
+	double msec_start;
+	double msec_end;
+	std::vector<double> latency;
+};
+
+static double Percentile(std::vector<double>& v, double p)
 {
-	vx_status status = VX_SUCCESS;
-	double clk2msec = 1000.0 / GetClockFrequency();
-	double msec_first = 0, msec_sum = 0, msec_min = 0, msec_max = 0, msec_count = 0;
-	vx_uint32 count = 0;
-	for (vx_uint32 i = 0; frameCount == 0 || i < frameCount; i++, count++) {
+	if (v.empty()) return 0;
+	size_t k = (size_t)(p * (v.size() - 1) + 0.5);
+	std::nth_element(v.begin(), v.begin() + k, v.end());
+	return v[k];
+}
+
+static void ShowParallelStats(const char * name, vx_uint32 count, double msec_first, double msec_elapsed, std::vector<double>& latency)
+{
+	double fps = (msec_elapsed > 0) ? 1000.0 * count / msec_elapsed : 0;
+	Message("OK: runParallel: %s: %d frames in %.3lf ms; %7.3lf fps; %7.3lf ms (1st-frame)\n", name, count, msec_elapsed, fps, msec_first);
+	if (latency.size() > 0) {
+		double p50 = Percentile(latency, 0.50), p90 = Percentile(latency, 0.90), p99 = Percentile(latency, 0.99);
+		double msec_min = *std::min_element(latency.begin(), latency.end()), msec_max = *std::max_element(latency.begin(), latency.end());
+		Message("OK: runParallel: %s: Latency: %7.3lf ms (min); %7.3lf ms (p50); %7.3lf ms (p90); %7.3lf ms (p99); %7.3lf ms (max)\n", name, msec_min, p50, p90, p99, msec_max);
+	}
+}
+
+static void runParallelThread(ls_context context, vx_uint32 index, vx_uint32 frameCount, vx_uint32 frameRate, double clk2msec, ParallelRunStats * stats)
+{
+	// each context is scheduled by its own thread: a slow context doesn't stall the others
+	std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::duration period = frameRate ? std::chrono::steady_clock::duration(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num / frameRate) : std::chrono::steady_clock::duration(0);
+	stats->msec_start = clk2msec * GetClockCounter();
+	for (vx_uint32 i = 0; frameCount == 0 || i < frameCount; i++) {
+		if (frameRate) {
+			// independent frame pacing: release the frame at its own cadence
+			std::this_thread::sleep_until(next);
+			next += period;
+		}
 		int64_t clk = GetClockCounter();
-		for (vx_uint32 j = 0; j < contextCount; j++) {
-			if (context[j]) {
-				status = lsScheduleFrame(context[j]);
-				if (status == VX_ERROR_GRAPH_ABANDONED) break;
-				if (status) return Error("ERROR: lsScheduleFrame(context[%d]) failed (%d) @iter:%d", j, status, i);
-			}
+		vx_status status = lsScheduleFrame(context);
+		if (status == VX_SUCCESS) {
+			status = lsWaitForCompletion(context);
+			if (status && status != VX_ERROR_GRAPH_ABANDONED) Error("ERROR: lsWaitForCompletion(context[%d]) failed (%d) @iter:%d", index, status, i);
 		}
-		if (status) break;
-		for (vx_uint32 j = 0; j < contextCount; j++) {
-			if (context[j]) {
-				status = lsWaitForCompletion(context[j]);
-				if (status == VX_ERROR_GRAPH_ABANDONED) break;
-				if (status) return Error("ERROR: lsWaitForCompletion(context[%d]) failed (%d) @iter:%d", j, status, i);
-			}
+		else if (status != VX_ERROR_GRAPH_ABANDONED) Error("ERROR: lsScheduleFrame(context[%d]) failed (%d) @iter:%d", index, status, i);
+		if (status) {
+			stats->status = status;
+			break;
 		}
-		if (status) break;
 		double msec = clk2msec * (GetClockCounter() - clk);
-		if (i == 0) {
-			msec_first = msec;
-		}
-		else if (i == 1) {
-			msec_sum = msec_min = msec_max = msec;
-			msec_count = 1;
-		}
-		else {
-			msec_sum += msec;
-			msec_count += 1;
-			msec_min = (msec < msec_min) ? msec : msec_min;
-			msec_max = (msec > msec_max) ? msec : msec_max;
-		}
+		if (i == 0) stats->msec_first = msec;
+		else stats->latency.push_back(msec);
+		stats->count++;
 	}
-	if (status) Message("WARNING: runParallel: execution abandoned after %d frames\n", count);
-	else        Message("OK: runParallel: executed for %d frames\n", count);
-	if (count == 1) {
-		Message("OK: runParallel: Time: %7.3lf ms\n", msec_first);
+	stats->msec_end = clk2msec * GetClockCounter();
+}
+
+vx_status runParallel(ls_context * context, vx_uint32 contextCount, vx_uint32 frameCount, vx_uint32 frameRate)
+{
+	double clk2msec = 1000.0 / GetClockFrequency();
+	std::vector<ParallelRunStats> stats(contextCount);
+	std::vector<std::thread> threads;
+	for (vx_uint32 j = 0; j < contextCount; j++) {
+		stats[j].status = VX_SUCCESS;
+		stats[j].count = 0;
+		stats[j].msec_first = stats[j].msec_start = stats[j].msec_end = 0;
+		if (frameCount > 0) stats[j].latency.reserve(frameCount);
+		if (context[j]) {
+			threads.push_back(std::thread(runParallelThread, context[j], j, frameCount, frameRate, clk2msec, &stats[j]));
+		}
 	}
-	else if (msec_count > 0) {
-		Message("OK: runParallel: Time: %7.3lf ms (min); %7.3lf ms (avg); %7.3lf ms (max); %7.3lf ms (1st-frame) of %d frames\n", msec_min, msec_sum / msec_count, msec_max, msec_first, count);
+	for (auto& thread : threads) {
+		thread.join();
 	}
-	return VX_SUCCESS;
+
+	// per-context and aggregate throughput and latency
+	vx_status status = VX_SUCCESS;
+	vx_uint32 count = 0;
+	double msec_start = 0, msec_end = 0, msec_first = 0;
+	std::vector<double> latency;
+	for (vx_uint32 j = 0; j < contextCount; j++) {
+		if (!context[j]) continue;
+		char name[32]; sprintf(name, "context[%d]", j);
+		if (stats[j].status) {
+			Message("WARNING: runParallel: %s: execution abandoned after %d frames\n", name, stats[j].count);
+			if (stats[j].status != VX_ERROR_GRAPH_ABANDONED) status = stats[j].status;
+		}
+		ShowParallelStats(name, stats[j].count, stats[j].msec_first, stats[j].msec_end - stats[j].msec_start, stats[j].latency);
+		if (count == 0 || stats[j].msec_start < msec_start) msec_start = stats[j].msec_start;
+		if (count == 0 || stats[j].msec_end > msec_end) msec_end = stats[j].msec_end;
+		msec_first = (stats[j].msec_first > msec_first) ? stats[j].msec_first : msec_first;
+		count += stats[j].count;
+		latency.insert(latency.end(), stats[j].latency.begin(), stats[j].latency.end());
+	}
+	ShowParallelStats("aggregate", count, msec_first, msec_end - msec_start, latency);
+	return status;
 }
 
 vx_status showOutputConfig(ls_context context)
@@ -414,6 +469,22 @@ vx_status showOverlayBufferStride(ls_context context)
 	return VX_SUCCESS;
 }
 
+vx_status showInitializeTiming(ls_context context)
+{
+	static const char * phaseName[LIVE_STITCH_INIT_PHASE_MAX_COUNT] = {
+		"total", "setup", "lens mapping", "overlap detect", "remap tables", "warp tables", "merge tables",
+		"expcomp tables", "seamfind tables", "blend tables", "mask images", "graph creation", "graph verify", "sync tables",
+	};
+	float msec[LIVE_STITCH_INIT_PHASE_MAX_COUNT] = { 0 };
+	vx_status status = lsGetInitializeTiming(context, 0, LIVE_STITCH_INIT_PHASE_MAX_COUNT, msec);
+	if (status) return Error("ERROR: lsGetInitializeTiming() failed (%d)", status);
+	for (vx_uint32 i = 1; i < LIVE_STITCH_INIT_PHASE_MAX_COUNT; i++) {
+		Message("..showInitializeTiming: %-16s %10.3f ms\n", phaseName[i], msec[i]);
+	}
+	Message("..showInitializeTiming: %-16s %10.3f ms\n", phaseName[LIVE_STITCH_INIT_PHASE_TOTAL], msec[LIVE_STITCH_INIT_PHASE_TOTAL]);
+	return VX_SUCCESS;
+}
+
 vx_status showConfiguration(ls_context context, const char * exportType)
 {
 	return lsExportConfiguration(context, exportType, nullptr);
@@ -25,7 +25,7 @@ THE SOFTWARE.
 #include "live_stitch_api.h"
 
 vx_status run(ls_context context, vx_uint32 frameCount);
-vx_status runParallel(ls_context * context, vx_uint32 contextCount, vx_uint32 frameCount);
+vx_status runParallel(ls_context * context, vx_uint32 contextCount, vx_uint32 frameCount, vx_uint32 frameRate = 0);
 
 vx_status showOutputConfig(ls_context context);
 vx_status showCameraConfig(ls_context context);
@@ -38,6 +38,7 @@ vx_status showViewingModule(ls_context context);
 vx_status showCameraBufferStride(ls_context context);
 vx_status showOutputBufferStride(ls_context context);
 vx_status showOverlayBufferStride(ls_context context);
+vx_status showInitializeTiming(ls_context context);
 vx_status showConfiguration(ls_context context, const char * exportType);
 vx_status showAttributes(ls_context context, vx_uint32 offset, vx_uint32 count);
 vx_status showGlobalAttributes(vx_uint32 offset, vx_uint32 count);
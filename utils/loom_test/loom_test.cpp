@@ -0,0 +1,906 @@
+/*
+Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#ifndef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+#include "live_stitch_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <functional>
+#include <algorithm>
+
+#define ERROR_CHECK_STATUS(call) { vx_status status_ = (call); if(status_ != VX_SUCCESS) { printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); return false; } }
+
+//! \brief The rig and run length shared by all tests.
+struct TestConfig {
+	vx_uint32 num_cameras;
+	vx_uint32 camera_width, camera_height;
+	vx_uint32 output_width;
+	vx_uint32 frames;
+};
+
+//! \brief An attribute value set before the context is created.
+struct TestAttr {
+	vx_uint32 attr;
+	vx_float32 value;
+};
+
+static vx_float32 g_default_attr[LIVE_STITCH_ATTR_MAX_COUNT];
+
+static double ClockMsec()
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void stitch_log_callback(const char * message)
+{
+	printf("%s", message);
+	fflush(stdout);
+}
+
+//! \brief Create and initialize a stitch context for a synthetic rig with host buffers.
+//  The cameras are spread evenly in yaw with 120 degree rectilinear lenses, so that neighbours overlap.
+//  Global attributes are reset to their defaults before the test specific ones are applied.
+static ls_context CreateRig(const TestConfig& cfg, const std::vector<TestAttr>& attrs, vx_df_image camera_format = VX_DF_IMAGE_RGB, vx_df_image output_format = VX_DF_IMAGE_RGB)
+{
+	vx_float32 host_buffers = 1.0f;
+	if (lsGlobalSetAttributes(0, LIVE_STITCH_ATTR_MAX_COUNT, g_default_attr) != VX_SUCCESS ||
+		lsGlobalSetAttributes(LIVE_STITCH_ATTR_HOST_BUFFERS, 1, &host_buffers) != VX_SUCCESS)
+		return nullptr;
+	for (auto& a : attrs) {
+		if (lsGlobalSetAttributes(a.attr, 1, &a.value) != VX_SUCCESS)
+			return nullptr;
+	}
+	ls_context stitch = lsCreateContext();
+	if (!stitch)
+		return nullptr;
+	vx_status status = lsSetOutputConfig(stitch, output_format, cfg.output_width, cfg.output_width / 2);
+	if (status == VX_SUCCESS)
+		status = lsSetCameraConfig(stitch, cfg.num_cameras, 1, camera_format, cfg.camera_width, cfg.camera_height * cfg.num_cameras);
+	for (vx_uint32 i = 0; i < cfg.num_cameras && status == VX_SUCCESS; i++) {
+		camera_params par = { 0 };
+		par.focal.yaw = -180.0f + 360.0f * i / cfg.num_cameras;
+		par.lens.hfov = 120.0f;
+		par.lens.haw = (float)cfg.camera_width;
+		par.lens.lens_type = ptgui_lens_rectilinear;
+		status = lsSetCameraParams(stitch, i, &par);
+	}
+	if (status == VX_SUCCESS)
+		status = lsInitialize(stitch);
+	if (status != VX_SUCCESS) {
+		printf("ERROR: rig initialization failed with status = (%d)\n", status);
+		lsReleaseContext(&stitch);
+		return nullptr;
+	}
+	return stitch;
+}
+
+//! \brief Check that an RGB output comes from one camera frame of uniform value:
+//  every pixel is either black (not covered by any camera) or within 1 of the value.
+static bool CheckUniformOutput(const vx_uint8 * output, size_t size, vx_uint8 value, size_t * covered = nullptr)
+{
+	size_t count = 0;
+	for (size_t i = 0; i < size; i++) {
+		if (output[i] == 0) continue;
+		if (abs((int)output[i] - (int)value) > 1)
+			return false;
+		count++;
+	}
+	if (covered) *covered = count;
+	return count > 0;
+}
+
+//! \brief A frame value that is far from black and changes from frame to frame.
+static vx_uint8 FrameValue(vx_uint32 frame)
+{
+	return (vx_uint8)(32 + (frame * 37) % 192);
+}
+
+/***********************************************************************************************************************************
+host_roundtrip: stitch host camera buffers into host output buffers at 4K (default rig) and report the throughput.
+Each frame fills the camera buffer with a new uniform value and checks that the output shows that value.
+************************************************************************************************************************************/
+static bool TestHostRoundtrip(const TestConfig& cfg)
+{
+	TestAttr attrs[] = { { LIVE_STITCH_ATTR_EXPCOMP, 0.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 0.0f } };
+	ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + 2));
+	if (!stitch) return false;
+
+	size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * cfg.num_cameras * 3;
+	size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 3;
+	std::vector<vx_uint8> camera(camera_size), output(output_size);
+	ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera.data()));
+	ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output.data()));
+
+	bool pass = true;
+	double stitch_msec = 0;
+	size_t covered = 0;
+	for (vx_uint32 frame = 0; frame < cfg.frames && pass; frame++) {
+		vx_uint8 value = FrameValue(frame);
+		memset(camera.data(), value, camera_size);
+		double t0 = ClockMsec();
+		ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+		ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		stitch_msec += ClockMsec() - t0;
+		if (!CheckUniformOutput(output.data(), output_size, value, &covered)) {
+			printf("ERROR: host_roundtrip: frame %d: output doesn't match camera value %d\n", frame, value);
+			pass = false;
+		}
+	}
+	double frame_msec = stitch_msec / std::max(cfg.frames, 1u);
+	printf("host_roundtrip: %dx%d output, %d cameras: %.3f msec/frame, %.1f fps, %.1f MB/s (camera+output), %.1f%% of output covered\n",
+		cfg.output_width, cfg.output_width / 2, cfg.num_cameras, frame_msec, 1000.0 / frame_msec,
+		(camera_size + output_size) / (frame_msec * 1000.0), 100.0 * covered / output_size);
+
+	ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+	return pass;
+}
+
+/***********************************************************************************************************************************
+buffer_ring: overlap capture with stitching using rings of host buffers, and compare the throughput with the serial loop.
+Capture is simulated by filling a camera buffer with a uniform value and sleeping for a fixed capture latency.
+Each output frame must show only the value of its own camera frame, so an output that mixes two captures (tearing) fails.
+Mixing a ring with a single buffer of the same kind must be rejected.
+************************************************************************************************************************************/
+static bool TestBufferRing(const TestConfig& cfg)
+{
+	const vx_uint32 ring_size = 3;
+	const int capture_msec = 10;
+	TestAttr attrs[] = { { LIVE_STITCH_ATTR_EXPCOMP, 0.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 0.0f } };
+	ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + 2));
+	if (!stitch) return false;
+
+	size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * cfg.num_cameras * 3;
+	size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 3;
+	std::vector<vx_uint8> camera[ring_size], output[ring_size];
+	void * camera_ptr[ring_size], * output_ptr[ring_size];
+	for (vx_uint32 i = 0; i < ring_size; i++) {
+		camera[i].resize(camera_size); camera_ptr[i] = camera[i].data();
+		output[i].resize(output_size); output_ptr[i] = output[i].data();
+	}
+	auto capture = [&](vx_uint32 index, vx_uint32 frame) {
+		memset(camera_ptr[index], FrameValue(frame), camera_size);
+		std::this_thread::sleep_for(std::chrono::milliseconds(capture_msec));
+	};
+
+	// serial loop with single buffers: capture, then stitch
+	bool pass = true;
+	ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera_ptr[0]));
+	ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output_ptr[0]));
+	if (lsSetCameraBufferRingHost(stitch, ring_size, camera_ptr) == VX_SUCCESS || lsSetOutputBufferRingHost(stitch, ring_size, output_ptr) == VX_SUCCESS) {
+		printf("ERROR: buffer_ring: setting a ring while a single buffer is set was accepted\n");
+		pass = false;
+	}
+	double t0 = ClockMsec();
+	for (vx_uint32 frame = 0; frame < cfg.frames && pass; frame++) {
+		capture(0, frame);
+		ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+		ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		if (!CheckUniformOutput(output[0].data(), output_size, FrameValue(frame))) {
+			printf("ERROR: buffer_ring: serial frame %d: output doesn't match camera value %d\n", frame, FrameValue(frame));
+			pass = false;
+		}
+	}
+	double serial_msec = (ClockMsec() - t0) / std::max(cfg.frames, 1u);
+	ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, nullptr));
+	ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, nullptr));
+
+	// overlapped loop with rings: capture frame N+1 while frame N is stitched
+	ERROR_CHECK_STATUS(lsSetCameraBufferRingHost(stitch, ring_size, camera_ptr));
+	ERROR_CHECK_STATUS(lsSetOutputBufferRingHost(stitch, ring_size, output_ptr));
+	if (lsSetCameraBufferHost(stitch, camera_ptr[0]) == VX_SUCCESS || lsSetOutputBufferHost(stitch, output_ptr[0]) == VX_SUCCESS) {
+		printf("ERROR: buffer_ring: setting a single buffer while a ring is set was accepted\n");
+		pass = false;
+	}
+	vx_uint32 camera_index = 0, output_index = 0;
+	t0 = ClockMsec();
+	if (pass) capture(camera_index, 0);
+	for (vx_uint32 frame = 0; frame < cfg.frames && pass; frame++) {
+		ERROR_CHECK_STATUS(lsGetBufferRingIndex(stitch, nullptr, &output_index));
+		ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+		ERROR_CHECK_STATUS(lsGetBufferRingIndex(stitch, &camera_index, nullptr));
+		if (frame + 1 < cfg.frames)
+			capture(camera_index, frame + 1);
+		ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		if (!CheckUniformOutput(output[output_index].data(), output_size, FrameValue(frame))) {
+			printf("ERROR: buffer_ring: ring frame %d: output buffer#%d doesn't match camera value %d (torn frame)\n", frame, output_index, FrameValue(frame));
+			pass = false;
+		}
+	}
+	double ring_msec = (ClockMsec() - t0) / std::max(cfg.frames, 1u);
+	ERROR_CHECK_STATUS(lsSetCameraBufferRingHost(stitch, 0, nullptr));
+	ERROR_CHECK_STATUS(lsSetOutputBufferRingHost(stitch, 0, nullptr));
+
+	printf("buffer_ring: %d msec capture, ring of %d: serial %.3f msec/frame (%.1f fps), ring %.3f msec/frame (%.1f fps), %.2fx\n",
+		capture_msec, ring_size, serial_msec, 1000.0 / serial_msec, ring_msec, 1000.0 / ring_msec, serial_msec / ring_msec);
+
+	ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+	return pass;
+}
+
+/***********************************************************************************************************************************
+expcomp_interval: run exposure compensation with a gain update interval and check that the gain update kernels only run when due.
+Camera i shows a uniform value that differs per camera, and camera 0 slowly brightens, so the gains keep moving.
+With interval N and no stagger, the statistics and solve kernels run on one frame of every N; with stagger, the solve runs once per N
+and the statistics only on frames where an overlapping camera pair is due.
+The gains must not change on frames without a solve, and must only move by a bounded step after the first solve.
+************************************************************************************************************************************/
+static bool TestExpCompInterval(const TestConfig& cfg)
+{
+	const vx_uint32 interval = 5;
+	const vx_float32 smoothing = 0.5f, max_step = 0.15f;
+	bool pass = true;
+	for (vx_uint32 stagger = 0; stagger < 2 && pass; stagger++) {
+		TestAttr attrs[] = {
+			{ LIVE_STITCH_ATTR_EXPCOMP, 1.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 0.0f }, { LIVE_STITCH_ATTR_EXPCOMP_INTERVAL, (vx_float32)interval },
+			{ LIVE_STITCH_ATTR_EXPCOMP_STAGGER, (vx_float32)stagger }, { LIVE_STITCH_ATTR_EXPCOMP_SMOOTHING, smoothing },
+		};
+		ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + sizeof(attrs) / sizeof(attrs[0])));
+		if (!stitch) return false;
+
+		size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * 3;
+		size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 3;
+		std::vector<vx_uint8> camera(camera_size * cfg.num_cameras), output(output_size);
+		ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera.data()));
+		ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output.data()));
+
+		std::vector<vx_float32> gains(cfg.num_cameras, 1.0f), prev_gains(cfg.num_cameras);
+		ERROR_CHECK_STATUS(lsGetExposureCompGains(stitch, cfg.num_cameras, gains.data()));
+		vx_uint32 solve_frames = 0, calc_frames = 0;
+		for (vx_uint32 frame = 0; frame < cfg.frames && pass; frame++) {
+			for (vx_uint32 i = 0; i < cfg.num_cameras; i++)
+				memset(camera.data() + camera_size * i, (int)std::min(80 + 30 * i + (i == 0 ? frame / 2 : 0), 250u), camera_size);
+			ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+			ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+			bool solve_due = (frame % interval) == (stagger ? interval - 1 : 0);
+			if (solve_due) solve_frames++;
+			if (!stagger && solve_due) calc_frames++;
+			prev_gains = gains;
+			ERROR_CHECK_STATUS(lsGetExposureCompGains(stitch, cfg.num_cameras, gains.data()));
+			for (vx_uint32 i = 0; i < cfg.num_cameras; i++) {
+				vx_float32 step = fabsf(gains[i] - prev_gains[i]);
+				if (!solve_due && step > 0.0f) {
+					printf("ERROR: expcomp_interval: stagger %d: frame %d: gain of camera %d changed from %.4f to %.4f without a solve\n", stagger, frame, i, prev_gains[i], gains[i]);
+					pass = false;
+				}
+				else if (solve_due && solve_frames > 1 && step > max_step) {
+					printf("ERROR: expcomp_interval: stagger %d: frame %d: gain of camera %d jumped from %.4f to %.4f\n", stagger, frame, i, prev_gains[i], gains[i]);
+					pass = false;
+				}
+			}
+		}
+
+		vx_uint64 count[LIVE_STITCH_NODE_MAX_COUNT] = { 0 };
+		ERROR_CHECK_STATUS(lsGetNodeExecutionCount(stitch, 0, LIVE_STITCH_NODE_MAX_COUNT, count));
+		printf("expcomp_interval: interval %d, stagger %d: %d frames: calc %d, solve %d, apply %d executions, gains:", interval, stagger, cfg.frames,
+			(int)count[LIVE_STITCH_NODE_EXPCOMP_CALC], (int)count[LIVE_STITCH_NODE_EXPCOMP_SOLVE], (int)count[LIVE_STITCH_NODE_EXPCOMP_APPLY]);
+		for (auto g : gains) printf(" %.4f", g);
+		printf("\n");
+		if (count[LIVE_STITCH_NODE_EXPCOMP_SOLVE] != solve_frames || count[LIVE_STITCH_NODE_EXPCOMP_APPLY] != cfg.frames ||
+			(!stagger && count[LIVE_STITCH_NODE_EXPCOMP_CALC] != calc_frames) || !count[LIVE_STITCH_NODE_EXPCOMP_CALC] || count[LIVE_STITCH_NODE_EXPCOMP_CALC] > cfg.frames)
+		{
+			printf("ERROR: expcomp_interval: stagger %d: expected %d solve, %d apply, and %s calc executions\n", stagger, solve_frames, cfg.frames,
+				stagger ? "1 up to one per frame of" : std::to_string(calc_frames).c_str());
+			pass = false;
+		}
+		ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+	}
+	return pass;
+}
+
+/***********************************************************************************************************************************
+seamfind_schedule: run seam find with LIVE_STITCH_ATTR_SEAM_FREQUENCY 300 and 0 (no stagger, no scene refresh), and compare frame times.
+All overlaps start on frame 0, and overlap k of a seam type is due every (frequency + k) frames: with frequency 0 the first overlap is
+due on every frame, and with frequency 300 no overlap is due again before frame 300. The seam find nodes after scene detect must only
+run on due frames, which is checked with the node execution counts.
+************************************************************************************************************************************/
+static bool TestSeamFindSchedule(const TestConfig& cfg)
+{
+	const vx_uint32 frequency[2] = { 0, 300 };
+	const vx_uint32 seamNodes[] = {
+		LIVE_STITCH_NODE_SEAMFIND_COST_GENERATE, LIVE_STITCH_NODE_SEAMFIND_COST_ACCUM, LIVE_STITCH_NODE_SEAMFIND_PATH_TRACE, LIVE_STITCH_NODE_SEAMFIND_SET_WEIGHTS,
+	};
+	size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * 3;
+	size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 3;
+	std::vector<vx_uint8> camera(camera_size * cfg.num_cameras), output(output_size);
+	double frame_msec[2] = { 0, 0 };
+	bool pass = true;
+	for (int k = 0; k < 2 && pass; k++) {
+		TestAttr attrs[] = {
+			{ LIVE_STITCH_ATTR_EXPCOMP, 0.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 1.0f }, { LIVE_STITCH_ATTR_SEAM_REFRESH, 0.0f },
+			{ LIVE_STITCH_ATTR_SEAM_STAGGER, 0.0f }, { LIVE_STITCH_ATTR_SEAM_FREQUENCY, (vx_float32)frequency[k] },
+		};
+		ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + sizeof(attrs) / sizeof(attrs[0])));
+		if (!stitch) return false;
+		ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera.data()));
+		ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output.data()));
+		double t0 = ClockMsec();
+		for (vx_uint32 frame = 0; frame < cfg.frames; frame++) {
+			for (vx_uint32 i = 0; i < cfg.num_cameras; i++)
+				memset(camera.data() + camera_size * i, FrameValue(frame + 7 * i), camera_size);
+			ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+			ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		}
+		frame_msec[k] = (ClockMsec() - t0) / cfg.frames;
+
+		vx_uint64 count[LIVE_STITCH_NODE_MAX_COUNT] = { 0 };
+		ERROR_CHECK_STATUS(lsGetNodeExecutionCount(stitch, 0, LIVE_STITCH_NODE_MAX_COUNT, count));
+		printf("seamfind_schedule: frequency %d: %d frames: warp %d, merge %d, scene detect %d, cost generate %d, cost accumulate %d, path trace %d, set weights %d executions: %.3f msec/frame\n",
+			frequency[k], cfg.frames, (int)count[LIVE_STITCH_NODE_WARP], (int)count[LIVE_STITCH_NODE_MERGE], (int)count[LIVE_STITCH_NODE_SEAMFIND_SCENE_DETECT],
+			(int)count[LIVE_STITCH_NODE_SEAMFIND_COST_GENERATE], (int)count[LIVE_STITCH_NODE_SEAMFIND_COST_ACCUM],
+			(int)count[LIVE_STITCH_NODE_SEAMFIND_PATH_TRACE], (int)count[LIVE_STITCH_NODE_SEAMFIND_SET_WEIGHTS], frame_msec[k]);
+		// with frequency 300, runs longer than 300 frames have more due frames depending on the number of overlaps: only check the bounds
+		vx_uint64 max_overlaps = cfg.num_cameras * (cfg.num_cameras - 1) / 2;
+		vx_uint64 expected = (frequency[k] == 0) ? cfg.frames : 1;
+		vx_uint64 upper = (frequency[k] == 0 || cfg.frames <= frequency[k]) ? expected : 1 + (cfg.frames / (frequency[k] + 1)) * max_overlaps;
+		if (count[LIVE_STITCH_NODE_WARP] != cfg.frames || count[LIVE_STITCH_NODE_MERGE] != cfg.frames || count[LIVE_STITCH_NODE_SEAMFIND_SCENE_DETECT] != 0) {
+			printf("ERROR: seamfind_schedule: frequency %d: expected %d warp and merge executions, and no scene detect\n", frequency[k], cfg.frames);
+			pass = false;
+		}
+		for (auto node : seamNodes) {
+			if (count[node] < expected || count[node] > upper) {
+				printf("ERROR: seamfind_schedule: frequency %d: seam find node %d ran %d times, expected %d up to %d\n", frequency[k], node, (int)count[node], (int)expected, (int)upper);
+				pass = false;
+			}
+		}
+		ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+	}
+	if (pass) {
+		printf("seamfind_schedule: frequency 300 takes %.3f msec/frame less than a seam on every frame (%.1f%%)\n",
+			frame_msec[0] - frame_msec[1], frame_msec[0] > 0 ? 100.0 * (frame_msec[0] - frame_msec[1]) / frame_msec[0] : 0.0);
+	}
+	return pass;
+}
+
+/***********************************************************************************************************************************
+fuse_color_convert: stitch UYVY cameras into a UYVY output with and without LIVE_STITCH_ATTR_FUSE_COLOR_CONVERT, and compare.
+The fused path skips the 8-bit rounding of the RGB intermediates, so the outputs may differ by at most 2 code values.
+************************************************************************************************************************************/
+static bool TestFuseColorConvert(const TestConfig& cfg)
+{
+	const int tolerance = 2;
+	size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * cfg.num_cameras * 2;
+	size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 2;
+	// camera content with gradients in luma and chroma, so that interpolation matters
+	std::vector<vx_uint8> camera(camera_size), output[2];
+	for (size_t y = 0; y < (size_t)cfg.camera_height * cfg.num_cameras; y++) {
+		vx_uint8 * row = camera.data() + y * cfg.camera_width * 2;
+		for (size_t x = 0; x < cfg.camera_width; x += 2) {
+			row[x * 2 + 0] = (vx_uint8)(64 + (x / 4) % 128);          // U
+			row[x * 2 + 1] = (vx_uint8)(16 + (x + y) % 220);          // Y0
+			row[x * 2 + 2] = (vx_uint8)(64 + (y / 4) % 128);          // V
+			row[x * 2 + 3] = (vx_uint8)(16 + (x + 1 + y) % 220);      // Y1
+		}
+	}
+	double frame_msec[2] = { 0, 0 };
+	for (int fuse = 0; fuse < 2; fuse++) {
+		TestAttr attrs[] = { { LIVE_STITCH_ATTR_EXPCOMP, 0.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 0.0f }, { LIVE_STITCH_ATTR_FUSE_COLOR_CONVERT, (vx_float32)fuse } };
+		ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + 3), VX_DF_IMAGE_UYVY, VX_DF_IMAGE_UYVY);
+		if (!stitch) return false;
+		output[fuse].resize(output_size);
+		ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera.data()));
+		ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output[fuse].data()));
+		double t0 = ClockMsec();
+		for (vx_uint32 frame = 0; frame < cfg.frames; frame++) {
+			ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+			ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		}
+		frame_msec[fuse] = (ClockMsec() - t0) / std::max(cfg.frames, 1u);
+		ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+	}
+	int max_diff = 0;
+	size_t diff_count = 0;
+	for (size_t i = 0; i < output_size; i++) {
+		int diff = abs((int)output[0][i] - (int)output[1][i]);
+		max_diff = std::max(max_diff, diff);
+		if (diff) diff_count++;
+	}
+	printf("fuse_color_convert: separate %.3f msec/frame, fused %.3f msec/frame: max diff %d, %.2f%% of bytes differ\n",
+		frame_msec[0], frame_msec[1], max_diff, 100.0 * diff_count / output_size);
+	if (max_diff > tolerance) {
+		printf("ERROR: fuse_color_convert: fused output differs by %d (tolerance %d)\n", max_diff, tolerance);
+		return false;
+	}
+	return true;
+}
+
+/***********************************************************************************************************************************
+expcomp_calc: run the exposure compensation error function kernel (com.amd.loomsl.expcomp_compute_gainmatrix) on synthetic overlaps of
+8 and 16 cameras with output-width x output-width/2 images, and check its A_matrix against a scalar reference for luma and RGB sums,
+with and without mask, and with sample strides 1 and 4. Each camera overlaps its neighbour in a 256 pixel wide strip of 128x32 blocks;
+pixels are pseudo-random, with invalid pixels and mask holes. Reports the kernel time for luma sums over the full overlap.
+Run with EXPCOMP_TARGET=1 to check the host kernel.
+************************************************************************************************************************************/
+//! \brief Same layout as StitchOverlapPixelEntry of vx_loomsl.
+struct ExpCompOverlapEntry {
+	vx_uint32 camId0 : 5, start_x : 14, start_y : 13;
+	vx_uint32 end_x : 7, end_y : 5, camId1 : 5, camId2 : 5, camId3 : 5, camId4 : 5;
+};
+
+static vx_uint32 ExpCompHash(vx_uint32 x, vx_uint32 y)
+{
+	vx_uint32 h = x * 0x9e3779b1u ^ y * 0x85ebca77u;
+	h ^= h >> 15; h *= 0x2c1b3c6du; h ^= h >> 12;
+	return h;
+}
+
+//! \brief Pixel of the stacked RGBX camera image: 1/16 of the pixels are invalid (0x80000000).
+static vx_uint32 ExpCompPixel(vx_uint32 x, vx_uint32 y)
+{
+	vx_uint32 h = ExpCompHash(x, y);
+	return (h & 15) ? (h & 0x7fffffff) : 0x80000000;
+}
+
+//! \brief Mask of the stacked camera image: 1/8 of the pixels are not set (bit 7 clear).
+static vx_uint8 ExpCompMask(vx_uint32 x, vx_uint32 y)
+{
+	return ((ExpCompHash(y, x) >> 8) & 7) ? 255 : 64;
+}
+
+//! \brief Scalar reference of the A_matrix sums of the error function kernel (8x2 cells, rows skipped by sample stride).
+static void ExpCompReference(const std::vector<ExpCompOverlapEntry>& entries, vx_uint32 num_cameras, vx_uint32 height_one,
+	vx_uint32 num_channels, bool mask, vx_uint32 sample_stride, std::vector<vx_uint32>& AMat)
+{
+	AMat.assign(num_channels * num_cameras * num_cameras, 0);
+	for (auto& e : entries) {
+		vx_uint32 sumI[3] = { 0, 0, 0 }, sumJ[3] = { 0, 0, 0 };
+		vx_uint32 width = ((e.end_x + 7) >> 3) << 3, height = ((e.end_y + 1) >> 1) << 1;
+		for (vx_uint32 y = 0; y < height; y++) {
+			if ((y >> 1) % sample_stride)
+				continue;
+			vx_uint32 yI = e.camId0 * height_one + e.start_y + y, yJ = e.camId1 * height_one + e.start_y + y;
+			for (vx_uint32 x = e.start_x; x < e.start_x + width; x++) {
+				vx_uint32 I = ExpCompPixel(x, yI), J = ExpCompPixel(x, yJ);
+				if (I == 0x80000000 || J == 0x80000000)
+					continue;
+				if (mask && !((ExpCompMask(x, yI) & ExpCompMask(x, yJ)) & 0x80))
+					continue;
+				for (vx_uint32 c = 0; c < num_channels; c++) {
+					vx_uint32 shift = (num_channels == 3) ? 8 * c : 24;
+					sumI[c] += (I >> shift) & 0xff;
+					sumJ[c] += (J >> shift) & 0xff;
+				}
+			}
+		}
+		for (vx_uint32 c = 0; c < num_channels; c++) {
+			AMat[(c * num_cameras + e.camId0) * num_cameras + e.camId1] += (sumI[c] * sample_stride) >> 4;
+			AMat[(c * num_cameras + e.camId1) * num_cameras + e.camId0] += (sumJ[c] * sample_stride) >> 4;
+		}
+	}
+}
+
+static bool TestExpCompCalc(const TestConfig& cfg)
+{
+	struct { vx_uint32 num_channels; bool mask; vx_uint32 sample_stride; } cases[] = {
+		{ 1, false, 1 }, { 1, true, 1 }, { 1, true, 4 }, { 3, false, 1 }, { 3, true, 4 },
+	};
+	const vx_uint32 rigs[] = { 8, 16 };
+	bool pass = true;
+	for (vx_uint32 num_cameras : rigs) {
+		vx_uint32 width = cfg.output_width, height_one = cfg.output_width / 2, height = height_one * num_cameras;
+		vx_context context = vxCreateContext();
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)context));
+		ERROR_CHECK_STATUS(vxLoadKernels(context, "vx_loomsl"));
+		vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_RGBX);
+		vx_image mask = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)input));
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)mask));
+		vx_rectangle_t rect = { 0, 0, width, height };
+		vx_imagepatch_addressing_t addr = { 0 };
+		vx_uint8 * ptr = nullptr;
+		ERROR_CHECK_STATUS(vxAccessImagePatch(input, &rect, 0, &addr, (void **)&ptr, VX_WRITE_ONLY));
+		for (vx_uint32 y = 0; y < height; y++)
+			for (vx_uint32 x = 0; x < width; x++)
+				((vx_uint32 *)(ptr + y * addr.stride_y))[x] = ExpCompPixel(x, y);
+		ERROR_CHECK_STATUS(vxCommitImagePatch(input, &rect, 0, &addr, ptr));
+		ptr = nullptr;
+		ERROR_CHECK_STATUS(vxAccessImagePatch(mask, &rect, 0, &addr, (void **)&ptr, VX_WRITE_ONLY));
+		for (vx_uint32 y = 0; y < height; y++)
+			for (vx_uint32 x = 0; x < width; x++)
+				ptr[y * addr.stride_y + x] = ExpCompMask(x, y);
+		ERROR_CHECK_STATUS(vxCommitImagePatch(mask, &rect, 0, &addr, ptr));
+
+		// camera i overlaps camera i+1 in a 256 pixel wide strip around x = (i+1)*width/num_cameras, the last block rows are partial
+		std::vector<ExpCompOverlapEntry> entries;
+		for (vx_uint32 i = 0; i < num_cameras; i++) {
+			vx_uint32 j = (i + 1) % num_cameras, x0 = std::min((i + 1) * width / num_cameras, width - 128) & ~7u;
+			x0 = x0 >= 128 ? x0 - 128 : 0;
+			for (vx_uint32 y = 0; y < height_one; y += 32) {
+				for (vx_uint32 x = x0; x < x0 + 256 && x + 8 <= width; x += 128) {
+					ExpCompOverlapEntry e = { 0 };
+					e.camId0 = std::min(i, j); e.camId1 = std::max(i, j); e.camId2 = e.camId3 = e.camId4 = 31;
+					e.start_x = x; e.start_y = y;
+					e.end_x = std::min(127u, width - 1 - x); e.end_y = std::min(31u, height_one - 1 - y);
+					entries.push_back(e);
+				}
+			}
+		}
+		vx_enum entry_type = vxRegisterUserStruct(context, sizeof(ExpCompOverlapEntry));
+		vx_array exp_data = vxCreateArray(context, entry_type, entries.size());
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)exp_data));
+		ERROR_CHECK_STATUS(vxAddArrayItems(exp_data, entries.size(), entries.data(), sizeof(ExpCompOverlapEntry)));
+		vx_scalar s_num_cameras = vxCreateScalar(context, VX_TYPE_UINT32, &num_cameras);
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)s_num_cameras));
+
+		for (auto& c : cases) {
+			vx_matrix mat = vxCreateMatrix(context, VX_TYPE_INT32, num_cameras, num_cameras * c.num_channels);
+			vx_scalar s_stride = vxCreateScalar(context, VX_TYPE_UINT32, &c.sample_stride);
+			vx_graph graph = vxCreateGraph(context);
+			vx_kernel kernel = vxGetKernelByName(context, "com.amd.loomsl.expcomp_compute_gainmatrix");
+			ERROR_CHECK_STATUS(vxGetStatus((vx_reference)mat));
+			ERROR_CHECK_STATUS(vxGetStatus((vx_reference)s_stride));
+			ERROR_CHECK_STATUS(vxGetStatus((vx_reference)graph));
+			ERROR_CHECK_STATUS(vxGetStatus((vx_reference)kernel));
+			vx_node node = vxCreateGenericNode(graph, kernel);
+			ERROR_CHECK_STATUS(vxGetStatus((vx_reference)node));
+			ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 0, (vx_reference)s_num_cameras));
+			ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 1, (vx_reference)input));
+			ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 2, (vx_reference)exp_data));
+			if (c.mask) ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 3, (vx_reference)mask));
+			ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 4, (vx_reference)mat));
+			ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 8, (vx_reference)s_stride));
+			ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+			std::vector<vx_uint32> AMat(num_cameras * num_cameras * c.num_channels, 0), ref;
+			ERROR_CHECK_STATUS(vxWriteMatrix(mat, AMat.data()));
+			ERROR_CHECK_STATUS(vxProcessGraph(graph));
+			ERROR_CHECK_STATUS(vxReadMatrix(mat, AMat.data()));
+			ExpCompReference(entries, num_cameras, height_one, c.num_channels, c.mask, c.sample_stride, ref);
+			size_t mismatch = 0;
+			for (size_t i = 0; i < ref.size(); i++)
+				if (AMat[i] != ref[i]) mismatch++;
+			double msec = 0;
+			if (!mismatch) {
+				double t0 = ClockMsec();
+				for (vx_uint32 frame = 0; frame < cfg.frames; frame++)
+					ERROR_CHECK_STATUS(vxProcessGraph(graph));
+				msec = (ClockMsec() - t0) / cfg.frames;
+			}
+			printf("expcomp_calc: %d cameras, %d blocks, %s sums, %s mask, sample stride %d: %s, %.3f msec\n", num_cameras, (int)entries.size(),
+				c.num_channels == 3 ? "RGB" : "luma", c.mask ? "with" : "no", c.sample_stride, mismatch ? "MISMATCH" : "match", msec);
+			if (mismatch) {
+				printf("ERROR: expcomp_calc: %d of %d A_matrix sums differ from the reference\n", (int)mismatch, (int)ref.size());
+				pass = false;
+			}
+			ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+			ERROR_CHECK_STATUS(vxReleaseNode(&node));
+			ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+			ERROR_CHECK_STATUS(vxReleaseScalar(&s_stride));
+			ERROR_CHECK_STATUS(vxReleaseMatrix(&mat));
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_cameras));
+		ERROR_CHECK_STATUS(vxReleaseArray(&exp_data));
+		ERROR_CHECK_STATUS(vxReleaseImage(&mask));
+		ERROR_CHECK_STATUS(vxReleaseImage(&input));
+		ERROR_CHECK_STATUS(vxReleaseContext(&context));
+	}
+	return pass;
+}
+
+/***********************************************************************************************************************************
+expcomp_sample_stride: compute the exposure compensation gains with LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE 1, 2, 4 and 8, and compare the
+gains of each stride with the gains of stride 1. The cameras have different brightness and a texture that changes from row to row, so
+that skipped rows matter. Strides up to 4 must stay within 0.2% of stride 1; the error of stride 8 is only reported.
+************************************************************************************************************************************/
+static bool TestExpCompSampleStride(const TestConfig& cfg)
+{
+	const vx_uint32 strides[] = { 1, 2, 4, 8 };
+	const vx_float32 tolerance = 0.002f;
+	const vx_uint32 frames = std::min(cfg.frames, 3u);
+	size_t camera_size = (size_t)cfg.camera_width * cfg.camera_height * 3;
+	size_t output_size = (size_t)cfg.output_width * (cfg.output_width / 2) * 3;
+	std::vector<vx_uint8> camera(camera_size * cfg.num_cameras), output(output_size);
+	for (vx_uint32 i = 0; i < cfg.num_cameras; i++) {
+		vx_uint32 base = 60 + (35 * i) % 150;
+		for (size_t y = 0; y < cfg.camera_height; y++) {
+			vx_uint8 * row = camera.data() + camera_size * i + y * cfg.camera_width * 3;
+			for (size_t x = 0; x < cfg.camera_width; x++) {
+				vx_uint8 value = (vx_uint8)(base + (x / 5 + y / 3 + 11 * i) % 48);
+				row[x * 3 + 0] = row[x * 3 + 1] = row[x * 3 + 2] = value;
+			}
+		}
+	}
+	std::vector<vx_float32> gains[sizeof(strides) / sizeof(strides[0])];
+	bool pass = true;
+	for (size_t k = 0; k < sizeof(strides) / sizeof(strides[0]); k++) {
+		TestAttr attrs[] = {
+			{ LIVE_STITCH_ATTR_EXPCOMP, 1.0f }, { LIVE_STITCH_ATTR_SEAMFIND, 0.0f }, { LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE, (vx_float32)strides[k] },
+		};
+		ls_context stitch = CreateRig(cfg, std::vector<TestAttr>(attrs, attrs + sizeof(attrs) / sizeof(attrs[0])));
+		if (!stitch) return false;
+		ERROR_CHECK_STATUS(lsSetCameraBufferHost(stitch, camera.data()));
+		ERROR_CHECK_STATUS(lsSetOutputBufferHost(stitch, output.data()));
+		double t0 = ClockMsec();
+		for (vx_uint32 frame = 0; frame < frames; frame++) {
+			ERROR_CHECK_STATUS(lsScheduleFrame(stitch));
+			ERROR_CHECK_STATUS(lsWaitForCompletion(stitch));
+		}
+		double msec = (ClockMsec() - t0) / frames;
+		gains[k].resize(cfg.num_cameras);
+		ERROR_CHECK_STATUS(lsGetExposureCompGains(stitch, cfg.num_cameras, gains[k].data()));
+		ERROR_CHECK_STATUS(lsReleaseContext(&stitch));
+		vx_float32 max_error = 0.0f;
+		for (vx_uint32 i = 0; i < cfg.num_cameras; i++)
+			max_error = std::max(max_error, fabsf(gains[k][i] - gains[0][i]) / std::max(fabsf(gains[0][i]), 1e-6f));
+		printf("expcomp_sample_stride: stride %d: %.3f msec/frame, max gain error %.4f%%, gains:", strides[k], msec, 100.0f * max_error);
+		for (auto g : gains[k]) printf(" %.4f", g);
+		printf("\n");
+		if (strides[k] <= 4 && max_error > tolerance) {
+			printf("ERROR: expcomp_sample_stride: stride %d changes the gains by %.4f%% (tolerance %.2f%%)\n", strides[k], 100.0f * max_error, 100.0f * tolerance);
+			pass = false;
+		}
+	}
+	return pass;
+}
+
+/***********************************************************************************************************************************
+expcomp_rgb_gains: compute per-channel exposure compensation gains of a synthetic equirectangular image with the error function and
+solve kernels (com.amd.loomsl.expcomp_compute_gainmatrix and com.amd.loomsl.expcomp_solvegains), and with the C reference model
+(com.amd.loomsl.exposure_compensation_model with 3 gain channels), and compare. Camera i covers a vertical band of the output that
+overlaps camera i+1 by 256 pixels, with an R, G, B tint that differs per camera plus a small texture. The model gains are recovered
+from its output image. The gains must agree within 2%, and must differ between channels.
+Run with EXPCOMP_TARGET=1 to check the host error function kernel.
+************************************************************************************************************************************/
+static vx_uint32 ExpCompTintPixel(vx_uint32 cam, vx_uint32 x, vx_uint32 y)
+{
+	vx_uint32 tex = (x * 3 + y * 5 + cam * 7) % 24;
+	vx_uint32 r = 60 + (20 * cam) % 80 + tex, g = 90 + (10 * cam) % 40 + tex, b = 140 - (20 * cam) % 80 + tex;
+	return r | (g << 8) | (b << 16) | (((r + g + b) / 3) << 24);
+}
+
+static bool TestExpCompRgbGains(const TestConfig& cfg)
+{
+	const vx_float32 alpha = 0.01f, beta = 100.0f, tolerance = 0.02f;
+	const vx_uint32 overlap = 256;
+	vx_uint32 num_cameras = cfg.num_cameras, width = cfg.output_width, height_one = (cfg.output_width / 2) & ~1u, height = height_one * num_cameras;
+	vx_uint32 step = (width / num_cameras) & ~127u;
+	if (step < overlap) {
+		printf("ERROR: expcomp_rgb_gains: output width %d is too small for %d cameras\n", width, num_cameras);
+		return false;
+	}
+	// camera i is valid in [i*step, (i+1)*step + overlap), the last camera up to the right edge
+	std::vector<vx_rectangle_t> valid(num_cameras);
+	for (vx_uint32 i = 0; i < num_cameras; i++) {
+		valid[i].start_x = i * step; valid[i].end_x = (i + 1 < num_cameras) ? (i + 1) * step + overlap : width;
+		valid[i].start_y = 0; valid[i].end_y = height_one;
+	}
+	vx_context context = vxCreateContext();
+	ERROR_CHECK_STATUS(vxGetStatus((vx_reference)context));
+	ERROR_CHECK_STATUS(vxLoadKernels(context, "vx_loomsl"));
+	vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_RGBX);
+	vx_image output = vxCreateImage(context, width, height, VX_DF_IMAGE_RGBX);
+	ERROR_CHECK_STATUS(vxGetStatus((vx_reference)input));
+	ERROR_CHECK_STATUS(vxGetStatus((vx_reference)output));
+	vx_rectangle_t rect = { 0, 0, width, height };
+	vx_imagepatch_addressing_t addr = { 0 };
+	vx_uint8 * ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input, &rect, 0, &addr, (void **)&ptr, VX_WRITE_ONLY));
+	for (vx_uint32 i = 0; i < num_cameras; i++) {
+		for (vx_uint32 y = 0; y < height_one; y++) {
+			vx_uint32 * row = (vx_uint32 *)(ptr + (i * height_one + y) * addr.stride_y);
+			for (vx_uint32 x = 0; x < width; x++)
+				row[x] = (x >= valid[i].start_x && x < valid[i].end_x) ? ExpCompTintPixel(i, x, y) : 0x80000000;
+		}
+	}
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input, &rect, 0, &addr, ptr));
+
+	// error function and solve kernels: 128x32 blocks over the overlap of each camera pair, and overlap pixel counts
+	std::vector<ExpCompOverlapEntry> entries;
+	std::vector<vx_int32> counts(num_cameras * num_cameras, 0);
+	for (vx_uint32 i = 0; i + 1 < num_cameras; i++) {
+		for (vx_uint32 y = 0; y < height_one; y += 32) {
+			for (vx_uint32 x = valid[i + 1].start_x; x < valid[i + 1].start_x + overlap; x += 128) {
+				ExpCompOverlapEntry e = { 0 };
+				e.camId0 = i; e.camId1 = i + 1; e.camId2 = e.camId3 = e.camId4 = 31;
+				e.start_x = x; e.start_y = y; e.end_x = 127; e.end_y = std::min(31u, height_one - 1 - y);
+				entries.push_back(e);
+			}
+		}
+		counts[i * num_cameras + i + 1] = counts[(i + 1) * num_cameras + i] = overlap * height_one;
+	}
+	vx_array exp_data = vxCreateArray(context, vxRegisterUserStruct(context, sizeof(ExpCompOverlapEntry)), entries.size());
+	vx_matrix A_matrix = vxCreateMatrix(context, VX_TYPE_INT32, num_cameras, num_cameras * 3);
+	vx_matrix count_matrix = vxCreateMatrix(context, VX_TYPE_INT32, num_cameras, num_cameras);
+	vx_array gain_array = vxCreateArray(context, VX_TYPE_FLOAT32, num_cameras * 3);
+	vx_array valid_array = vxCreateArray(context, VX_TYPE_RECTANGLE, num_cameras);
+	vx_uint32 num_channels = 3;
+	vx_scalar s_num_cameras = vxCreateScalar(context, VX_TYPE_UINT32, &num_cameras);
+	vx_scalar s_num_channels = vxCreateScalar(context, VX_TYPE_UINT32, &num_channels);
+	vx_scalar s_alpha = vxCreateScalar(context, VX_TYPE_FLOAT32, &alpha);
+	vx_scalar s_beta = vxCreateScalar(context, VX_TYPE_FLOAT32, &beta);
+	vx_reference refs[] = {
+		(vx_reference)exp_data, (vx_reference)A_matrix, (vx_reference)count_matrix, (vx_reference)gain_array, (vx_reference)valid_array,
+		(vx_reference)s_num_cameras, (vx_reference)s_num_channels, (vx_reference)s_alpha, (vx_reference)s_beta,
+	};
+	for (auto ref : refs) ERROR_CHECK_STATUS(vxGetStatus(ref));
+	ERROR_CHECK_STATUS(vxAddArrayItems(exp_data, entries.size(), entries.data(), sizeof(ExpCompOverlapEntry)));
+	ERROR_CHECK_STATUS(vxAddArrayItems(valid_array, num_cameras, valid.data(), sizeof(vx_rectangle_t)));
+	ERROR_CHECK_STATUS(vxWriteMatrix(count_matrix, counts.data()));
+	std::vector<vx_int32> zero(num_cameras * num_cameras * 3, 0);
+	ERROR_CHECK_STATUS(vxWriteMatrix(A_matrix, zero.data()));
+
+	struct { const char * name; vx_reference params[7]; vx_uint32 num; } nodes[] = {
+		{ "com.amd.loomsl.expcomp_compute_gainmatrix", { (vx_reference)s_num_cameras, (vx_reference)input, (vx_reference)exp_data, nullptr, (vx_reference)A_matrix }, 5 },
+		{ "com.amd.loomsl.expcomp_solvegains", { (vx_reference)s_alpha, (vx_reference)s_beta, (vx_reference)A_matrix, (vx_reference)count_matrix, (vx_reference)gain_array }, 5 },
+		{ "com.amd.loomsl.exposure_compensation_model", { (vx_reference)s_alpha, (vx_reference)s_beta, (vx_reference)valid_array, (vx_reference)input, (vx_reference)output,
+			nullptr, (vx_reference)s_num_channels }, 7 },
+	};
+	vx_graph graph = vxCreateGraph(context);
+	ERROR_CHECK_STATUS(vxGetStatus((vx_reference)graph));
+	for (auto& n : nodes) {
+		vx_kernel kernel = vxGetKernelByName(context, n.name);
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)kernel));
+		vx_node node = vxCreateGenericNode(graph, kernel);
+		ERROR_CHECK_STATUS(vxGetStatus((vx_reference)node));
+		for (vx_uint32 k = 0; k < n.num; k++) {
+			if (n.params[k]) ERROR_CHECK_STATUS(vxSetParameterByIndex(node, k, n.params[k]));
+		}
+		ERROR_CHECK_STATUS(vxReleaseNode(&node));
+		ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+	}
+	ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+	ERROR_CHECK_STATUS(vxProcessGraph(graph));
+
+	// gains of the kernels, and gains of the model from the ratio of its output and input (rounded down, and not saturated)
+	std::vector<vx_float32> gains(num_cameras * 3), model(num_cameras * 3);
+	vx_size stride = 0;
+	vx_float32 * gain_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(gain_array, 0, num_cameras * 3, &stride, (void **)&gain_ptr, VX_READ_ONLY));
+	for (vx_uint32 k = 0; k < num_cameras * 3; k++)
+		gains[k] = *(vx_float32 *)((vx_uint8 *)gain_ptr + k * stride);
+	ERROR_CHECK_STATUS(vxCommitArrayRange(gain_array, 0, num_cameras * 3, gain_ptr));
+	ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output, &rect, 0, &addr, (void **)&ptr, VX_READ_ONLY));
+	for (vx_uint32 i = 0; i < num_cameras; i++) {
+		double sum_in[3] = { 0, 0, 0 }, sum_out[3] = { 0, 0, 0 };
+		for (vx_uint32 y = 0; y < height_one; y++) {
+			const vx_uint32 * row = (const vx_uint32 *)(ptr + (i * height_one + y) * addr.stride_y);
+			for (vx_uint32 x = valid[i].start_x; x < valid[i].end_x; x++) {
+				vx_uint32 in = ExpCompTintPixel(i, x, y);
+				for (vx_uint32 c = 0; c < 3; c++) {
+					vx_uint32 out = (row[x] >> (8 * c)) & 0xff;
+					if (out == 255) continue;
+					sum_in[c] += (in >> (8 * c)) & 0xff;
+					sum_out[c] += out + 0.5;
+				}
+			}
+		}
+		for (vx_uint32 c = 0; c < 3; c++)
+			model[c * num_cameras + i] = sum_in[c] > 0 ? (vx_float32)(sum_out[c] / sum_in[c]) : 0.0f;
+	}
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output, &rect, 0, &addr, ptr));
+
+	bool pass = true;
+	vx_float32 max_error = 0.0f, max_spread = 0.0f;
+	for (vx_uint32 i = 0; i < num_cameras; i++) {
+		printf("expcomp_rgb_gains: camera %d: kernels R %.4f G %.4f B %.4f, model R %.4f G %.4f B %.4f\n", i,
+			gains[i], gains[num_cameras + i], gains[2 * num_cameras + i], model[i], model[num_cameras + i], model[2 * num_cameras + i]);
+		vx_float32 lo = gains[i], hi = gains[i];
+		for (vx_uint32 c = 0; c < 3; c++) {
+			vx_float32 g = gains[c * num_cameras + i], m = model[c * num_cameras + i];
+			max_error = std::max(max_error, fabsf(g - m) / std::max(fabsf(m), 1e-6f));
+			lo = std::min(lo, g); hi = std::max(hi, g);
+		}
+		max_spread = std::max(max_spread, hi - lo);
+	}
+	printf("expcomp_rgb_gains: %d cameras: max difference from model %.3f%%, max spread of channel gains %.4f\n", num_cameras, 100.0f * max_error, max_spread);
+	if (max_error > tolerance) {
+		printf("ERROR: expcomp_rgb_gains: kernel gains differ from the model by %.3f%% (tolerance %.1f%%)\n", 100.0f * max_error, 100.0f * tolerance);
+		pass = false;
+	}
+	if (max_spread < 0.01f) {
+		printf("ERROR: expcomp_rgb_gains: the R, G, B gains of each camera are the same for tinted cameras\n");
+		pass = false;
+	}
+	ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+	ERROR_CHECK_STATUS(vxReleaseScalar(&s_beta));
+	ERROR_CHECK_STATUS(vxReleaseScalar(&s_alpha));
+	ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_channels));
+	ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_cameras));
+	ERROR_CHECK_STATUS(vxReleaseArray(&valid_array));
+	ERROR_CHECK_STATUS(vxReleaseArray(&gain_array));
+	ERROR_CHECK_STATUS(vxReleaseMatrix(&count_matrix));
+	ERROR_CHECK_STATUS(vxReleaseMatrix(&A_matrix));
+	ERROR_CHECK_STATUS(vxReleaseArray(&exp_data));
+	ERROR_CHECK_STATUS(vxReleaseImage(&output));
+	ERROR_CHECK_STATUS(vxReleaseImage(&input));
+	ERROR_CHECK_STATUS(vxReleaseContext(&context));
+	return pass;
+}
+
+/***********************************************************************************************************************************
+List of tests
+************************************************************************************************************************************/
+struct TestEntry {
+	const char * name;
+	std::function<bool(const TestConfig&)> run;
+};
+
+static const TestEntry g_tests[] = {
+	{ "host_roundtrip", TestHostRoundtrip },
+	{ "buffer_ring", TestBufferRing },
+	{ "expcomp_interval", TestExpCompInterval },
+	{ "seamfind_schedule", TestSeamFindSchedule },
+	{ "fuse_color_convert", TestFuseColorConvert },
+	{ "expcomp_calc", TestExpCompCalc },
+	{ "expcomp_sample_stride", TestExpCompSampleStride },
+	{ "expcomp_rgb_gains", TestExpCompRgbGains },
+};
+
+int main(int argc, char * argv[])
+{
+	TestConfig cfg = { 4, 1920, 1080, 3840, 100 };
+	const char * filter = nullptr;
+	for (int arg = 1; arg < argc; arg++) {
+		if (!strcmp(argv[arg], "-t") && arg + 1 < argc) {
+			filter = argv[++arg];
+		}
+		else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+			cfg.frames = (vx_uint32)std::max(1, atoi(argv[++arg]));
+		}
+		else if (!strcmp(argv[arg], "-c") && arg + 1 < argc) {
+			cfg.num_cameras = (vx_uint32)std::max(2, atoi(argv[++arg]));
+		}
+		else if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+			if (sscanf(argv[++arg], "%ux%u", &cfg.camera_width, &cfg.camera_height) != 2) {
+				printf("ERROR: invalid camera resolution: %s\n", argv[arg]);
+				return -1;
+			}
+		}
+		else if (!strcmp(argv[arg], "-o") && arg + 1 < argc) {
+			cfg.output_width = (vx_uint32)atoi(argv[++arg]);
+		}
+		else {
+			printf("Usage: loom_test [-t test] [-n frames] [-c cameras] [-r camera-WxH] [-o output-width]\n");
+			printf("Tests:");
+			for (auto& t : g_tests) printf(" %s", t.name);
+			printf("\n");
+			return -1;
+		}
+	}
+
+	lsGlobalSetLogCallback(stitch_log_callback);
+	if (lsGlobalGetAttributes(0, LIVE_STITCH_ATTR_MAX_COUNT, g_default_attr) != VX_SUCCESS) {
+		printf("ERROR: unable to get the default attributes\n");
+		return -1;
+	}
+
+	int failures = 0;
+	for (auto& t : g_tests) {
+		if (filter && strcmp(filter, t.name))
+			continue;
+		bool pass = t.run(cfg);
+		printf("%s: %s\n", t.name, pass ? "PASS" : "FAIL");
+		if (!pass)
+			failures++;
+	}
+	lsGlobalSetAttributes(0, LIVE_STITCH_ATTR_MAX_COUNT, g_default_attr);
+
+	printf("%d test(s) failed\n", failures);
+	return failures ? 1 : 0;
+}
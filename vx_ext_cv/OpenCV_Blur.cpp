@@ -43,7 +43,7 @@ static vx_status VX_CALLBACK CV_Blur_InputValidator(vx_node node, vx_uint32 inde
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -54,7 +54,7 @@ static vx_status VX_CALLBACK CV_Blur_InputValidator(vx_node node, vx_uint32 inde
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -142,8 +142,10 @@ static vx_status VX_CALLBACK CV_Blur_OutputValidator(vx_node node, vx_uint32 ind
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
 
-		if (format != VX_DF_IMAGE_U8)
+		if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_U16 && format != VX_DF_IMAGE_S16 && format != VX_DF_IMAGE_F32_AMD && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
+		else
+			status = match_vx_image_formats(node, 0, 1, true);
 
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
@@ -47,10 +47,18 @@ using namespace std;
 #define PARAM_ERROR_CHECK(call){vx_status status = call; if(status!= VX_SUCCESS) goto exit;}
 #define MAX_KERNELS 100
 
+// 32-bit float image format as defined by the AMD OpenVX extension (vx_ext_amd.h)
+#ifndef VX_DF_IMAGE_F32_AMD
+#define VX_DF_IMAGE_F32_AMD VX_DF_IMAGE('F', '0', '3', '2')
+#endif
+
+int VX_to_CV_Format(vx_df_image);
 int VX_to_CV_Image(Mat**, vx_image);
 int VX_to_CV_MATRIX(Mat**, vx_matrix);
 
-int CV_to_VX_Pyramid(vx_pyramid, vector<Mat>);
+int VX_Access_CV_Image(Mat*, vx_image, vx_rectangle_t*, vx_imagepatch_addressing_t*, void**, vx_enum);
+
+int CV_to_VX_Pyramid(vx_pyramid, const vector<Mat>&, int step = 1);
 int CV_to_VX_Image(vx_image, Mat*);
 
 int CV_to_VX_keypoints(vector<KeyPoint>, vx_array);
@@ -58,6 +66,23 @@ int CVPoints2f_to_VX_keypoints(vector<Point2f>, vx_array);
 int CV_DESP_to_VX_DESP(Mat, vx_array, int);
 
 int match_vx_image_parameters(vx_image, vx_image);
+int match_vx_image_formats(vx_node, vx_uint32, vx_uint32, bool);
+int match_vx_image_dtype(vx_node, vx_uint32, vx_uint32, vx_uint32);
+int VX_to_CV_Rects(vector<Rect>&, vx_array, vx_image);
+
+// stand-alone Mat header of a tile: OpenCV does not treat it as a sub-matrix, so borders never reach outside the tile
+inline Mat CV_Tile(const Mat& mat, const Rect& rect) { return Mat(rect.height, rect.width, mat.type(), (void *)mat.ptr(rect.y, rect.x), mat.step); }
+
+// runs an OpenCV operation on each tile of a batch using the OpenCV thread pool
+class CV_Batch_Invoker : public ParallelLoopBody
+{
+public:
+	CV_Batch_Invoker(const vector<Rect>& rects, std::function<void(const Rect&)> op) : rects(rects), op(op) {}
+	void operator()(const Range& range) const { for (int i = range.start; i < range.end; i++) op(rects[i]); }
+private:
+	const vector<Rect>& rects;
+	std::function<void(const Rect&)> op;
+};
 
 class Kernellist
 {
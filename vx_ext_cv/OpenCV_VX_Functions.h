@@ -729,6 +729,72 @@ extern "C" {
 	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
 	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_Sobel(vx_graph graph, vx_image input, vx_image output, vx_int32 ddepth, vx_int32  dx, vx_int32 dy, vx_int32 Ksize, vx_float32 scale, vx_float32 delta, vx_int32 bordertype);
 
+	/*! \brief [Graph] Creates a batched OpenCV blur function node that filters every rectangle of rois as a stand-alone tile.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input The input image in <tt>\ref VX_DF_IMAGE_U8</tt> or <tt>\ref VX_DF_IMAGE_S16</tt> or <tt>\ref VX_DF_IMAGE_U16</tt> format.
+	* \param [out] output The output image is as same size and type of input; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \param [in] kwidth The input <tt>\ref VX_TYPE_UINT32</tt> scalar to set blur filter width.
+	* \param [in] kheight The input <tt>\ref VX_TYPE_UINT32</tt> scalar to set blur filter height.
+	* \param [in] Bordertype The input <tt>\ref VX_TYPE_INT32</tt> scalar to set border type.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_blur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 kwidth, vx_uint32 kheight, vx_int32 Bordertype);
+
+	/*! \brief [Graph] Creates a batched OpenCV GaussianBlur function node that filters every rectangle of rois as a stand-alone tile.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input The input image in <tt>\ref VX_DF_IMAGE_U8</tt> or <tt>\ref VX_DF_IMAGE_S16</tt> or <tt>\ref VX_DF_IMAGE_U16</tt> format.
+	* \param [out] output The output image is as same size and type of input; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \param [in] kwidth The input <tt>\ref VX_TYPE_UINT32</tt> scalar to set gaussian filter width.
+	* \param [in] kheight The input <tt>\ref VX_TYPE_UINT32</tt> scalar to set gaussian filter height.
+	* \param [in] sigmaX The input <tt>\ref VX_TYPE_FLOAT32</tt> scalar to set gaussian filter standard deviation in x-direction.
+	* \param [in] sigmaY The input <tt>\ref VX_TYPE_FLOAT32</tt> scalar to set gaussian filter standard deviation in y-direction.
+	* \param [in] border_mode The input <tt>\ref VX_TYPE_INT32</tt> scalar to set border mode.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_GaussianBlur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 kwidth, vx_uint32 kheight, vx_float32 sigmaX, vx_float32 sigmaY, vx_int32 border_mode);
+
+	/*! \brief [Graph] Creates a batched OpenCV medianBlur function node that filters every rectangle of rois as a stand-alone tile.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input The input image in <tt>\ref VX_DF_IMAGE_U8</tt> or <tt>\ref VX_DF_IMAGE_U16</tt> format.
+	* \param [out] output The output image is as same size and type of input; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \param [in] ksize The input <tt>\ref VX_TYPE_UINT32</tt> scalar to set the aperture linear size.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_medianBlur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 ksize);
+
+	/*! \brief [Graph] Creates a batched OpenCV add function node that adds every rectangle of rois.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input_1 The first input image.
+	* \param [in] input_2 The second input image is as same size and type of input_1.
+	* \param [out] output The output image is as same size and type of input_1; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_add_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois);
+
+	/*! \brief [Graph] Creates a batched OpenCV subtract function node that subtracts every rectangle of rois.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input_1 The first input image.
+	* \param [in] input_2 The second input image is as same size and type of input_1.
+	* \param [out] output The output image is as same size and type of input_1; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_subtract_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois);
+
+	/*! \brief [Graph] Creates a batched OpenCV absdiff function node that computes every rectangle of rois.
+	* \param [in] graph The reference to the graph.
+	* \param [in] input_1 The first input image.
+	* \param [in] input_2 The second input image is as same size and type of input_1.
+	* \param [out] output The output image is as same size and type of input_1; pixels outside rois are left untouched.
+	* \param [in] rois The input <tt>\ref vx_array</tt> of <tt>\ref VX_TYPE_RECTANGLE</tt> tiles.
+	* \return <tt>\ref vx_node</tt>.
+	* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>*/
+	VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_absdiff_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois);
+
 
 #ifdef __cplusplus
 }
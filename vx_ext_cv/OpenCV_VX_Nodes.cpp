@@ -1635,4 +1635,141 @@ VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_buildOpticalFlowPyramid(vx_graph gr
 		params,
 		dimof(params));
 
-}
\ No newline at end of file
+}
+/************************************************************************************************************
+OpenCV blur batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_blur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 kwidth, vx_uint32 kheight, vx_int32 Bordertype)
+{
+
+	vx_scalar KWIDTH = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &kwidth);
+	vx_scalar KHEIGHT = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &kheight);
+	vx_scalar BORDER = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &Bordertype);
+
+	vx_reference params[] = {
+		(vx_reference)input,
+		(vx_reference)output,
+		(vx_reference)rois,
+		(vx_reference)KWIDTH,
+		(vx_reference)KHEIGHT,
+		(vx_reference)BORDER,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_BLUR_BATCH,
+		params,
+		dimof(params));
+
+}
+
+/************************************************************************************************************
+OpenCV GaussianBlur batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_GaussianBlur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 kwidth, vx_uint32 kheight, vx_float32 sigmaX, vx_float32 sigmaY, vx_int32 border_mode)
+{
+
+	vx_scalar KWIDTH = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &kwidth);
+	vx_scalar KHEIGHT = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &kheight);
+	vx_scalar SIGMAX = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_FLOAT32, &sigmaX);
+	vx_scalar SIGMAY = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_FLOAT32, &sigmaY);
+	vx_scalar BORDER = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &border_mode);
+
+	vx_reference params[] = {
+		(vx_reference)input,
+		(vx_reference)output,
+		(vx_reference)rois,
+		(vx_reference)KWIDTH,
+		(vx_reference)KHEIGHT,
+		(vx_reference)SIGMAX,
+		(vx_reference)SIGMAY,
+		(vx_reference)BORDER,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_GAUSSIAN_BLUR_BATCH,
+		params,
+		dimof(params));
+
+}
+
+/************************************************************************************************************
+OpenCV MedianBlur batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_medianBlur_batch(vx_graph graph, vx_image input, vx_image output, vx_array rois, vx_uint32 ksize)
+{
+
+	vx_scalar KSIZE = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_INT32, &ksize);
+
+	vx_reference params[] = {
+		(vx_reference)input,
+		(vx_reference)output,
+		(vx_reference)rois,
+		(vx_reference)KSIZE,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_MEDIAN_BLUR_BATCH,
+		params,
+		dimof(params));
+
+}
+
+/************************************************************************************************************
+OpenCV add batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_add_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois)
+{
+
+	vx_reference params[] = {
+		(vx_reference)input_1,
+		(vx_reference)input_2,
+		(vx_reference)output,
+		(vx_reference)rois,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_ADD_BATCH,
+		params,
+		dimof(params));
+
+}
+
+/************************************************************************************************************
+OpenCV subtract batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_subtract_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois)
+{
+
+	vx_reference params[] = {
+		(vx_reference)input_1,
+		(vx_reference)input_2,
+		(vx_reference)output,
+		(vx_reference)rois,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_SUBTRACT_BATCH,
+		params,
+		dimof(params));
+
+}
+
+/************************************************************************************************************
+OpenCV absdiff batch C Function
+*************************************************************************************************************/
+VX_API_ENTRY vx_node VX_API_CALL vxExtCvNode_absdiff_batch(vx_graph graph, vx_image input_1, vx_image input_2, vx_image output, vx_array rois)
+{
+
+	vx_reference params[] = {
+		(vx_reference)input_1,
+		(vx_reference)input_2,
+		(vx_reference)output,
+		(vx_reference)rois,
+	};
+
+	return vxCreateNodeByStructure(graph,
+		VX_KERNEL_EXT_CV_ABSDIFF_BATCH,
+		params,
+		dimof(params));
+
+}
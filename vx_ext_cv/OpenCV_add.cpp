@@ -39,7 +39,7 @@ vx_status VX_CALLBACK CV_add_InputValidator(vx_node node, vx_uint32 index)
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_S16)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_S32 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -49,8 +49,10 @@ vx_status VX_CALLBACK CV_add_InputValidator(vx_node node, vx_uint32 index)
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_S16)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_S32 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
+		else
+			status = match_vx_image_formats(node, 0, 1, true);
 		vxReleaseImage(&image);
 	}
 	else if (index == 2)
@@ -59,7 +61,7 @@ vx_status VX_CALLBACK CV_add_InputValidator(vx_node node, vx_uint32 index)
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_S16)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_S32 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -84,8 +86,10 @@ vx_status VX_CALLBACK CV_add_OutputValidator(vx_node node, vx_uint32 index, vx_m
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
 
-		if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_S16)
+		if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_U16 && format != VX_DF_IMAGE_S16 && format != VX_DF_IMAGE_S32 && format != VX_DF_IMAGE_F32_AMD && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_RGBX)
 			status = VX_ERROR_INVALID_VALUE;
+		else
+			status = match_vx_image_formats(node, 0, 2, false);
 
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
@@ -110,15 +114,17 @@ vx_status VX_CALLBACK CV_add_Kernel(vx_node node, const vx_reference *parameters
 
 	Mat *mat_1, *mat_2, bl;
 	vx_int32 value = 0;
+	vx_df_image format = VX_DF_IMAGE_VIRT;
 	
 	//Converting VX Image to OpenCV Mat 1
 	STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_2));
 	STATUS_ERROR_CHECK(match_vx_image_parameters(image_1, image_out));
+	STATUS_ERROR_CHECK(vxQueryImage(image_out, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
 	STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_1, image_1));
 	STATUS_ERROR_CHECK(VX_to_CV_Image(&mat_2, image_2));
 
 	//Compute using OpenCV
-	cv::add(*mat_1, *mat_2, bl);
+	cv::add(*mat_1, *mat_2, bl, noArray(), CV_MAT_DEPTH(VX_to_CV_Format(format)));
 	
 	//Converting OpenCV Mat into VX Image	
 	STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
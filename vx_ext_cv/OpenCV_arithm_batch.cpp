@@ -0,0 +1,200 @@
+/* 
+Copyright (c) 2015 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include"publishkernels.h"
+
+/************************************************************************************************************
+Batched per-element arithmetic: one node combines every rectangle of a vx_array of VX_TYPE_RECTANGLE.
+Tiles are processed in parallel on the OpenCV thread pool (see cv::setNumThreads) and pixels outside the
+rectangles are left untouched in the output image. Inputs and output share size and format, and overlapping
+rectangles fail the execution (VX_to_CV_Rects).
+*************************************************************************************************************/
+
+/************************************************************************************************************
+input parameter validator shared by the batched arithmetic kernels: input1, input2, output, rois
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_arithm_batch_InputValidator(vx_node node, vx_uint32 index)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param = vxGetParameterByIndex(node, index);
+
+	if (index == 0 || index == 1)
+	{
+		vx_image image;
+		vx_df_image df_image = VX_DF_IMAGE_VIRT;
+		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
+		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_S32 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
+			status = VX_ERROR_INVALID_VALUE;
+		else if (index == 1)
+			status = match_vx_image_formats(node, 0, 1, true);
+		vxReleaseImage(&image);
+	}
+
+	else if (index == 3)
+	{
+		vx_array array; vx_enum type = 0;
+		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &array, sizeof(vx_array)));
+		STATUS_ERROR_CHECK(vxQueryArray(array, VX_ARRAY_ATTRIBUTE_ITEMTYPE, &type, sizeof(type)));
+		if (type != VX_TYPE_RECTANGLE)
+			status = VX_ERROR_INVALID_TYPE;
+		vxReleaseArray(&array);
+	}
+
+	vxReleaseParameter(&param);
+	return status;
+}
+
+/************************************************************************************************************
+output parameter validator: the output image has the size and format of the first input image.
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_arithm_batch_OutputValidator(vx_node node, vx_uint32 index, vx_meta_format meta)
+{
+	vx_status status = VX_SUCCESS;
+	if (index == 2)
+	{
+		vx_parameter input_param = vxGetParameterByIndex(node, 0);
+		vx_image input; vx_uint32 width = 0, height = 0; vx_df_image format = VX_DF_IMAGE_VIRT;
+
+		STATUS_ERROR_CHECK(vxQueryParameter(input_param, VX_PARAMETER_ATTRIBUTE_REF, &input, sizeof(vx_image)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+
+		vxReleaseImage(&input);
+		vxReleaseParameter(&input_param);
+	}
+	return status;
+}
+
+/************************************************************************************************************
+Runs op on every tile of the batch with the input and output images mapped in place.
+*************************************************************************************************************/
+static vx_status CV_arithm_batch_Run(const vx_reference *parameters, std::function<void(const Mat&, const Mat&, Mat&)> op)
+{
+	vx_status status = VX_SUCCESS;
+
+	vx_image image_in1 = (vx_image) parameters[0];
+	vx_image image_in2 = (vx_image) parameters[1];
+	vx_image image_out = (vx_image) parameters[2];
+	vx_array rois = (vx_array) parameters[3];
+	vector<Rect> rects;
+
+	STATUS_ERROR_CHECK(match_vx_image_parameters(image_in1, image_in2));
+	STATUS_ERROR_CHECK(match_vx_image_parameters(image_in1, image_out));
+	STATUS_ERROR_CHECK(VX_to_CV_Rects(rects, rois, image_in1));
+	if (rects.empty())
+		return status;
+
+	Mat mat_in1, mat_in2, mat_out;
+	vx_rectangle_t rect[3]; vx_imagepatch_addressing_t addr[3]; void *ptr[3] = { NULL, NULL, NULL };
+	STATUS_ERROR_CHECK(VX_Access_CV_Image(&mat_in1, image_in1, &rect[0], &addr[0], &ptr[0], VX_READ_ONLY));
+	status = VX_Access_CV_Image(&mat_in2, image_in2, &rect[1], &addr[1], &ptr[1], VX_READ_ONLY);
+	if (status == VX_SUCCESS)
+		status = VX_Access_CV_Image(&mat_out, image_out, &rect[2], &addr[2], &ptr[2], VX_READ_AND_WRITE);
+
+	if (status == VX_SUCCESS)
+	{
+		//Compute using OpenCV, one tile per task
+		cv::parallel_for_(Range(0, (int)rects.size()), CV_Batch_Invoker(rects, [&](const Rect& r) {
+			Mat tile_out = CV_Tile(mat_out, r);
+			op(CV_Tile(mat_in1, r), CV_Tile(mat_in2, r), tile_out);
+		}));
+	}
+
+	if (ptr[2]) vxCommitImagePatch(image_out, &rect[2], 0, &addr[2], ptr[2]);
+	if (ptr[1]) vxCommitImagePatch(image_in2, &rect[1], 0, &addr[1], ptr[1]);
+	vxCommitImagePatch(image_in1, &rect[0], 0, &addr[0], ptr[0]);
+
+	return status;
+}
+
+/************************************************************************************************************
+Execution Kernels
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_add_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	return CV_arithm_batch_Run(parameters, [](const Mat& a, const Mat& b, Mat& out) { cv::add(a, b, out); });
+}
+
+static vx_status VX_CALLBACK CV_subtract_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	return CV_arithm_batch_Run(parameters, [](const Mat& a, const Mat& b, Mat& out) { cv::subtract(a, b, out); });
+}
+
+static vx_status VX_CALLBACK CV_absdiff_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	return CV_arithm_batch_Run(parameters, [](const Mat& a, const Mat& b, Mat& out) { cv::absdiff(a, b, out); });
+}
+
+/************************************************************************************************************
+Function to Register a batched arithmetic Kernel for Publish
+*************************************************************************************************************/
+static vx_status CV_arithm_batch_Register(vx_context context, const char *name, vx_enum enumeration, vx_kernel_f func)
+{
+	vx_status status = VX_SUCCESS;
+	vx_kernel kernel = vxAddKernel(context,
+		name,
+		enumeration,
+		func,
+		4,
+		CV_arithm_batch_InputValidator,
+		CV_arithm_batch_OutputValidator,
+		nullptr,
+		nullptr);
+
+	if (kernel)
+	{
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 1, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 2, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
+	}
+
+	if (status != VX_SUCCESS)
+	{
+	exit:	vxRemoveKernel(kernel); return VX_FAILURE;
+	}
+
+	return status;
+}
+
+vx_status CV_add_batch_Register(vx_context context)
+{
+	return CV_arithm_batch_Register(context, "org.opencv.add_batch", VX_KERNEL_EXT_CV_ADD_BATCH, CV_add_batch_Kernel);
+}
+
+vx_status CV_subtract_batch_Register(vx_context context)
+{
+	return CV_arithm_batch_Register(context, "org.opencv.subtract_batch", VX_KERNEL_EXT_CV_SUBTRACT_BATCH, CV_subtract_batch_Kernel);
+}
+
+vx_status CV_absdiff_batch_Register(vx_context context)
+{
+	return CV_arithm_batch_Register(context, "org.opencv.absdiff_batch", VX_KERNEL_EXT_CV_ABSDIFF_BATCH, CV_absdiff_batch_Kernel);
+}
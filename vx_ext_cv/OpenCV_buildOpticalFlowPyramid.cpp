@@ -196,7 +196,6 @@ static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Kernel(vx_node node, con
 	vx_scalar D_Border = (vx_scalar) parameters[7];
 	vx_scalar TRY_Reuse = (vx_scalar) parameters[8];
 
-	Mat *mat, bl;
 	int W, H, WinSize, Pry_Border, derviBorder;
 	vx_bool WithDervi, try_reuse;
 	vx_int32 value = 0;
@@ -211,18 +210,71 @@ static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Kernel(vx_node node, con
 	STATUS_ERROR_CHECK(vxReadScalarValue(D_Border, &value)); derviBorder = value;
 	STATUS_ERROR_CHECK(vxReadScalarValue(TRY_Reuse, &value_b)); try_reuse = value_b;
 
-	//Converting VX Image to OpenCV Mat
-	STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+	//Accessing VX Image as an OpenCV Mat
+	Mat mat_in; vx_rectangle_t rect_in; vx_imagepatch_addressing_t addr_in; void *ptr_in = NULL;
+	STATUS_ERROR_CHECK(VX_Access_CV_Image(&mat_in, image_in, &rect_in, &addr_in, &ptr_in, VX_READ_ONLY));
 
-	//Compute using OpenCV
-	vector<Mat> pyramid_cv;
+	//Compute using OpenCV, into the per-node level buffer which is reused across frames
+	//(the padded levels produced by OpenCV cannot be written directly into the OpenVX pyramid)
+	vector<Mat> pyramid_local, *pyramid_cv = nullptr;
+	if (vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &pyramid_cv, sizeof(pyramid_cv)) != VX_SUCCESS || !pyramid_cv)
+		pyramid_cv = &pyramid_local;
 	bool WithDervi_b, try_reuse_b;
 	if (WithDervi == 1) WithDervi_b = true; else WithDervi_b = false;
 	if (try_reuse == 1) try_reuse_b = true; else try_reuse_b = false;
-	cv::buildOpticalFlowPyramid(*mat, pyramid_cv, Size(W, H), WinSize, WithDervi_b, Pry_Border, derviBorder, try_reuse_b);
+	cv::buildOpticalFlowPyramid(mat_in, *pyramid_cv, Size(W, H), WinSize, WithDervi_b, Pry_Border, derviBorder, try_reuse_b);
 
-	//Converting OpenCV Mat into VX Image
-	STATUS_ERROR_CHECK(CV_to_VX_Pyramid(pyramid_vx, pyramid_cv));
+	//Converting OpenCV Mat into VX Image (derivatives are interleaved with the levels when requested)
+	status = CV_to_VX_Pyramid(pyramid_vx, *pyramid_cv, WithDervi_b ? 2 : 1);
+	vxCommitImagePatch(image_in, &rect_in, 0, &addr_in, ptr_in);
+
+	return status;
+}
+
+/*! \brief ***********************************************************************************************************
+Initializer function.
+
+Allocates the per-node level buffer (a vector<Mat> in node-local memory) that buildOpticalFlowPyramid reuses across frames.
+
+param [in] node       -->The handle to the node.
+param [in] parameters -->The index of the parameter.
+param [in] num        -->Number of parameters.
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Initialize(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	vx_status status = VX_SUCCESS;
+	vx_size size = sizeof(vector<Mat>);
+	vector<Mat> * pyramid_cv = new vector<Mat>;
+
+	status = vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size));
+	if (status == VX_SUCCESS)
+		status = vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &pyramid_cv, sizeof(pyramid_cv));
+	if (status != VX_SUCCESS)
+		delete pyramid_cv;
+
+	return status;
+}
+
+/*! \brief ***********************************************************************************************************
+De-Initializer function.
+
+Releases the per-node level buffer.
+
+param [in] node       -->The handle to the node.
+param [in] parameters -->The index of the parameter.
+param [in] num        -->Number of parameters.
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_buildOpticalFlowPyramid_Deinitialize(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	vx_status status = VX_SUCCESS;
+	vx_size size = 0;
+	vector<Mat> * pyramid_cv = nullptr;
+
+	STATUS_ERROR_CHECK(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &pyramid_cv, sizeof(pyramid_cv)));
+	delete pyramid_cv;
+	pyramid_cv = nullptr;
+	STATUS_ERROR_CHECK(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &pyramid_cv, sizeof(pyramid_cv)));
+	STATUS_ERROR_CHECK(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
 
 	return status;
 }
@@ -240,8 +292,8 @@ vx_status CV_buildOpticalFlowPyramid_Register(vx_context context)
 		9,
 		CV_buildOpticalFlowPyramid_InputValidator,
 		CV_buildOpticalFlowPyramid_OutputValidator,
-		nullptr,
-		nullptr);
+		CV_buildOpticalFlowPyramid_Initialize,
+		CV_buildOpticalFlowPyramid_Deinitialize);
 
 	if (kernel)
 	{
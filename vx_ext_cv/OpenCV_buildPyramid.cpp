@@ -134,24 +134,53 @@ static vx_status VX_CALLBACK CV_buildPyramid_Kernel(vx_node node, const vx_refer
 	vx_scalar scalar = (vx_scalar) parameters[2];
 	vx_scalar scalar1 = (vx_scalar) parameters[3];
 
-	Mat *mat, bl;
 	int maxLevel, border;
-
 	vx_int32 value = 0;
+	vx_size Level_vx = 0;
 
 	//Extracting Values from the Scalar into maxLevel and Ddepth
 	STATUS_ERROR_CHECK(vxReadScalarValue(scalar, &value));maxLevel = value;
 	STATUS_ERROR_CHECK(vxReadScalarValue(scalar1, &value));border = value;
-
-	//Converting VX Image to OpenCV Mat
-	STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
+	STATUS_ERROR_CHECK(vxQueryPyramid(pyramid, VX_PYRAMID_ATTRIBUTE_LEVELS, &Level_vx, sizeof(Level_vx)));
+	int levels = max(0, min((int)Level_vx, maxLevel + 1));
+
+	//Accessing the VX input image and pyramid levels as OpenCV Mat headers, so that OpenCV
+	//writes every level directly into the pyramid without an intermediate vector<Mat>
+	Mat mat_in; vx_rectangle_t rect_in; vx_imagepatch_addressing_t addr_in; void *ptr_in = NULL;
+	STATUS_ERROR_CHECK(VX_Access_CV_Image(&mat_in, image_in, &rect_in, &addr_in, &ptr_in, VX_READ_ONLY));
+
+	vector<Mat> level_cv(levels); vector<vx_image> level_vx(levels, nullptr);
+	vector<vx_rectangle_t> rect(levels); vector<vx_imagepatch_addressing_t> addr(levels); vector<void *> ptr(levels, nullptr);
+	int mapped = 0;
+	for (; mapped < levels; mapped++)
+	{
+		level_vx[mapped] = vxGetPyramidLevel(pyramid, mapped);
+		status = VX_Access_CV_Image(&level_cv[mapped], level_vx[mapped], &rect[mapped], &addr[mapped], &ptr[mapped], VX_WRITE_ONLY);
+		if (status != VX_SUCCESS) { vxReleaseImage(&level_vx[mapped]); break; }
+		Size src_size = mapped ? level_cv[mapped - 1].size() : mat_in.size();
+		Size dst_size = level_cv[mapped].size();
+		if ((mapped == 0 && dst_size != src_size) ||
+			(mapped > 0 && (std::abs(dst_size.width * 2 - src_size.width) > 2 || std::abs(dst_size.height * 2 - src_size.height) > 2)))
+		{
+			vxAddLogEntry((vx_reference)pyramid, VX_ERROR_INVALID_DIMENSION, "CV_buildPyramid ERROR: Pyramid Image Mismatch\n");
+			status = VX_ERROR_INVALID_DIMENSION; mapped++; break;
+		}
+	}
 
 	//Compute using OpenCV
-	vector<Mat> pyramid_cv;
-	cv::buildPyramid(*mat, pyramid_cv, maxLevel, border);
+	if (status == VX_SUCCESS && levels > 0)
+	{
+		mat_in.copyTo(level_cv[0]);
+		for (int i = 1; i < levels; i++)
+			cv::pyrDown(level_cv[i - 1], level_cv[i], level_cv[i].size(), border);
+	}
 
-	//Converting OpenCV Vector Mat into VX Image
-	STATUS_ERROR_CHECK(CV_to_VX_Pyramid(pyramid, pyramid_cv));
+	for (int i = 0; i < mapped; i++)
+	{
+		if (ptr[i]) vxCommitImagePatch(level_vx[i], &rect[i], 0, &addr[i], ptr[i]);
+		vxReleaseImage(&level_vx[i]);
+	}
+	vxCommitImagePatch(image_in, &rect_in, 0, &addr_in, ptr_in);
 
 	return status;
 }
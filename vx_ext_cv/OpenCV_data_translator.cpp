@@ -22,30 +22,34 @@ THE SOFTWARE.
 
 
 #include"OpenCV_Tunnel.h"
+#include <algorithm>
 
 /************************************************************************************************************
-Converting CV Pyramid into an OpenVX Pyramid
+Converting CV Pyramid into an OpenVX Pyramid (level i of the OpenVX Pyramid is taken from pyramid_cv[i * step])
 *************************************************************************************************************/
-int CV_to_VX_Pyramid(vx_pyramid pyramid_vx, vector<Mat> pyramid_cv)
+int CV_to_VX_Pyramid(vx_pyramid pyramid_vx, const vector<Mat>& pyramid_cv, int step)
 {
 	vx_status status = VX_SUCCESS;
 	vx_size Level_vx = 0; vx_uint32 width = 0; 	vx_uint32 height = 0; vx_int32 i;
 
 	STATUS_ERROR_CHECK(vxQueryPyramid(pyramid_vx, VX_PYRAMID_ATTRIBUTE_LEVELS, &Level_vx, sizeof(Level_vx)));
-	for (i = 0; i < (int)Level_vx; i++)
+	for (i = 0; i < (int)Level_vx && (size_t)(i * step) < pyramid_cv.size(); i++)
 	{
+		const Mat& pyr_level = pyramid_cv[i * step];
 		vx_image this_level = vxGetPyramidLevel(pyramid_vx, i);
 		STATUS_ERROR_CHECK(vxQueryImage(this_level, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxQueryImage(this_level, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
-		if (width != pyramid_cv[i].cols && height != pyramid_cv[i].rows)
+		if (width != pyr_level.cols || height != pyr_level.rows)
 		{
+			vxReleaseImage(&this_level);
 			vxAddLogEntry((vx_reference)pyramid_vx, VX_ERROR_INVALID_DIMENSION, "CV_to_VX_Pyramid ERROR: Pyramid Image Mismatch\n"); return VX_ERROR_INVALID_DIMENSION;
 		}
-		Mat* pyr_level;
-		pyr_level = &pyramid_cv[i];
-		CV_to_VX_Image(this_level, pyr_level);
+		status = CV_to_VX_Image(this_level, (Mat *)&pyr_level);
+		vxReleaseImage(&this_level);
+		if (status != VX_SUCCESS)
+			return status;
 	}
-	return 0;
+	return status;
 }
 
 /************************************************************************************************************
@@ -82,6 +86,24 @@ int VX_to_CV_MATRIX(Mat** mat, vx_matrix matrix_vx)
 	return status;
 }
 
+/************************************************************************************************************
+Converting VX Image format into an OpenCV Mat type (returns -1 if not supported)
+*************************************************************************************************************/
+int VX_to_CV_Format(vx_df_image format)
+{
+	switch (format)
+	{
+	case VX_DF_IMAGE_U8:		return CV_8UC1;
+	case VX_DF_IMAGE_U16:		return CV_16UC1;
+	case VX_DF_IMAGE_S16:		return CV_16SC1;
+	case VX_DF_IMAGE_S32:		return CV_32SC1;
+	case VX_DF_IMAGE_F32_AMD:	return CV_32FC1;
+	case VX_DF_IMAGE_RGB:		return CV_8UC3;
+	case VX_DF_IMAGE_RGBX:		return CV_8UC4;
+	}
+	return -1;
+}
+
 /************************************************************************************************************
 Converting VX Image into an OpenCV Mat
 *************************************************************************************************************/
@@ -95,11 +117,8 @@ int VX_to_CV_Image(Mat** mat, vx_image image)
 	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
 	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &planes, sizeof(planes)));
 	
-	if (format == VX_DF_IMAGE_U8)CV_format = CV_8U;
-	if (format == VX_DF_IMAGE_S16)CV_format = CV_16S;
-	if (format == VX_DF_IMAGE_RGB)CV_format = CV_8UC3;
-	
-	if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_S16 && format != VX_DF_IMAGE_RGB)
+	CV_format = VX_to_CV_Format(format);
+	if (CV_format < 0)
 	{
 		vxAddLogEntry((vx_reference)image, VX_ERROR_INVALID_FORMAT, "VX_to_CV_Image ERROR: Image type not Supported in this RELEASE\n"); return VX_ERROR_INVALID_FORMAT;
 	}
@@ -129,6 +148,38 @@ int VX_to_CV_Image(Mat** mat, vx_image image)
 	return status;
 }
 
+/************************************************************************************************************
+Accessing a single plane VX Image as an OpenCV Mat header without any copy.
+The caller must release the access with vxCommitImagePatch(image, rect, 0, addr, *ptr).
+*************************************************************************************************************/
+int VX_Access_CV_Image(Mat* mat, vx_image image, vx_rectangle_t* rect, vx_imagepatch_addressing_t* addr, void** ptr, vx_enum usage)
+{
+	vx_status status = VX_SUCCESS;
+	vx_uint32 width = 0; vx_uint32 height = 0; vx_df_image format = VX_DF_IMAGE_VIRT; int CV_format = 0;
+
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+
+	CV_format = VX_to_CV_Format(format);
+	if (CV_format < 0)
+	{
+		vxAddLogEntry((vx_reference)image, VX_ERROR_INVALID_FORMAT, "VX_Access_CV_Image ERROR: Image type not Supported in this RELEASE\n"); return VX_ERROR_INVALID_FORMAT;
+	}
+
+	rect->start_x = 0; rect->start_y = 0; rect->end_x = width; rect->end_y = height; *ptr = NULL;
+	STATUS_ERROR_CHECK(vxAccessImagePatch(image, rect, 0, addr, ptr, usage));
+	if ((size_t)addr->stride_x != CV_ELEM_SIZE(CV_format))
+	{
+		vxCommitImagePatch(image, rect, 0, addr, *ptr);
+		vxAddLogEntry((vx_reference)image, VX_ERROR_INVALID_FORMAT, "VX_Access_CV_Image ERROR: Image layout not Supported in this RELEASE\n"); return VX_ERROR_INVALID_FORMAT;
+	}
+
+	*mat = Mat(height, width, CV_format, *ptr, addr->stride_y);
+
+	return status;
+}
+
 /************************************************************************************************************
 Converting CV Image into an OpenVX Image
 *************************************************************************************************************/
@@ -149,6 +200,11 @@ int CV_to_VX_Image(vx_image image, Mat* mat)
 	{
 		STATUS_ERROR_CHECK(vxAccessImagePatch(image, &rect, p, &addr[p], (void **)&src[p], VX_READ_ONLY));
 		size_t len = addr[p].stride_x * (addr[p].dim_x * addr[p].scale_x) / VX_SCALE_UNITY;
+		if (len > pMat->cols * pMat->elemSize() || pMat->rows < (int)height)
+		{
+			vxCommitImagePatch(image, &rect, p, &addr[p], src[p]);
+			vxAddLogEntry((vx_reference)image, VX_ERROR_INVALID_FORMAT, "CV_to_VX_Image ERROR: Mat type or size does not match the OpenVX Image\n"); return VX_ERROR_INVALID_FORMAT;
+		}
 		for (y = 0; y < height; y += addr[p].step_y)
 		{
 			ptr = vxFormatImagePatchAddress2d(src[p], 0, y - rect.start_y, &addr[p]);
@@ -295,4 +351,117 @@ int match_vx_image_parameters(vx_image image1, vx_image image2)
 	}
 
 	return status;
-}
\ No newline at end of file
+}
+
+/************************************************************************************************************
+Match VX image formats of two node parameters: same number of channels, and the same depth if match_depth is set
+*************************************************************************************************************/
+int match_vx_image_formats(vx_node node, vx_uint32 index1, vx_uint32 index2, bool match_depth)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param1 = vxGetParameterByIndex(node, index1);
+	vx_parameter param2 = vxGetParameterByIndex(node, index2);
+	vx_image image1 = nullptr, image2 = nullptr;
+	vx_df_image format1 = VX_DF_IMAGE_VIRT, format2 = VX_DF_IMAGE_VIRT;
+
+	STATUS_ERROR_CHECK(vxQueryParameter(param1, VX_PARAMETER_ATTRIBUTE_REF, &image1, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryParameter(param2, VX_PARAMETER_ATTRIBUTE_REF, &image2, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryImage(image1, VX_IMAGE_ATTRIBUTE_FORMAT, &format1, sizeof(format1)));
+	STATUS_ERROR_CHECK(vxQueryImage(image2, VX_IMAGE_ATTRIBUTE_FORMAT, &format2, sizeof(format2)));
+
+	int type1 = VX_to_CV_Format(format1), type2 = VX_to_CV_Format(format2);
+	if (type1 < 0 || type2 < 0 || CV_MAT_CN(type1) != CV_MAT_CN(type2) || (match_depth && CV_MAT_DEPTH(type1) != CV_MAT_DEPTH(type2)))
+	{
+		status = VX_ERROR_INVALID_FORMAT;
+		vxAddLogEntry((vx_reference)node, status, "match_vx_image_formats ERROR: Image format %4.4s does not match %4.4s\n", &format2, &format1);
+	}
+
+	vxReleaseImage(&image1);
+	vxReleaseImage(&image2);
+	vxReleaseParameter(&param1);
+	vxReleaseParameter(&param2);
+	return status;
+}
+
+/************************************************************************************************************
+Match the depth of a VX image node parameter with a dtype scalar parameter (dtype < 0: depth of the input image)
+*************************************************************************************************************/
+int match_vx_image_dtype(vx_node node, vx_uint32 image_index, vx_uint32 dtype_index, vx_uint32 input_index)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param_image = vxGetParameterByIndex(node, image_index);
+	vx_parameter param_dtype = vxGetParameterByIndex(node, dtype_index);
+	vx_parameter param_input = vxGetParameterByIndex(node, input_index);
+	vx_image image = nullptr, input = nullptr; vx_scalar scalar = nullptr; vx_int32 dtype = -1;
+	vx_df_image format = VX_DF_IMAGE_VIRT, input_format = VX_DF_IMAGE_VIRT;
+
+	STATUS_ERROR_CHECK(vxQueryParameter(param_image, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryParameter(param_dtype, VX_PARAMETER_ATTRIBUTE_REF, &scalar, sizeof(vx_scalar)));
+	STATUS_ERROR_CHECK(vxQueryParameter(param_input, VX_PARAMETER_ATTRIBUTE_REF, &input, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+	STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+	STATUS_ERROR_CHECK(vxReadScalarValue(scalar, &dtype));
+
+	int type = VX_to_CV_Format(format), input_type = VX_to_CV_Format(input_format);
+	int depth = (dtype < 0) ? CV_MAT_DEPTH(input_type) : dtype;
+	if (type < 0 || input_type < 0 || CV_MAT_DEPTH(type) != depth)
+	{
+		status = VX_ERROR_INVALID_FORMAT;
+		vxAddLogEntry((vx_reference)node, status, "match_vx_image_dtype ERROR: Image format %4.4s does not match dtype %d\n", &format, dtype);
+	}
+
+	vxReleaseImage(&image);
+	vxReleaseImage(&input);
+	vxReleaseScalar(&scalar);
+	vxReleaseParameter(&param_image);
+	vxReleaseParameter(&param_dtype);
+	vxReleaseParameter(&param_input);
+	return status;
+}
+
+/************************************************************************************************************
+Converting a VX Array of vx_rectangle_t into OpenCV Rects clipped to the image (empty rectangles are dropped).
+The batched kernels write the tiles concurrently, so rectangles that overlap after clipping are rejected.
+*************************************************************************************************************/
+int VX_to_CV_Rects(vector<Rect>& rects, vx_array array, vx_image image)
+{
+	vx_status status = VX_SUCCESS;
+	vx_uint32 width = 0; vx_uint32 height = 0; vx_size count = 0;
+
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	STATUS_ERROR_CHECK(vxQueryArray(array, VX_ARRAY_ATTRIBUTE_NUMITEMS, &count, sizeof(count)));
+
+	rects.clear();
+	if (count == 0)
+		return status;
+
+	vx_size stride = 0; void *base = NULL;
+	STATUS_ERROR_CHECK(vxAccessArrayRange(array, 0, count, &stride, &base, VX_READ_ONLY));
+	Rect bounds(0, 0, (int)width, (int)height);
+	for (vx_size i = 0; i < count; i++)
+	{
+		vx_rectangle_t *r = &vxArrayItem(vx_rectangle_t, base, i, stride);
+		Rect rect = Rect((int)r->start_x, (int)r->start_y, (int)r->end_x - (int)r->start_x, (int)r->end_y - (int)r->start_y) & bounds;
+		if (rect.area() > 0)
+			rects.push_back(rect);
+	}
+	STATUS_ERROR_CHECK(vxCommitArrayRange(array, 0, count, base));
+
+	// sweep the rectangles sorted by start_x: only those starting before the end of a rectangle can overlap it
+	vector<Rect> sorted(rects);
+	std::sort(sorted.begin(), sorted.end(), [](const Rect& a, const Rect& b) { return a.x < b.x; });
+	for (size_t i = 0; i < sorted.size(); i++)
+	{
+		for (size_t j = i + 1; j < sorted.size() && sorted[j].x < sorted[i].x + sorted[i].width; j++)
+		{
+			if ((sorted[i] & sorted[j]).area() > 0)
+			{
+				vxAddLogEntry((vx_reference)array, VX_ERROR_INVALID_PARAMETERS, "VX_to_CV_Rects ERROR: overlapping rectangles\n");
+				return VX_ERROR_INVALID_PARAMETERS;
+			}
+		}
+	}
+
+	return status;
+}
@@ -50,7 +50,7 @@ static vx_status VX_CALLBACK CV_distanceTransform_InputValidator(vx_node node, v
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_F32_AMD)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -75,7 +75,7 @@ static vx_status VX_CALLBACK CV_distanceTransform_OutputValidator(vx_node node,
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
 
-		if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_S16)
+		if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_F32_AMD)
 			status = VX_ERROR_INVALID_VALUE;
 
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
@@ -98,13 +98,15 @@ static vx_status VX_CALLBACK CV_distanceTransform_Kernel(vx_node node, const vx_
 	vx_image image_in = (vx_image) parameters[0];
 	vx_image image_out = (vx_image) parameters[1];
 	Mat *mat, bl;
+	vx_df_image format = VX_DF_IMAGE_VIRT;
 
 	//Converting VX Image to OpenCV Mat 1
 	STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
+	STATUS_ERROR_CHECK(vxQueryImage(image_out, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
 	STATUS_ERROR_CHECK(VX_to_CV_Image(&mat, image_in));
 
-	//Compute using OpenCV
-	cv::distanceTransform(*mat, bl, CV_DIST_L1, 3, CV_8U); //only CV_DIST_L1 & CV_8U supported in this release
+	//Compute using OpenCV (CV_DIST_L1 for both output depths, so F32 output differs from U8 output only by saturation)
+	cv::distanceTransform(*mat, bl, CV_DIST_L1, 3, (format == VX_DF_IMAGE_F32_AMD) ? CV_32F : CV_8U);
 
 	//Converting OpenCV Mat into VX Image
 	STATUS_ERROR_CHECK(CV_to_VX_Image(image_out, &bl));
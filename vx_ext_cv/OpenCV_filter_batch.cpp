@@ -0,0 +1,368 @@
+/* 
+Copyright (c) 2015 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include"publishkernels.h"
+
+/************************************************************************************************************
+Batched filters: one node filters every rectangle of a vx_array of VX_TYPE_RECTANGLE as a stand-alone tile.
+Tiles are filtered in parallel on the OpenCV thread pool (see cv::setNumThreads) and pixels outside the
+rectangles are left untouched in the output image. Overlapping rectangles fail the execution (VX_to_CV_Rects).
+*************************************************************************************************************/
+
+/************************************************************************************************************
+parameter validators shared by the batched filters.
+*************************************************************************************************************/
+static vx_status CV_batch_ValidateImage(vx_parameter param)
+{
+	vx_status status = VX_SUCCESS;
+	vx_image image;
+	vx_df_image df_image = VX_DF_IMAGE_VIRT;
+	STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
+	if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_U16 && df_image != VX_DF_IMAGE_S16 && df_image != VX_DF_IMAGE_F32_AMD && df_image != VX_DF_IMAGE_RGB && df_image != VX_DF_IMAGE_RGBX)
+		status = VX_ERROR_INVALID_VALUE;
+	vxReleaseImage(&image);
+	return status;
+}
+
+static vx_status CV_batch_ValidateRects(vx_parameter param)
+{
+	vx_status status = VX_SUCCESS;
+	vx_array array; vx_enum type = 0;
+	STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &array, sizeof(vx_array)));
+	STATUS_ERROR_CHECK(vxQueryArray(array, VX_ARRAY_ATTRIBUTE_ITEMTYPE, &type, sizeof(type)));
+	if (type != VX_TYPE_RECTANGLE)
+		status = VX_ERROR_INVALID_TYPE;
+	vxReleaseArray(&array);
+	return status;
+}
+
+static vx_status CV_batch_ValidateKsize(vx_parameter param, bool odd)
+{
+	vx_status status = VX_SUCCESS;
+	vx_scalar scalar = 0; vx_enum type = 0;	vx_int32 value = 0;
+	STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &scalar, sizeof(scalar)));
+	STATUS_ERROR_CHECK(vxQueryScalar(scalar, VX_SCALAR_ATTRIBUTE_TYPE, &type, sizeof(type)));
+	STATUS_ERROR_CHECK(vxReadScalarValue(scalar, &value));
+	if (value < 0 || (odd && (value % 2 == 0)) || type != VX_TYPE_INT32)
+		status = VX_ERROR_INVALID_VALUE;
+	vxReleaseScalar(&scalar);
+	return status;
+}
+
+static vx_status CV_batch_ValidateScalar(vx_parameter param, vx_enum expected)
+{
+	vx_status status = VX_SUCCESS;
+	vx_scalar scalar = 0; vx_enum type = 0;
+	STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &scalar, sizeof(scalar)));
+	STATUS_ERROR_CHECK(vxQueryScalar(scalar, VX_SCALAR_ATTRIBUTE_TYPE, &type, sizeof(type)));
+	if (type != expected)
+		status = VX_ERROR_INVALID_TYPE;
+	vxReleaseScalar(&scalar);
+	return status;
+}
+
+/************************************************************************************************************
+output parameter validator: the output image has the size and format of the input image.
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_filter_batch_OutputValidator(vx_node node, vx_uint32 index, vx_meta_format meta)
+{
+	vx_status status = VX_SUCCESS;
+	if (index == 1)
+	{
+		vx_parameter input_param = vxGetParameterByIndex(node, 0);
+		vx_image input; vx_uint32 width = 0, height = 0; vx_df_image format = VX_DF_IMAGE_VIRT;
+
+		STATUS_ERROR_CHECK(vxQueryParameter(input_param, VX_PARAMETER_ATTRIBUTE_REF, &input, sizeof(vx_image)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+		STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+
+		vxReleaseImage(&input);
+		vxReleaseParameter(&input_param);
+	}
+	return status;
+}
+
+/************************************************************************************************************
+Runs op on every tile of the batch with the input and output images mapped in place.
+*************************************************************************************************************/
+static vx_status CV_filter_batch_Run(vx_image image_in, vx_image image_out, vx_array rois, std::function<void(const Mat&, Mat&)> op)
+{
+	vx_status status = VX_SUCCESS;
+	vector<Rect> rects;
+
+	STATUS_ERROR_CHECK(match_vx_image_parameters(image_in, image_out));
+	STATUS_ERROR_CHECK(VX_to_CV_Rects(rects, rois, image_in));
+	if (rects.empty())
+		return status;
+
+	Mat mat_in, mat_out;
+	vx_rectangle_t rect_in, rect_out; vx_imagepatch_addressing_t addr_in, addr_out; void *ptr_in = NULL, *ptr_out = NULL;
+	STATUS_ERROR_CHECK(VX_Access_CV_Image(&mat_in, image_in, &rect_in, &addr_in, &ptr_in, VX_READ_ONLY));
+	status = VX_Access_CV_Image(&mat_out, image_out, &rect_out, &addr_out, &ptr_out, VX_READ_AND_WRITE);
+	if (status != VX_SUCCESS)
+	{
+		vxCommitImagePatch(image_in, &rect_in, 0, &addr_in, ptr_in);
+		return status;
+	}
+
+	//Compute using OpenCV, one tile per task
+	cv::parallel_for_(Range(0, (int)rects.size()), CV_Batch_Invoker(rects, [&](const Rect& r) {
+		Mat tile_out = CV_Tile(mat_out, r);
+		op(CV_Tile(mat_in, r), tile_out);
+	}));
+
+	vxCommitImagePatch(image_out, &rect_out, 0, &addr_out, ptr_out);
+	vxCommitImagePatch(image_in, &rect_in, 0, &addr_in, ptr_in);
+
+	return status;
+}
+
+/************************************************************************************************************
+blur_batch: input, output, rois, kwidth, kheight, border
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_blur_batch_InputValidator(vx_node node, vx_uint32 index)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param = vxGetParameterByIndex(node, index);
+
+	if (index == 0) status = CV_batch_ValidateImage(param);
+	else if (index == 2) status = CV_batch_ValidateRects(param);
+	else if (index == 3 || index == 4) status = CV_batch_ValidateKsize(param, false);
+	else if (index == 5) status = CV_batch_ValidateScalar(param, VX_TYPE_INT32);
+
+	vxReleaseParameter(&param);
+	return status;
+}
+
+static vx_status VX_CALLBACK CV_blur_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	vx_status status = VX_SUCCESS;
+
+	vx_image image_in = (vx_image) parameters[0];
+	vx_image image_out = (vx_image) parameters[1];
+	vx_array rois = (vx_array) parameters[2];
+	vx_scalar K_width = (vx_scalar) parameters[3];
+	vx_scalar K_height = (vx_scalar) parameters[4];
+	vx_scalar S_border = (vx_scalar) parameters[5];
+
+	int W, H, Border;
+	vx_int32 value = 0;
+
+	STATUS_ERROR_CHECK(vxReadScalarValue(K_width, &value)); W = value;
+	STATUS_ERROR_CHECK(vxReadScalarValue(K_height, &value)); H = value;
+	STATUS_ERROR_CHECK(vxReadScalarValue(S_border, &value)); Border = value;
+
+	STATUS_ERROR_CHECK(CV_filter_batch_Run(image_in, image_out, rois, [=](const Mat& in, Mat& out) {
+		cv::blur(in, out, Size(W, H), Point(-1, -1), Border);
+	}));
+
+	return status;
+}
+
+vx_status CV_blur_batch_Register(vx_context context)
+{
+	vx_status status = VX_SUCCESS;
+	vx_kernel kernel = vxAddKernel(context,
+		"org.opencv.blur_batch",
+		VX_KERNEL_EXT_CV_BLUR_BATCH,
+		CV_blur_batch_Kernel,
+		6,
+		CV_blur_batch_InputValidator,
+		CV_filter_batch_OutputValidator,
+		nullptr,
+		nullptr);
+
+	if (kernel)
+	{
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
+	}
+
+	if (status != VX_SUCCESS)
+	{
+	exit:	vxRemoveKernel(kernel); return VX_FAILURE;
+	}
+
+	return status;
+}
+
+/************************************************************************************************************
+gaussianblur_batch: input, output, rois, kwidth, kheight, sigmaX, sigmaY, border
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_Gaussianblur_batch_InputValidator(vx_node node, vx_uint32 index)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param = vxGetParameterByIndex(node, index);
+
+	if (index == 0) status = CV_batch_ValidateImage(param);
+	else if (index == 2) status = CV_batch_ValidateRects(param);
+	else if (index == 3 || index == 4) status = CV_batch_ValidateKsize(param, true);
+	else if (index == 5 || index == 6) status = CV_batch_ValidateScalar(param, VX_TYPE_FLOAT32);
+	else if (index == 7) status = CV_batch_ValidateScalar(param, VX_TYPE_INT32);
+
+	vxReleaseParameter(&param);
+	return status;
+}
+
+static vx_status VX_CALLBACK CV_Gaussianblur_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	vx_status status = VX_SUCCESS;
+
+	vx_image image_in = (vx_image) parameters[0];
+	vx_image image_out = (vx_image) parameters[1];
+	vx_array rois = (vx_array) parameters[2];
+	vx_scalar K_width = (vx_scalar) parameters[3];
+	vx_scalar K_height = (vx_scalar) parameters[4];
+	vx_scalar S_sigmaX = (vx_scalar) parameters[5];
+	vx_scalar S_sigmaY = (vx_scalar) parameters[6];
+	vx_scalar S_border = (vx_scalar) parameters[7];
+
+	int W, H, Border;
+	float Sigma_X, Sigma_Y;
+	vx_int32 value = 0;
+	vx_float32 value_f = 0;
+
+	STATUS_ERROR_CHECK(vxReadScalarValue(K_width, &value)); W = value;
+	STATUS_ERROR_CHECK(vxReadScalarValue(K_height, &value)); H = value;
+	STATUS_ERROR_CHECK(vxReadScalarValue(S_sigmaX, &value_f)); Sigma_X = value_f;
+	STATUS_ERROR_CHECK(vxReadScalarValue(S_sigmaY, &value_f)); Sigma_Y = value_f;
+	STATUS_ERROR_CHECK(vxReadScalarValue(S_border, &value)); Border = value;
+
+	STATUS_ERROR_CHECK(CV_filter_batch_Run(image_in, image_out, rois, [=](const Mat& in, Mat& out) {
+		cv::GaussianBlur(in, out, Size(W, H), Sigma_X, Sigma_Y, Border);
+	}));
+
+	return status;
+}
+
+vx_status CV_Gaussianblur_batch_Register(vx_context context)
+{
+	vx_status status = VX_SUCCESS;
+	vx_kernel kernel = vxAddKernel(context,
+		"org.opencv.gaussianblur_batch",
+		VX_KERNEL_EXT_CV_GAUSSIAN_BLUR_BATCH,
+		CV_Gaussianblur_batch_Kernel,
+		8,
+		CV_Gaussianblur_batch_InputValidator,
+		CV_filter_batch_OutputValidator,
+		nullptr,
+		nullptr);
+
+	if (kernel)
+	{
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
+	}
+
+	if (status != VX_SUCCESS)
+	{
+	exit:	vxRemoveKernel(kernel); return VX_FAILURE;
+	}
+
+	return status;
+}
+
+/************************************************************************************************************
+medianblur_batch: input, output, rois, ksize
+*************************************************************************************************************/
+static vx_status VX_CALLBACK CV_Medianblur_batch_InputValidator(vx_node node, vx_uint32 index)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter param = vxGetParameterByIndex(node, index);
+
+	if (index == 0) status = CV_batch_ValidateImage(param);
+	else if (index == 2) status = CV_batch_ValidateRects(param);
+	else if (index == 3) status = CV_batch_ValidateKsize(param, true);
+
+	vxReleaseParameter(&param);
+	return status;
+}
+
+static vx_status VX_CALLBACK CV_Medianblur_batch_Kernel(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+	vx_status status = VX_SUCCESS;
+
+	vx_image image_in = (vx_image) parameters[0];
+	vx_image image_out = (vx_image) parameters[1];
+	vx_array rois = (vx_array) parameters[2];
+	vx_scalar K_size = (vx_scalar) parameters[3];
+
+	int Ksize;
+	vx_int32 value = 0;
+
+	STATUS_ERROR_CHECK(vxReadScalarValue(K_size, &value)); Ksize = value;
+
+	STATUS_ERROR_CHECK(CV_filter_batch_Run(image_in, image_out, rois, [=](const Mat& in, Mat& out) {
+		cv::medianBlur(in, out, Ksize);
+	}));
+
+	return status;
+}
+
+vx_status CV_Medianblur_batch_Register(vx_context context)
+{
+	vx_status status = VX_SUCCESS;
+	vx_kernel kernel = vxAddKernel(context,
+		"org.opencv.medianblur_batch",
+		VX_KERNEL_EXT_CV_MEDIAN_BLUR_BATCH,
+		CV_Medianblur_batch_Kernel,
+		4,
+		CV_Medianblur_batch_InputValidator,
+		CV_filter_batch_OutputValidator,
+		nullptr,
+		nullptr);
+
+	if (kernel)
+	{
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+		PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
+	}
+
+	if (status != VX_SUCCESS)
+	{
+	exit:	vxRemoveKernel(kernel); return VX_FAILURE;
+	}
+
+	return status;
+}
@@ -39,7 +39,7 @@ static vx_status VX_CALLBACK CV_integral_InputValidator(vx_node node, vx_uint32
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U8)
+		if (df_image != VX_DF_IMAGE_U8 && df_image != VX_DF_IMAGE_F32_AMD)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -50,7 +50,7 @@ static vx_status VX_CALLBACK CV_integral_InputValidator(vx_node node, vx_uint32
 		vx_df_image df_image = VX_DF_IMAGE_VIRT;
 		STATUS_ERROR_CHECK(vxQueryParameter(param, VX_PARAMETER_ATTRIBUTE_REF, &image, sizeof(vx_image)));
 		STATUS_ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &df_image, sizeof(df_image)));
-		if (df_image != VX_DF_IMAGE_U32 && df_image != VX_DF_IMAGE_S32)
+		if (df_image != VX_DF_IMAGE_U32 && df_image != VX_DF_IMAGE_S32 && df_image != VX_DF_IMAGE_F32_AMD)
 			status = VX_ERROR_INVALID_VALUE;
 		vxReleaseImage(&image);
 	}
@@ -70,6 +70,42 @@ static vx_status VX_CALLBACK CV_integral_InputValidator(vx_node node, vx_uint32
 	return status;
 }
 
+/************************************************************************************************************
+checks the output format against the sum depth that cv::integral produces for the input format and sdepth:
+sdepth <= 0 gives CV_32S for U8 input and CV_64F otherwise, CV_32S output needs U8 input.
+*************************************************************************************************************/
+static vx_status CV_integral_Check_Depth(vx_node node, vx_df_image format)
+{
+	vx_status status = VX_SUCCESS;
+	vx_parameter input_param = vxGetParameterByIndex(node, 0);
+	vx_parameter scalar_param = vxGetParameterByIndex(node, 2);
+	vx_image input; vx_scalar scalar; vx_df_image input_format = VX_DF_IMAGE_VIRT; vx_int32 sdepth = -1;
+
+	STATUS_ERROR_CHECK(vxQueryParameter(input_param, VX_PARAMETER_ATTRIBUTE_REF, &input, sizeof(vx_image)));
+	STATUS_ERROR_CHECK(vxQueryParameter(scalar_param, VX_PARAMETER_ATTRIBUTE_REF, &scalar, sizeof(vx_scalar)));
+	STATUS_ERROR_CHECK(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+	STATUS_ERROR_CHECK(vxReadScalarValue(scalar, &sdepth));
+
+	if (sdepth <= 0)
+		sdepth = (input_format == VX_DF_IMAGE_U8) ? CV_32S : CV_64F;
+	if (sdepth == CV_32S && input_format != VX_DF_IMAGE_U8)
+		status = VX_ERROR_INVALID_FORMAT;
+	else if (sdepth == CV_32S && format != VX_DF_IMAGE_U32 && format != VX_DF_IMAGE_S32)
+		status = VX_ERROR_INVALID_FORMAT;
+	else if (sdepth == CV_32F && format != VX_DF_IMAGE_F32_AMD)
+		status = VX_ERROR_INVALID_FORMAT;
+	else if (sdepth != CV_32S && sdepth != CV_32F)
+		status = VX_ERROR_INVALID_FORMAT;
+	if (status != VX_SUCCESS)
+		vxAddLogEntry((vx_reference)node, status, "CV_integral ERROR: output format %4.4s does not match sdepth %d\n", &format, sdepth);
+
+	vxReleaseImage(&input);
+	vxReleaseScalar(&scalar);
+	vxReleaseParameter(&input_param);
+	vxReleaseParameter(&scalar_param);
+	return status;
+}
+
 /************************************************************************************************************
 output parameter validator.
 *************************************************************************************************************/
@@ -86,8 +122,10 @@ static vx_status VX_CALLBACK CV_integral_OutputValidator(vx_node node, vx_uint32
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxQueryImage(output, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
 
-		if (format != VX_DF_IMAGE_U32 && format != VX_DF_IMAGE_S32)
+		if (format != VX_DF_IMAGE_U32 && format != VX_DF_IMAGE_S32 && format != VX_DF_IMAGE_F32_AMD)
 			status = VX_ERROR_INVALID_VALUE;
+		else
+			status = CV_integral_Check_Depth(node, format);
 
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
 		STATUS_ERROR_CHECK(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
@@ -47,8 +47,10 @@ vx_status get_kernels_to_publish()
 	Kernel_List = new Kernellist(MAX_KERNELS);
 
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_absdiff_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_absdiff_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_adaptiveThreshold_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_add_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_add_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_AddWeighted_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_bilateralFilter_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_bitwise_and_Register));
@@ -56,6 +58,7 @@ vx_status get_kernels_to_publish()
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_bitwise_or_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_bitwise_xor_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_blur_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_blur_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Boxfilter_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_brisk_compute_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_brisk_detect_Register));
@@ -78,10 +81,12 @@ vx_status get_kernels_to_publish()
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_filter2D_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_flip_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Gaussianblur_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Gaussianblur_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_good_features_to_track_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_integral_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Laplacian_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_MedianBlur_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Medianblur_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_morphologyEx_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_MSER_detect_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_multiply_Register));
@@ -97,6 +102,7 @@ vx_status get_kernels_to_publish()
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_simple_blob_detect_initialize_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_Sobel_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_subtract_Register));
+	STATUS_ERROR_CHECK(ADD_KERENEL(CV_subtract_batch_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_threshold_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_transpose_Register));
 	STATUS_ERROR_CHECK(ADD_KERENEL(CV_warpAffine_Register));
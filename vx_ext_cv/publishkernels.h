@@ -43,8 +43,10 @@ vx_status ADD_KERENEL(std::function<vx_status(vx_context)>);
 vx_status get_kernels_to_publish();
 
 vx_status CV_absdiff_Register(vx_context);
+vx_status CV_absdiff_batch_Register(vx_context);
 vx_status CV_adaptiveThreshold_Register(vx_context);
 vx_status CV_add_Register(vx_context);
+vx_status CV_add_batch_Register(vx_context);
 vx_status CV_AddWeighted_Register(vx_context);
 vx_status CV_bilateralFilter_Register(vx_context);
 vx_status CV_bitwise_and_Register(vx_context);
@@ -52,6 +54,7 @@ vx_status CV_bitwise_not_Register(vx_context);
 vx_status CV_bitwise_or_Register(vx_context);
 vx_status CV_bitwise_xor_Register(vx_context);
 vx_status CV_blur_Register(vx_context);
+vx_status CV_blur_batch_Register(vx_context);
 vx_status CV_Boxfilter_Register(vx_context);
 vx_status CV_brisk_compute_Register(vx_context);
 vx_status CV_brisk_detect_Register(vx_context);
@@ -74,10 +77,12 @@ vx_status CV_fastNlMeansDenoisingColored_Register(vx_context);
 vx_status CV_filter2D_Register(vx_context);
 vx_status CV_flip_Register(vx_context);
 vx_status CV_Gaussianblur_Register(vx_context);
+vx_status CV_Gaussianblur_batch_Register(vx_context);
 vx_status CV_good_features_to_track_Register(vx_context);
 vx_status CV_integral_Register(vx_context);
 vx_status CV_Laplacian_Register(vx_context);
 vx_status CV_MedianBlur_Register(vx_context);
+vx_status CV_Medianblur_batch_Register(vx_context);
 vx_status CV_morphologyEx_Register(vx_context);
 vx_status CV_MSER_detect_Register(vx_context);
 vx_status CV_multiply_Register(vx_context);
@@ -93,6 +98,7 @@ vx_status CV_simple_blob_detect_Register(vx_context);
 vx_status CV_simple_blob_detect_initialize_Register(vx_context);
 vx_status CV_Sobel_Register(vx_context);
 vx_status CV_subtract_Register(vx_context);
+vx_status CV_subtract_batch_Register(vx_context);
 vx_status CV_threshold_Register(vx_context);
 vx_status CV_transpose_Register(vx_context);
 vx_status CV_warpAffine_Register(vx_context);
@@ -180,6 +186,14 @@ vx_status CV_SURF_detect_Register(vx_context);
 #define VX_KERNEL_EXT_CV_countNonZero_NAME					"org.opencv.countnonzero"
 #define VX_KERNEL_EXT_CV_norm_NAME							"org.opencv.norm"
 
+//Batched Nodes
+#define VX_KERNEL_EXT_CV_BLUR_BATCH_NAME					"org.opencv.blur_batch"
+#define VX_KERNEL_EXT_CV_GAUSSIAN_BLUR_BATCH_NAME			"org.opencv.gaussianblur_batch"
+#define VX_KERNEL_EXT_CV_MEDIAN_BLUR_BATCH_NAME				"org.opencv.medianblur_batch"
+#define VX_KERNEL_EXT_CV_ADD_BATCH_NAME						"org.opencv.add_batch"
+#define VX_KERNEL_EXT_CV_SUBTRACT_BATCH_NAME				"org.opencv.subtract_batch"
+#define VX_KERNEL_EXT_CV_ABSDIFF_BATCH_NAME					"org.opencv.absdiff_batch"
+
 
 
 #endif //_AMDVX_EXT__PUBLISH_KERNELS_H_
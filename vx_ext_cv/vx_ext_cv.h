@@ -352,6 +352,36 @@ extern "C" {
 		   */
 		   VX_KERNEL_EXT_CV_CORNER_MIN_EIGEN_VAL = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x202,
 
+		   /*!
+		   * \brief The batched OpenCV blur function kernel. Kernel name is "org.opencv.blur_batch".
+		   */
+		   VX_KERNEL_EXT_CV_BLUR_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x300,
+
+		   /*!
+		   * \brief The batched OpenCV GaussianBlur function kernel. Kernel name is "org.opencv.gaussianblur_batch".
+		   */
+		   VX_KERNEL_EXT_CV_GAUSSIAN_BLUR_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x301,
+
+		   /*!
+		   * \brief The batched OpenCV medianBlur function kernel. Kernel name is "org.opencv.medianblur_batch".
+		   */
+		   VX_KERNEL_EXT_CV_MEDIAN_BLUR_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x302,
+
+		   /*!
+		   * \brief The batched OpenCV add function kernel. Kernel name is "org.opencv.add_batch".
+		   */
+		   VX_KERNEL_EXT_CV_ADD_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x303,
+
+		   /*!
+		   * \brief The batched OpenCV subtract function kernel. Kernel name is "org.opencv.subtract_batch".
+		   */
+		   VX_KERNEL_EXT_CV_SUBTRACT_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x304,
+
+		   /*!
+		   * \brief The batched OpenCV absdiff function kernel. Kernel name is "org.opencv.absdiff_batch".
+		   */
+		   VX_KERNEL_EXT_CV_ABSDIFF_BATCH = VX_KERNEL_BASE(VX_ID_AMD, VX_LIBRARY_EXT_CV) + 0x305,
+
 	};
 
 #ifdef  __cplusplus
@@ -0,0 +1,331 @@
+/*
+Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "loomio_file.h"
+
+//! \brief The raw file camera capture with read-ahead.
+//  - kernel arguments: "<file>[,<rows>,<columns>[,<read-ahead>[,<loop>]]]"
+//      <file>       raw file with consecutive frames of the complete camera buffer, or
+//                   a printf pattern (e.g., "CAM%02d.raw") of raw files with one camera each
+//      <rows>       number of camera rows in the camera buffer (default: 1)
+//      <columns>    number of camera columns in the camera buffer (default: 1)
+//      <read-ahead> number of frames read ahead in the background (default: 4)
+//      <loop>       restart from first frame at end of file: 0:OFF 1:ON (default: 0)
+class CLoomIoFileCapture {
+public:
+	CLoomIoFileCapture();
+	~CLoomIoFileCapture();
+	vx_status Initialize(const char * args, vx_uint32 width, vx_uint32 height, vx_df_image format);
+	vx_status Process(vx_image image, vx_array aux);
+	vx_status Deinitialize();
+
+private:
+	struct frame_slot {
+		std::vector<vx_uint8> buf;
+		vx_uint32 frame;
+		vx_uint64 time;
+	};
+	bool ReadBlock(FILE * fp, vx_uint8 * buf, size_t size, bool first);
+	bool ReadFrame(vx_uint8 * buf);
+	void ReadThread();
+
+	std::vector<FILE *> m_files;
+	vx_uint32 m_width, m_height, m_stride;
+	vx_uint32 m_columns, m_rows;
+	bool m_loop;
+	std::vector<frame_slot> m_slot;
+	size_t m_head, m_filled;
+	bool m_eof, m_abort;
+	vx_uint32 m_framesRead, m_framesProcessed;
+	vx_uint64 m_waitTime;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::thread m_thread;
+};
+
+CLoomIoFileCapture::CLoomIoFileCapture()
+	: m_width(0), m_height(0), m_stride(0), m_columns(1), m_rows(1), m_loop(false),
+	  m_head(0), m_filled(0), m_eof(false), m_abort(false), m_framesRead(0), m_framesProcessed(0), m_waitTime(0)
+{
+}
+
+CLoomIoFileCapture::~CLoomIoFileCapture()
+{
+	Deinitialize();
+}
+
+vx_status CLoomIoFileCapture::Initialize(const char * args, vx_uint32 width, vx_uint32 height, vx_df_image format)
+{
+	// parse kernel arguments
+	std::vector<std::string> argList = LoomIoFileSplitArguments(args);
+	vx_uint32 readAhead = LOOMIO_FILE_DEFAULT_QUEUE_DEPTH;
+	if (argList.size() > 1) m_rows = (vx_uint32)atoi(argList[1].c_str());
+	if (argList.size() > 2) m_columns = (vx_uint32)atoi(argList[2].c_str());
+	if (argList.size() > 3) readAhead = (vx_uint32)atoi(argList[3].c_str());
+	if (argList.size() > 4) m_loop = atoi(argList[4].c_str()) ? true : false;
+	if (argList[0].empty() || m_columns < 1 || m_rows < 1 || m_columns * m_rows > LOOMIO_FILE_MAX_CAMERAS || readAhead < 1 ||
+		(width % m_columns) != 0 || (height % m_rows) != 0)
+	{
+		printf("ERROR: loomio_file.capture: invalid arguments: \"%s\"\n", args);
+		return VX_ERROR_INVALID_PARAMETERS;
+	}
+	m_width = width;
+	m_height = height;
+	m_stride = width * LoomIoFileGetBytesPerPixel(format);
+
+	// open input files: single file with complete camera buffer or one file per camera
+	const char * fileName = argList[0].c_str();
+	vx_uint32 fileCount = strchr(fileName, '%') ? m_columns * m_rows : 1;
+	for (vx_uint32 i = 0; i < fileCount; i++) {
+		char path[1024];
+		snprintf(path, sizeof(path), fileName, i);
+		FILE * fp = fopen(path, "rb");
+		if (!fp) {
+			printf("ERROR: loomio_file.capture: unable to open: %s\n", path);
+			return VX_ERROR_INVALID_PARAMETERS;
+		}
+		m_files.push_back(fp);
+	}
+
+	// allocate read-ahead buffers and start the reader
+	m_slot.resize(readAhead);
+	for (auto& slot : m_slot) {
+		slot.buf.resize((size_t)m_stride * m_height);
+	}
+	m_thread = std::thread(&CLoomIoFileCapture::ReadThread, this);
+
+	return VX_SUCCESS;
+}
+
+vx_status CLoomIoFileCapture::Deinitialize()
+{
+	if (m_thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_abort = true;
+		}
+		m_cv.notify_all();
+		m_thread.join();
+		printf("OK: loomio_file.capture: %d frames processed, %.3f ms/frame waiting for input\n",
+			m_framesProcessed, m_framesProcessed ? (double)m_waitTime * 1e-6 / m_framesProcessed : 0.0);
+	}
+	for (auto fp : m_files) {
+		fclose(fp);
+	}
+	m_files.clear();
+	return VX_SUCCESS;
+}
+
+bool CLoomIoFileCapture::ReadBlock(FILE * fp, vx_uint8 * buf, size_t size, bool first)
+{
+	if (fread(buf, 1, size, fp) == size)
+		return true;
+	// only a read at the start of a frame may restart the file
+	if (!first || !m_loop)
+		return false;
+	fseek(fp, 0L, SEEK_SET);
+	return fread(buf, 1, size, fp) == size;
+}
+
+bool CLoomIoFileCapture::ReadFrame(vx_uint8 * buf)
+{
+	if (m_files.size() == 1) {
+		return ReadBlock(m_files[0], buf, (size_t)m_stride * m_height, true);
+	}
+	// place each camera at its position in the camera buffer
+	vx_uint32 tileStride = m_stride / m_columns, tileHeight = m_height / m_rows;
+	for (vx_uint32 cam = 0; cam < (vx_uint32)m_files.size(); cam++) {
+		vx_uint8 * dst = buf + (size_t)(cam / m_columns) * tileHeight * m_stride + (cam % m_columns) * tileStride;
+		for (vx_uint32 y = 0; y < tileHeight; y++, dst += m_stride) {
+			if (!ReadBlock(m_files[cam], dst, tileStride, y == 0))
+				return false;
+		}
+	}
+	return true;
+}
+
+void CLoomIoFileCapture::ReadThread()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_cv.wait(lock, [&] { return m_abort || m_filled < m_slot.size(); });
+		if (m_abort)
+			break;
+		// the slot after the filled ones is never touched by Process, so read without the lock
+		frame_slot& slot = m_slot[(m_head + m_filled) % m_slot.size()];
+		lock.unlock();
+		bool valid = ReadFrame(slot.buf.data());
+		lock.lock();
+		if (!valid) {
+			m_eof = true;
+			m_cv.notify_all();
+			break;
+		}
+		slot.frame = m_framesRead++;
+		slot.time = LoomIoFileGetTime();
+		m_filled++;
+		m_cv.notify_all();
+	}
+}
+
+vx_status CLoomIoFileCapture::Process(vx_image image, vx_array aux)
+{
+	// wait for the next frame from the reader
+	vx_uint64 t0 = LoomIoFileGetTime();
+	frame_slot * slot = nullptr;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait(lock, [&] { return m_filled > 0 || m_eof; });
+		if (m_filled == 0) {
+			printf("OK: loomio_file.capture: end of input after %d frames\n", m_framesProcessed);
+			return VX_FAILURE;
+		}
+		slot = &m_slot[m_head];
+	}
+	m_waitTime += LoomIoFileGetTime() - t0;
+
+	// copy the frame into the camera image
+	vx_rectangle_t rect = { 0, 0, m_width, m_height };
+	vx_map_id map_id = 0;
+	vx_imagepatch_addressing_t addr = { 0 };
+	vx_uint8 * ptr = nullptr;
+	ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+	for (vx_uint32 y = 0; y < m_height; y++) {
+		memcpy(ptr + (size_t)y * addr.stride_y, slot->buf.data() + (size_t)y * m_stride, m_stride);
+	}
+	ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+
+	// pass frame number and capture time downstream
+	loomio_file_aux_data data = { LOOMIO_FILE_AUX_MAGIC, slot->frame, slot->time, 0 };
+	ERROR_CHECK_STATUS(vxTruncateArray(aux, 0));
+	ERROR_CHECK_STATUS(vxAddArrayItems(aux, sizeof(data), &data, sizeof(vx_uint8)));
+
+	// release the slot to the reader
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_head = (m_head + 1) % m_slot.size();
+		m_filled--;
+	}
+	m_cv.notify_all();
+	m_framesProcessed++;
+
+	return VX_SUCCESS;
+}
+
+//! \brief The input validator callback.
+static vx_status VX_CALLBACK validate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+	if (num != 3)
+		return VX_ERROR_INVALID_PARAMETERS;
+	vx_enum type;
+	ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)parameters[0], VX_SCALAR_TYPE, &type, sizeof(type)));
+	if (type != VX_TYPE_STRING_AMD)
+		return VX_ERROR_INVALID_TYPE;
+	// camera image keeps the configured dimensions and format
+	vx_uint32 width, height;
+	vx_df_image format;
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+	if (LoomIoFileGetBytesPerPixel(format) == 0)
+		return VX_ERROR_INVALID_FORMAT;
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+	// auxiliary data must hold one record
+	vx_enum itemtype;
+	vx_size capacity;
+	ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[2], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+	ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[2], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+	if (itemtype != VX_TYPE_UINT8 || capacity < sizeof(loomio_file_aux_data))
+		return VX_ERROR_INVALID_PARAMETERS;
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[2], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[2], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel initialize.
+static vx_status VX_CALLBACK initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	char args[LOOMIO_FILE_MAX_ARGUMENTS] = { 0 };
+	vx_uint32 width, height;
+	vx_df_image format;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], args));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+	CLoomIoFileCapture * capture = new CLoomIoFileCapture();
+	vx_size size = sizeof(CLoomIoFileCapture);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &capture, sizeof(capture)));
+	ERROR_CHECK_STATUS(capture->Initialize(args, width, height, format));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitialize.
+static vx_status VX_CALLBACK deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(CLoomIoFileCapture)))
+	{
+		CLoomIoFileCapture * capture = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &capture, sizeof(capture)));
+		delete capture;
+	}
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel execution.
+static vx_status VX_CALLBACK host_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_status status = VX_FAILURE;
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(CLoomIoFileCapture)))
+	{
+		CLoomIoFileCapture * capture = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &capture, sizeof(capture)));
+		if (capture) {
+			status = capture->Process((vx_image)parameters[1], (vx_array)parameters[2]);
+		}
+	}
+	return status;
+}
+
+//! \brief The kernel publisher.
+vx_status loomio_file_capture_publish(vx_context context)
+{
+	// add kernel to the context with callbacks
+	vx_kernel kernel = vxAddUserKernel(context, "com.amd.loomio_file.capture", AMDOVX_KERNEL_LOOMIO_FILE_CAPTURE, host_kernel, 3, validate, initialize, deinitialize);
+	ERROR_CHECK_OBJECT(kernel);
+
+	// set kernel parameters
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+
+	// finalize and release kernel object
+	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
+	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+
+	return VX_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/*
+Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "loomio_file.h"
+
+////////////////////////////////////////////////////////////////////////////
+//! \brief The module entry point for publishing kernel.
+SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
+{
+	// register kernels
+	ERROR_CHECK_STATUS(loomio_file_capture_publish(context));
+	ERROR_CHECK_STATUS(loomio_file_output_publish(context));
+	return VX_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////
+//! \brief The module entry point for unpublishing kernel.
+SHARED_PUBLIC vx_status VX_API_CALL vxUnpublishKernels(vx_context context)
+{
+	return VX_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// local utility functions
+
+//! \brief Get current time in nanoseconds.
+vx_uint64 LoomIoFileGetTime()
+{
+	return (vx_uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! \brief Get number of bytes per pixel of the supported interleaved formats (0 if not supported).
+vx_uint32 LoomIoFileGetBytesPerPixel(vx_df_image format)
+{
+	if (format == VX_DF_IMAGE_RGB) return 3;
+	else if (format == VX_DF_IMAGE_RGBX) return 4;
+	else if (format == VX_DF_IMAGE_UYVY || format == VX_DF_IMAGE_YUYV) return 2;
+	return 0;
+}
+
+//! \brief Split comma separated kernel arguments.
+std::vector<std::string> LoomIoFileSplitArguments(const char * args)
+{
+	std::vector<std::string> list;
+	std::string item;
+	for (const char * s = args; ; s++) {
+		if (*s == ',' || *s == '\0') {
+			list.push_back(item);
+			item.clear();
+			if (*s == '\0') break;
+		}
+		else item += *s;
+	}
+	return list;
+}
@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef __LOOMIO_FILE_H__
+#define __LOOMIO_FILE_H__
+
+//////////////////////////////////////////////////////////////////////
+// SHARED_PUBLIC - shared sybols for export
+#if _WIN32
+#define SHARED_PUBLIC extern "C" __declspec(dllexport)
+#else
+#define SHARED_PUBLIC extern "C" __attribute__ ((visibility ("default")))
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// common header files
+#include <VX/vx.h>
+#include <vx_ext_amd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The AMD extension library for file based LoomIO plug-ins
+#define AMDOVX_LIBRARY_LOOMIO_FILE        3
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The LoomIO plug-in limits
+#define LOOMIO_FILE_MAX_ARGUMENTS      1024   // same as LoomIO kernel arguments limit in Live Stitch API
+#define LOOMIO_FILE_MAX_CAMERAS          32
+#define LOOMIO_FILE_DEFAULT_QUEUE_DEPTH   4
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The list of kernels in the file based LoomIO library.
+enum vx_kernel_loomio_file_amd_e {
+	//! \brief The raw file camera capture kernel. Kernel name is "com.amd.loomio_file.capture".
+	AMDOVX_KERNEL_LOOMIO_FILE_CAPTURE = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_LOOMIO_FILE) + 0x001,
+
+	//! \brief The raw file stitched output kernel. Kernel name is "com.amd.loomio_file.output".
+	AMDOVX_KERNEL_LOOMIO_FILE_OUTPUT = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_LOOMIO_FILE) + 0x002,
+};
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The auxiliary data record written by the capture and output kernels.
+//  - timestamps are in nanoseconds from the steady clock of the process
+#define LOOMIO_FILE_AUX_MAGIC          0x46494f4c  // "LOIF"
+struct loomio_file_aux_data {
+	vx_uint32 magic;                  // LOOMIO_FILE_AUX_MAGIC
+	vx_uint32 frame;                  // frame number since start of capture
+	vx_uint64 capture_time;           // time at which the camera frame became available
+	vx_uint64 output_time;            // time at which the stitched frame was queued for writing (0 for capture)
+};
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The module entry point for publishing kernel.
+SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context);
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The kernel registration functions.
+vx_status loomio_file_capture_publish(vx_context context);
+vx_status loomio_file_output_publish(vx_context context);
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The utility functions
+vx_uint64 LoomIoFileGetTime();
+vx_uint32 LoomIoFileGetBytesPerPixel(vx_df_image format);
+std::vector<std::string> LoomIoFileSplitArguments(const char * args);
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The macro for error checking from OpenVX status.
+#define ERROR_CHECK_STATUS(call) { vx_status status = (call); if(status != VX_SUCCESS){ printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status, __LINE__); return status; }}
+//! \brief The macro for error checking from OpenVX object.
+#define ERROR_CHECK_OBJECT(obj)  { vx_status status = vxGetStatus((vx_reference)(obj)); if(status != VX_SUCCESS){ vxAddLogEntry((vx_reference)(obj), status, "ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status, __LINE__); return status; }}
+
+#endif //__LOOMIO_FILE_H__
@@ -0,0 +1,313 @@
+/*
+Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#define _CRT_SECURE_NO_WARNINGS
+#include "loomio_file.h"
+
+//! \brief The raw file stitched output with asynchronous writes.
+//  - kernel arguments: "[<file>][,<queue-depth>]"
+//      <file>        raw file to receive consecutive stitched frames (empty: frames are timed and discarded)
+//      <queue-depth> number of frames queued for the background writer (default: 4)
+//  - end-to-end latency is measured from the capture time in the camera auxiliary data
+//    to completion of the write, when the camera plug-in is com.amd.loomio_file.capture
+class CLoomIoFileOutput {
+public:
+	CLoomIoFileOutput();
+	~CLoomIoFileOutput();
+	vx_status Initialize(const char * args, vx_uint32 width, vx_uint32 height, vx_df_image format);
+	vx_status Process(vx_image image, vx_array cameraAux, vx_array aux);
+	vx_status Deinitialize();
+
+private:
+	struct frame_slot {
+		std::vector<vx_uint8> buf;
+		vx_uint32 frame;
+		vx_uint64 captureTime;
+	};
+	void WriteThread();
+
+	FILE * m_file;
+	vx_uint32 m_width, m_height, m_stride;
+	std::vector<frame_slot> m_slot;
+	size_t m_head, m_filled;
+	bool m_abort;
+	vx_uint32 m_framesProcessed, m_framesWritten, m_latencyCount;
+	vx_uint64 m_waitTime, m_latencySum, m_latencyMax, m_firstWriteTime, m_lastWriteTime;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::thread m_thread;
+};
+
+CLoomIoFileOutput::CLoomIoFileOutput()
+	: m_file(nullptr), m_width(0), m_height(0), m_stride(0), m_head(0), m_filled(0), m_abort(false),
+	  m_framesProcessed(0), m_framesWritten(0), m_latencyCount(0),
+	  m_waitTime(0), m_latencySum(0), m_latencyMax(0), m_firstWriteTime(0), m_lastWriteTime(0)
+{
+}
+
+CLoomIoFileOutput::~CLoomIoFileOutput()
+{
+	Deinitialize();
+}
+
+vx_status CLoomIoFileOutput::Initialize(const char * args, vx_uint32 width, vx_uint32 height, vx_df_image format)
+{
+	// parse kernel arguments
+	std::vector<std::string> argList = LoomIoFileSplitArguments(args);
+	vx_uint32 queueDepth = LOOMIO_FILE_DEFAULT_QUEUE_DEPTH;
+	if (argList.size() > 1) queueDepth = (vx_uint32)atoi(argList[1].c_str());
+	if (queueDepth < 1) {
+		printf("ERROR: loomio_file.output: invalid arguments: \"%s\"\n", args);
+		return VX_ERROR_INVALID_PARAMETERS;
+	}
+	m_width = width;
+	m_height = height;
+	m_stride = width * LoomIoFileGetBytesPerPixel(format);
+
+	// open output file
+	if (!argList[0].empty()) {
+		m_file = fopen(argList[0].c_str(), "wb");
+		if (!m_file) {
+			printf("ERROR: loomio_file.output: unable to create: %s\n", argList[0].c_str());
+			return VX_ERROR_INVALID_PARAMETERS;
+		}
+	}
+
+	// allocate write queue and start the writer
+	m_slot.resize(queueDepth);
+	for (auto& slot : m_slot) {
+		slot.buf.resize((size_t)m_stride * m_height);
+	}
+	m_thread = std::thread(&CLoomIoFileOutput::WriteThread, this);
+
+	return VX_SUCCESS;
+}
+
+vx_status CLoomIoFileOutput::Deinitialize()
+{
+	if (m_thread.joinable()) {
+		// the writer drains the queue before exit
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_abort = true;
+		}
+		m_cv.notify_all();
+		m_thread.join();
+		double seconds = (double)(m_lastWriteTime - m_firstWriteTime) * 1e-9;
+		printf("OK: loomio_file.output: %d frames written, %.2f fps, %.3f ms/frame waiting for writer\n", m_framesWritten,
+			(m_framesWritten > 1 && seconds > 0) ? (m_framesWritten - 1) / seconds : 0.0,
+			m_framesProcessed ? (double)m_waitTime * 1e-6 / m_framesProcessed : 0.0);
+		if (m_latencyCount > 0) {
+			printf("OK: loomio_file.output: capture to output latency: avg %.3f ms max %.3f ms\n",
+				(double)m_latencySum * 1e-6 / m_latencyCount, (double)m_latencyMax * 1e-6);
+		}
+	}
+	if (m_file) {
+		fclose(m_file);
+		m_file = nullptr;
+	}
+	return VX_SUCCESS;
+}
+
+void CLoomIoFileOutput::WriteThread()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_cv.wait(lock, [&] { return m_abort || m_filled > 0; });
+		if (m_filled == 0)
+			break;
+		// the head slot is never touched by Process until released, so write without the lock
+		frame_slot& slot = m_slot[m_head];
+		lock.unlock();
+		if (m_file) {
+			fwrite(slot.buf.data(), 1, slot.buf.size(), m_file);
+		}
+		vx_uint64 t = LoomIoFileGetTime();
+		lock.lock();
+		if (slot.captureTime) {
+			vx_uint64 latency = t - slot.captureTime;
+			m_latencySum += latency;
+			m_latencyMax = std::max(m_latencyMax, latency);
+			m_latencyCount++;
+		}
+		if (m_framesWritten++ == 0)
+			m_firstWriteTime = t;
+		m_lastWriteTime = t;
+		m_head = (m_head + 1) % m_slot.size();
+		m_filled--;
+		m_cv.notify_all();
+	}
+}
+
+vx_status CLoomIoFileOutput::Process(vx_image image, vx_array cameraAux, vx_array aux)
+{
+	// wait for a free slot in the write queue
+	vx_uint64 t0 = LoomIoFileGetTime();
+	frame_slot * slot = nullptr;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cv.wait(lock, [&] { return m_filled < m_slot.size(); });
+		slot = &m_slot[(m_head + m_filled) % m_slot.size()];
+	}
+	m_waitTime += LoomIoFileGetTime() - t0;
+
+	// copy the stitched image into the slot
+	vx_rectangle_t rect = { 0, 0, m_width, m_height };
+	vx_map_id map_id = 0;
+	vx_imagepatch_addressing_t addr = { 0 };
+	vx_uint8 * ptr = nullptr;
+	ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+	for (vx_uint32 y = 0; y < m_height; y++) {
+		memcpy(slot->buf.data() + (size_t)y * m_stride, ptr + (size_t)y * addr.stride_y, m_stride);
+	}
+	ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+
+	// pick up frame number and capture time from the camera plug-in, if available
+	loomio_file_aux_data data = { LOOMIO_FILE_AUX_MAGIC, m_framesProcessed, 0, 0 };
+	vx_size numItems = 0;
+	if (cameraAux) {
+		ERROR_CHECK_STATUS(vxQueryArray(cameraAux, VX_ARRAY_NUMITEMS, &numItems, sizeof(numItems)));
+	}
+	if (numItems >= sizeof(loomio_file_aux_data)) {
+		vx_map_id aux_map_id = 0;
+		vx_size stride = 0;
+		loomio_file_aux_data * cameraData = nullptr;
+		ERROR_CHECK_STATUS(vxMapArrayRange(cameraAux, 0, sizeof(loomio_file_aux_data), &aux_map_id, &stride, (void **)&cameraData, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+		if (cameraData->magic == LOOMIO_FILE_AUX_MAGIC) {
+			data.frame = cameraData->frame;
+			data.capture_time = cameraData->capture_time;
+		}
+		ERROR_CHECK_STATUS(vxUnmapArrayRange(cameraAux, aux_map_id));
+	}
+	data.output_time = LoomIoFileGetTime();
+	ERROR_CHECK_STATUS(vxTruncateArray(aux, 0));
+	ERROR_CHECK_STATUS(vxAddArrayItems(aux, sizeof(data), &data, sizeof(vx_uint8)));
+
+	// queue the frame for the writer
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		slot->frame = data.frame;
+		slot->captureTime = data.capture_time;
+		m_filled++;
+	}
+	m_cv.notify_all();
+	m_framesProcessed++;
+
+	return VX_SUCCESS;
+}
+
+//! \brief The input validator callback.
+static vx_status VX_CALLBACK validate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+	if (num != 4)
+		return VX_ERROR_INVALID_PARAMETERS;
+	vx_enum type;
+	ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)parameters[0], VX_SCALAR_TYPE, &type, sizeof(type)));
+	if (type != VX_TYPE_STRING_AMD)
+		return VX_ERROR_INVALID_TYPE;
+	vx_df_image format;
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+	if (LoomIoFileGetBytesPerPixel(format) == 0)
+		return VX_ERROR_INVALID_FORMAT;
+	// camera auxiliary data is optional; output auxiliary data must hold one record
+	vx_enum itemtype;
+	vx_size capacity;
+	if (parameters[2]) {
+		ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[2], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype != VX_TYPE_UINT8)
+			return VX_ERROR_INVALID_TYPE;
+	}
+	ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[3], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+	ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[3], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+	if (itemtype != VX_TYPE_UINT8 || capacity < sizeof(loomio_file_aux_data))
+		return VX_ERROR_INVALID_PARAMETERS;
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[3], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+	ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[3], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel initialize.
+static vx_status VX_CALLBACK initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	char args[LOOMIO_FILE_MAX_ARGUMENTS] = { 0 };
+	vx_uint32 width, height;
+	vx_df_image format;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], args));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+	CLoomIoFileOutput * output = new CLoomIoFileOutput();
+	vx_size size = sizeof(CLoomIoFileOutput);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &output, sizeof(output)));
+	ERROR_CHECK_STATUS(output->Initialize(args, width, height, format));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitialize.
+static vx_status VX_CALLBACK deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(CLoomIoFileOutput)))
+	{
+		CLoomIoFileOutput * output = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &output, sizeof(output)));
+		delete output;
+	}
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel execution.
+static vx_status VX_CALLBACK host_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_status status = VX_FAILURE;
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(CLoomIoFileOutput)))
+	{
+		CLoomIoFileOutput * output = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &output, sizeof(output)));
+		if (output) {
+			status = output->Process((vx_image)parameters[1], (vx_array)parameters[2], (vx_array)parameters[3]);
+		}
+	}
+	return status;
+}
+
+//! \brief The kernel publisher.
+vx_status loomio_file_output_publish(vx_context context)
+{
+	// add kernel to the context with callbacks
+	vx_kernel kernel = vxAddUserKernel(context, "com.amd.loomio_file.output", AMDOVX_KERNEL_LOOMIO_FILE_OUTPUT, host_kernel, 4, validate, initialize, deinitialize);
+	ERROR_CHECK_OBJECT(kernel);
+
+	// set kernel parameters
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+
+	// finalize and release kernel object
+	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
+	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+
+	return VX_SUCCESS;
+}
@@ -94,13 +94,54 @@ static vx_status VX_CALLBACK color_convert_output_validator(vx_node node, vx_uin
 	return status;
 }
 
+//! \brief The host target selection shared by color_convert, warp, merge, simple_remap, and exposure comp.
+vx_uint32 StitchGetColorKernelTargetAffinity()
+{
+	char textBuffer[256];
+	int STITCH_HOST_TARGET = 0;
+	if (StitchGetEnvironmentVariable("STITCH_HOST_TARGET", textBuffer, sizeof(textBuffer))) { STITCH_HOST_TARGET = atoi(textBuffer); }
+	return STITCH_HOST_TARGET ? AGO_TARGET_AFFINITY_CPU : AGO_TARGET_AFFINITY_GPU;
+}
+
+//! \brief Get the packed 4:2:2 YUV to RGB conversion parameters of an UYVY or YUYV image.
+vx_status StitchGetYuvToRgbParams(vx_image image, StitchYuvToRgbParams& params)
+{
+	vx_df_image format = VX_DF_IMAGE_VIRT;
+	vx_channel_range_e channel_range;
+	vx_color_space_e color_space;
+	ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+	ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_RANGE, &channel_range, sizeof(channel_range)));
+	ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_SPACE, &color_space, sizeof(color_space)));
+	if (color_space == VX_COLOR_SPACE_BT601_525 || color_space == VX_COLOR_SPACE_BT601_625) {
+		params.cRv = 1.4030f; params.cGu = -0.3440f; params.cGv = -0.7140f; params.cBu = 1.7730f;
+	}
+	else { // VX_COLOR_SPACE_BT709
+		params.cRv = 1.5748f; params.cGu = -0.1873f; params.cGv = -0.4681f; params.cBu = 1.8556f;
+	}
+	if (channel_range == VX_CHANNEL_RANGE_RESTRICTED) {
+		params.r2f[0] = 256.0f / 219.0f; params.r2f[1] = -16.0f * 256.0f / 219.0f;
+		params.r2f[2] = 256.0f / 224.0f; params.r2f[3] = -128.0f * 256.0f / 224.0f;
+	}
+	else { // VX_CHANNEL_RANGE_FULL
+		params.r2f[0] = 1.0f; params.r2f[1] = 0.0f; params.r2f[2] = 1.0f; params.r2f[3] = -128.0f;
+	}
+	if (format == VX_DF_IMAGE_UYVY) {
+		params.posU = 0; params.posY0 = 1; params.posV = 2; params.posY1 = 3;
+	}
+	else if (format == VX_DF_IMAGE_YUYV) {
+		params.posY0 = 0; params.posU = 1; params.posY1 = 2; params.posV = 3;
+	}
+	else return VX_ERROR_INVALID_FORMAT;
+	return VX_SUCCESS;
+}
+
 //! \brief The kernel target support callback.
 static vx_status VX_CALLBACK color_convert_query_target_support(vx_graph graph, vx_node node,
 	vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = StitchGetColorKernelTargetAffinity();
 	return VX_SUCCESS;
 }
 
@@ -584,7 +625,56 @@ static vx_status VX_CALLBACK color_convert_opencl_codegen(
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK color_convert_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	// host implementation: 8-bit packed 4:2:2 and RGB formats at same scale only
+	vx_image input_image = (vx_image)parameters[0];
+	vx_image output_image = (vx_image)parameters[1];
+	vx_uint32 input_width = 0, input_height = 0, output_width = 0, output_height = 0;
+	vx_df_image input_format = VX_DF_IMAGE_VIRT, output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	if (input_width != output_width || input_height != output_height || input_format == VX_DF_IMAGE_Y210_AMD || input_format == VX_DF_IMAGE_Y216_AMD)
+		return VX_ERROR_NOT_SUPPORTED;
+	StitchYuvToRgbParams yuv;
+	if (input_format != VX_DF_IMAGE_RGB) {
+		ERROR_CHECK_STATUS(StitchGetYuvToRgbParams(input_image, yuv));
+	}
+
+	vx_rectangle_t rect = { 0, 0, input_width, input_height };
+	vx_imagepatch_addressing_t input_addr, output_addr;
+	void * input_ptr = nullptr, * output_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+	vx_int32 pairs = (vx_int32)(input_width >> 1);
+	#pragma omp parallel for
+	for (vx_int32 y = 0; y < (vx_int32)input_height; y++) {
+		const vx_uint8 * src = (const vx_uint8 *)input_ptr + y * input_addr.stride_y;
+		vx_uint8 * dst = (vx_uint8 *)output_ptr + y * output_addr.stride_y;
+		if (input_format == VX_DF_IMAGE_RGB) {
+			for (vx_int32 x = 0; x < pairs; x++, src += 6, dst += 4) {
+				vx_float32 rgb0[3] = { (vx_float32)src[0], (vx_float32)src[1], (vx_float32)src[2] };
+				vx_float32 rgb1[3] = { (vx_float32)src[3], (vx_float32)src[4], (vx_float32)src[5] };
+				StitchRgbToYuvPair(output_format, rgb0, rgb1, dst);
+			}
+		}
+		else {
+			vx_uint32 pixel_size = (output_format == VX_DF_IMAGE_RGBX) ? 4 : 3;
+			for (vx_int32 x = 0; x < pairs; x++, src += 4) {
+				for (vx_uint32 odd = 0; odd < 2; odd++, dst += pixel_size) {
+					vx_float32 rgb[3];
+					StitchYuvToRgb(yuv, src, odd, rgb);
+					dst[0] = StitchClampToU8(rgb[0]); dst[1] = StitchClampToU8(rgb[1]); dst[2] = StitchClampToU8(rgb[2]);
+					if (pixel_size == 4) dst[3] = StitchClampToU8(src[odd ? yuv.posY1 : yuv.posY0] * yuv.r2f[0] + yuv.r2f[1]);
+				}
+			}
+		}
+	}
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &rect, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &rect, 0, &output_addr, output_ptr));
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
@@ -26,6 +26,59 @@ THE SOFTWARE.
 
 #include "kernels.h"
 
+//////////////////////////////////////////////////////////////////////
+//! \brief Round and saturate a float to an 8-bit pixel value.
+inline vx_uint8 StitchClampToU8(vx_float32 v)
+{
+	return (vx_uint8)std::min(std::max(v + 0.5f, 0.0f), 255.0f);
+}
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The packed 4:2:2 YUV to RGB conversion parameters.
+//  The same values are used by color_convert, and by warp when it reads UYVY/YUYV directly.
+typedef struct {
+	vx_float32 r2f[4];     // range scaling: Y = Y * r2f[0] + r2f[1], U/V = U/V * r2f[2] + r2f[3]
+	vx_float32 cRv;        // R = Y + cRv * V
+	vx_float32 cGu, cGv;   // G = Y + cGu * U + cGv * V
+	vx_float32 cBu;        // B = Y + cBu * U
+	vx_uint32  posY0, posU, posY1, posV; // byte positions within a pixel pair
+} StitchYuvToRgbParams;
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The host target selection for kernels that have host implementations.
+//  Set environment variable STITCH_HOST_TARGET=1 to run color_convert, warp, merge, simple_remap, and the exposure comp kernels on the CPU.
+vx_uint32 StitchGetColorKernelTargetAffinity();
+
+//////////////////////////////////////////////////////////////////////
+//! \brief Get the packed 4:2:2 YUV to RGB conversion parameters of an UYVY or YUYV image.
+vx_status StitchGetYuvToRgbParams(vx_image image, StitchYuvToRgbParams& params);
+
+//! \brief Convert a pixel of a packed 4:2:2 pixel pair to RGB (clamped to 0..255).
+inline void StitchYuvToRgb(const StitchYuvToRgbParams& params, const vx_uint8 * pair, vx_uint32 odd, vx_float32 rgb[3])
+{
+	vx_float32 y = pair[odd ? params.posY1 : params.posY0] * params.r2f[0] + params.r2f[1];
+	vx_float32 u = pair[params.posU] * params.r2f[2] + params.r2f[3];
+	vx_float32 v = pair[params.posV] * params.r2f[2] + params.r2f[3];
+	rgb[0] = std::min(std::max(y + params.cRv * v, 0.0f), 255.0f);
+	rgb[1] = std::min(std::max(y + params.cGu * u + params.cGv * v, 0.0f), 255.0f);
+	rgb[2] = std::min(std::max(y + params.cBu * u, 0.0f), 255.0f);
+}
+
+//! \brief Convert two RGB pixels into a packed 4:2:2 pixel pair (BT.709 full range, chroma from the even pixel).
+inline void StitchRgbToYuvPair(vx_df_image format, const vx_float32 rgb0[3], const vx_float32 rgb1[3], vx_uint8 pair[4])
+{
+	vx_float32 y0 = 0.2126f * rgb0[0] + 0.7152f * rgb0[1] + 0.0722f * rgb0[2];
+	vx_float32 y1 = 0.2126f * rgb1[0] + 0.7152f * rgb1[1] + 0.0722f * rgb1[2];
+	vx_float32 u = -0.1146f * rgb0[0] - 0.3854f * rgb0[1] + 0.5f * rgb0[2] + 128.0f;
+	vx_float32 v = 0.5f * rgb0[0] - 0.4542f * rgb0[1] - 0.0458f * rgb0[2] + 128.0f;
+	if (format == VX_DF_IMAGE_UYVY) {
+		pair[0] = StitchClampToU8(u); pair[1] = StitchClampToU8(y0); pair[2] = StitchClampToU8(v); pair[3] = StitchClampToU8(y1);
+	}
+	else {
+		pair[0] = StitchClampToU8(y0); pair[1] = StitchClampToU8(u); pair[2] = StitchClampToU8(y1); pair[3] = StitchClampToU8(v);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 //! \brief The kernel registration functions.
 vx_status color_convert_publish(vx_context context);
@@ -88,6 +88,27 @@ inline vx_uint32 count_nz_mean_double(vx_uint32 *p, vx_uint32 *q, uint32_t strid
 	return cnt;
 }
 
+inline vx_uint32 count_nz_mean_double_rgb(vx_uint32 *p, vx_uint32 *q, uint32_t stride, int width, int height, uint32_t psum[3], uint32_t qsum[3])
+{
+	vx_uint32 cnt = 0, sum1[3] = { 0, 0, 0 }, sum2[3] = { 0, 0, 0 };
+	for (int i = 0; i < height; i++){
+		for (int j = 0; j < width; j++){
+			if ((p[j] != 0x80000000) && (q[j] != 0x80000000)){
+				sum1[0] += (p[j] & 0xFF), sum1[1] += ((p[j] >> 8) & 0xFF), sum1[2] += ((p[j] >> 16) & 0xFF);
+				sum2[0] += (q[j] & 0xFF), sum2[1] += ((q[j] >> 8) & 0xFF), sum2[2] += ((q[j] >> 16) & 0xFF);
+				cnt++;
+			}
+		}
+		p += stride;
+		q += stride;
+	}
+	for (int c = 0; c < 3; c++){
+		psum[c] += sum1[c];
+		qsum[c] += sum2[c];
+	}
+	return cnt;
+}
+
 inline vx_uint32 count_nz_mean_double_32x32(vx_uint32 *p, vx_uint32 *q, uint32_t stride, uint32_t *psum, uint32_t *qsum)
 {
 	vx_uint32 cnt = 0, sum1 = 0, sum2 = 0;
@@ -279,6 +300,48 @@ static vx_status VX_CALLBACK exposure_compensation_input_validator(vx_node node,
 			status = VX_SUCCESS;
 		}
 	}
+	else if (index == 5)
+	{ // object of SCALAR type: sample stride (same as LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE)
+		vx_enum itemtype = VX_TYPE_INVALID;
+		vx_uint32 sample_stride = 0;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype == VX_TYPE_UINT32) {
+			ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)ref, &sample_stride));
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+		if (itemtype != VX_TYPE_UINT32) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation sample stride scalar type should be a UINT32\n");
+		}
+		else if (sample_stride < 1 || sample_stride > 16) {
+			status = VX_ERROR_INVALID_VALUE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation sample stride should be in range [1..16]\n");
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+	}
+	else if (index == 6)
+	{ // object of SCALAR type: number of gains per image (1 or 3, same as LIVE_STITCH_ATTR_EXPCOMP_RGB_GAINS 0 or 1)
+		vx_enum itemtype = VX_TYPE_INVALID;
+		vx_uint32 num_channels = 0;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype == VX_TYPE_UINT32) {
+			ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)ref, &num_channels));
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+		if (itemtype != VX_TYPE_UINT32) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation gain channels scalar type should be a UINT32\n");
+		}
+		else if (num_channels != 1 && num_channels != 3) {
+			status = VX_ERROR_INVALID_VALUE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation gain channels should be 1 or 3\n");
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+	}
 	return status;
 }
 
@@ -309,6 +372,7 @@ static vx_status VX_CALLBACK exposure_compensation_output_validator(vx_node node
 static vx_status VX_CALLBACK exposure_compensation_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 	vx_float32 alpha = 0, beta = 0;
+	vx_uint32 sample_stride = 1, num_channels = 1;
 	vx_size size = sizeof(CExpCompensator);
 	vx_image img_in, img_out;
 	CExpCompensator* exp_comp = new CExpCompensator();
@@ -320,9 +384,11 @@ static vx_status VX_CALLBACK exposure_compensation_initialize(vx_node node, cons
 	ERROR_CHECK_STATUS(vxReadScalarValue(scalar, &alpha));
 	scalar = (vx_scalar)parameters[1];
 	ERROR_CHECK_STATUS(vxReadScalarValue(scalar, &beta));
+	if (parameters[5]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[5], &sample_stride));
+	if (parameters[6]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[6], &num_channels));
 	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
 	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &exp_comp, sizeof(exp_comp)))
-		ERROR_CHECK_STATUS(exp_comp->Initialize(node, alpha, beta, arr, img_in, img_out));
+		ERROR_CHECK_STATUS(exp_comp->Initialize(node, alpha, beta, arr, img_in, img_out, sample_stride, num_channels));
 	return VX_SUCCESS;
 }
 
@@ -367,7 +433,7 @@ vx_status exposure_compensation_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.exposure_compensation_model",
 		AMDOVX_KERNEL_STITCHING_EXPOSURE_COMPENSATION_MODEL,
 		exposure_compensation_kernel,
-		5,
+		7,
 		exposure_compensation_input_validator,
 		exposure_compensation_output_validator,
 		exposure_compensation_initialize,
@@ -380,6 +446,8 @@ vx_status exposure_compensation_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
 	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
@@ -394,6 +462,8 @@ CExpCompensator::CExpCompensator()
 	m_IMat = nullptr;
 	m_AMat = nullptr;
 	m_Gains = nullptr;
+	m_sampleStride = 1;
+	m_numChannels = 1;
 }
 
 CExpCompensator::~CExpCompensator()
@@ -401,7 +471,7 @@ CExpCompensator::~CExpCompensator()
 
 }
 
-vx_status CExpCompensator::Initialize(vx_node node, vx_float32 alpha, vx_float32 beta, vx_array valid_roi, vx_image input, vx_image output)
+vx_status CExpCompensator::Initialize(vx_node node, vx_float32 alpha, vx_float32 beta, vx_array valid_roi, vx_image input, vx_image output, vx_uint32 sample_stride, vx_uint32 num_channels)
 {
 	vx_uint32 i, blockgains_bufsize;
 	vx_size capacity;
@@ -421,6 +491,8 @@ vx_status CExpCompensator::Initialize(vx_node node, vx_float32 alpha, vx_float32
 	blockgains_bufsize = m_blockgainsStride*((m_height + 31) >> 5);
 	m_alpha = alpha, m_beta = beta;
 	m_InputImage = input, m_OutputImage = output;
+	m_sampleStride = std::max(sample_stride, 1u);
+	m_numChannels = (num_channels == 3) ? 3 : 1;
 
 	// initialize ROI based buffers
 	vx_size		stride = 0;
@@ -456,16 +528,18 @@ vx_status CExpCompensator::Initialize(vx_node node, vx_float32 alpha, vx_float32
 	}
 	// allocate N, I A and B arrays
 	m_NMat = new vx_uint32*[m_numImages];
-	m_IMat = new vx_uint32*[m_numImages];
+	m_IMat = new vx_uint32*[m_numChannels*m_numImages];
 	m_AMat = new vx_float64*[m_numImages];
-	m_Gains = new vx_float32[m_numImages];
+	m_Gains = new vx_float32[m_numChannels*m_numImages];
 	for (i = 0; i < m_numImages; i++){
 		m_NMat[i] = new vx_uint32[m_numImages];
-		m_IMat[i] = new vx_uint32[m_numImages];
 		m_AMat[i] = new vx_float64[m_numImages + 1];	// enough for the augmented matrix [a|b]
 		memset(&m_AMat[i][0], 0, (m_numImages + 1)*sizeof(vx_float64));
 	}
-	memset(&m_Gains[0], 0x00000001, m_numImages*sizeof(vx_float32));
+	for (i = 0; i < m_numChannels*m_numImages; i++){
+		m_IMat[i] = new vx_uint32[m_numImages];
+	}
+	memset(&m_Gains[0], 0x00000001, m_numChannels*m_numImages*sizeof(vx_float32));
 	m_node = node;
 	return VX_SUCCESS;
 
@@ -479,9 +553,12 @@ vx_status CExpCompensator::DeInitialize()
 		if (m_pblockgainInfo[i].block_gain_buf)
 			delete[] m_pblockgainInfo[i].block_gain_buf;
 		if (m_NMat[i]) delete[] m_NMat[i];
-		if (m_IMat[i]) delete[] m_IMat[i];
 		if (m_AMat[i]) delete[] m_AMat[i];
 	}
+	for (int i = 0; i < (int)(m_numChannels*m_numImages); i++)
+	{
+		if (m_IMat[i]) delete[] m_IMat[i];
+	}
 	delete m_pblockgainInfo;
 	delete m_NMat;
 	delete m_IMat;
@@ -513,22 +590,30 @@ vx_status CExpCompensator::CompensateGains()
 	m_stride = addr.stride_y;
 	m_stride_x = addr.stride_x;
 
-	vx_uint32 nz, ISum, JSum;
+	// overlaps are sampled every m_sampleStride rows: the gains only depend on the mean intensities
+	// with m_numChannels = 3, the mean R, G, B intensities go to separate blocks of m_IMat rows
+	vx_uint32 nz, ISum[3], JSum[3];
+	vx_uint32 row_stride = (m_stride >> 2) * m_sampleStride;
 	for (i = 0; i < (int)m_numImages; i++){
-		m_IMat[i][i] = 0; m_NMat[i][i] = 0;
+		for (int c = 0; c < (int)m_numChannels; c++)
+			m_IMat[c*m_numImages + i][i] = 0;
+		m_NMat[i][i] = 0;
 		for (int j = i+1; j < (int)m_numImages; j++){
-			ISum = 0, JSum = 0, nz = 0;
+			memset(ISum, 0, sizeof(ISum)), memset(JSum, 0, sizeof(JSum)), nz = 0;
 			if (m_pRoi_rect[i][j].start_x != -1)	{ // if intersect
 				// find the i,j intersect rect
 				if (i == j){
 					vx_uint32 *pI = (vx_uint32 *)(base_ptr + (m_height*i + m_pRoi_rect[i][j].start_y)*m_stride + (m_pRoi_rect[i][j].start_x*m_stride_x));
-					nz += count_nz_mean_single(pI, (m_stride >> 2), (m_pRoi_rect[i][j].end_x - m_pRoi_rect[i][j].start_x), (m_pRoi_rect[i][j].end_y - m_pRoi_rect[i][j].start_y), &ISum);
+					nz += count_nz_mean_single(pI, row_stride, (m_pRoi_rect[i][j].end_x - m_pRoi_rect[i][j].start_x), (m_pRoi_rect[i][j].end_y - m_pRoi_rect[i][j].start_y + m_sampleStride - 1) / m_sampleStride, &ISum[0]);
 				}
 				else
 				{
 					vx_uint32 *pI = (vx_uint32 *)(base_ptr + (m_height*i + m_pRoi_rect[i][j].start_y)*m_stride + (m_pRoi_rect[i][j].start_x*m_stride_x));
 					vx_uint32 *pJ = (vx_uint32 *)(base_ptr + (m_height*j + m_pRoi_rect[i][j].start_y)*m_stride + (m_pRoi_rect[i][j].start_x*m_stride_x));
-					nz += count_nz_mean_double(pI, pJ, (m_stride >> 2), (m_pRoi_rect[i][j].end_x - m_pRoi_rect[i][j].start_x), (m_pRoi_rect[i][j].end_y - m_pRoi_rect[i][j].start_y), &ISum, &JSum);
+					if (m_numChannels == 3)
+						nz += count_nz_mean_double_rgb(pI, pJ, row_stride, (m_pRoi_rect[i][j].end_x - m_pRoi_rect[i][j].start_x), (m_pRoi_rect[i][j].end_y - m_pRoi_rect[i][j].start_y + m_sampleStride - 1) / m_sampleStride, ISum, JSum);
+					else
+						nz += count_nz_mean_double(pI, pJ, row_stride, (m_pRoi_rect[i][j].end_x - m_pRoi_rect[i][j].start_x), (m_pRoi_rect[i][j].end_y - m_pRoi_rect[i][j].start_y + m_sampleStride - 1) / m_sampleStride, &ISum[0], &JSum[0]);
 				}
 			}
 			nz = std::max(nz, (vx_uint32)1);
@@ -538,25 +623,17 @@ vx_status CExpCompensator::CompensateGains()
 			}
 			else
 			{
-				m_IMat[i][j] = ISum / nz;
-				m_IMat[j][i] = JSum / nz;
+				for (int c = 0; c < (int)m_numChannels; c++){
+					m_IMat[c*m_numImages + i][j] = ISum[c] / nz;
+					m_IMat[c*m_numImages + j][i] = JSum[c] / nz;
+				}
 				m_NMat[i][j] = m_NMat[j][i] = nz;
 			}
 		}
 	}
-	// generate augmented matrix[A/b] for solving gains
-	for (int i = 0; i < (int)m_numImages; i++){
-		for (int j = 0; j < (int)m_numImages; ++j) {
-			m_AMat[i][m_numImages] += m_beta * m_NMat[i][j];		// b matrix
-			m_AMat[i][i] += m_beta * m_NMat[i][j];
-			if (j == i)			continue;
-			m_AMat[i][i] += 2 * m_alpha * m_IMat[i][j] * m_IMat[i][j] * m_NMat[i][j];
-			m_AMat[i][j] -= 2 * m_alpha * m_IMat[i][j] * m_IMat[j][i] * m_NMat[i][j];
-		}
-	}
-
-	//solve the linear equation A*gains_ = B
-	solve_gauss(m_AMat, m_Gains, m_numImages);
+	// solve gains of each channel: all channels share the overlap pixel counts
+	for (int c = 0; c < (int)m_numChannels; c++)
+		solve_channel_gains(&m_IMat[c*m_numImages], &m_Gains[c*m_numImages]);
 	// Apply gains to all images
 	status = ApplyGains(base_ptr);
 	// commit image patch
@@ -567,11 +644,41 @@ vx_status CExpCompensator::CompensateGains()
 	return VX_SUCCESS;
 }
 
+// generate augmented matrix[A/b] of one channel and solve the linear equation A*gains_ = B
+void CExpCompensator::solve_channel_gains(vx_uint32 **IMat, vx_float32 *gains)
+{
+	for (int i = 0; i < (int)m_numImages; i++){
+		memset(&m_AMat[i][0], 0, (m_numImages + 1)*sizeof(vx_float64));
+	}
+	for (int i = 0; i < (int)m_numImages; i++){
+		for (int j = 0; j < (int)m_numImages; ++j) {
+			m_AMat[i][m_numImages] += m_beta * m_NMat[i][j];		// b matrix
+			m_AMat[i][i] += m_beta * m_NMat[i][j];
+			if (j == i)			continue;
+			m_AMat[i][i] += 2 * m_alpha * IMat[i][j] * IMat[i][j] * m_NMat[i][j];
+			m_AMat[i][j] -= 2 * m_alpha * IMat[i][j] * IMat[j][i] * m_NMat[i][j];
+		}
+	}
+	solve_gauss(m_AMat, gains, m_numImages);
+}
+
 vx_status CExpCompensator::SolveForGains(vx_float32 alpha, vx_float32 beta, vx_uint32 *pIMat, vx_uint32 *pNMat, vx_uint32 num_images, vx_array Gains_arr, vx_uint32 rows, vx_uint32 cols)
+{
+	vx_float32 *gains = new vx_float32[num_images];
+	vx_status status = SolveForGains(alpha, beta, pIMat, pNMat, num_images, gains, rows, cols);
+	if (status == VX_SUCCESS)
+		status = vxTruncateArray(Gains_arr, 0);
+	if (status == VX_SUCCESS)
+		status = vxAddArrayItems(Gains_arr, num_images, gains, sizeof(vx_float32));
+	delete[] gains;
+	return status;
+}
+
+// solve gains of one channel: pIMat and pNMat are rows x cols matrices of intensity sums and overlap pixel counts
+vx_status CExpCompensator::SolveForGains(vx_float32 alpha, vx_float32 beta, vx_uint32 *pIMat, vx_uint32 *pNMat, vx_uint32 num_images, vx_float32 *gains, vx_uint32 rows, vx_uint32 cols)
 {
 	unsigned int i, N = rows*cols;
 	m_numImages = num_images;
-	float *gains = new float[num_images];
 
 	// normalize intensity 
 	for (i = 0; i < N; i++){
@@ -598,9 +705,6 @@ vx_status CExpCompensator::SolveForGains(vx_float32 alpha, vx_float32 beta, vx_u
 		}
 	}
 	solve_gauss(m_AMat, gains, m_numImages);
-	ERROR_CHECK_STATUS(vxTruncateArray(Gains_arr, 0));
-	ERROR_CHECK_STATUS(vxAddArrayItems(Gains_arr, m_numImages, gains, sizeof(float)));
-	delete gains;
 	for (i = 0; i < (int)num_images; i++){
 		delete m_AMat[i];
 	}
@@ -688,11 +792,17 @@ vx_status CExpCompensator::applygains_thread_func(vx_int32 img_num, char *in_bas
 	vx_uint32 *pRGB = (vx_uint32 *)(in_base_addr + (img_num*m_height + mValidRect[img_num].start_y)*m_stride + (mValidRect[img_num].start_x*m_stride_x));
 	vx_uint32 *pDst = (vx_uint32 *)(base_ptr + mValidRect[img_num].start_y*addr.stride_y + mValidRect[img_num].start_x*addr.stride_x);
 	float g_y = m_Gains[img_num];
-	float g_r = g_y, g_g = g_y, g_b = g_y;	// todo: check if we need to apply gain factor for RGB
+	float g_r = g_y, g_g = g_y, g_b = g_y;
+	if (m_numChannels == 3) {
+		// per-channel gains: luma is left as is, same as exposure_comp_apply_gains
+		g_g = m_Gains[m_numImages + img_num];
+		g_b = m_Gains[2 * m_numImages + img_num];
+		g_y = 1.0f;
+	}
 	// todo:: if we do the following code in CPU, need to optimize using SSE
 	for (int i = 0; i < height; i++){
 		for (int j = 0; j < width; j++){
-			// apply gain only to valid pixels : todo: multiply with approapriate gain factors for R, G and B
+			// apply gain only to valid pixels
 			if (pRGB[j] != 0x80000000){
 				uint8_t *p = (uint8_t *)&pRGB[j];
 				uint8_t *d = (uint8_t *)&pDst[j];
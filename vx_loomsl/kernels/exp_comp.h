@@ -42,23 +42,26 @@ public:
 	CExpCompensator();
 	virtual ~CExpCompensator();
 	virtual vx_status Process();
-	virtual vx_status Initialize(vx_node node, vx_float32 alpha, vx_float32 beta, vx_array valid_roi, vx_image input, vx_image output);
+	virtual vx_status Initialize(vx_node node, vx_float32 alpha, vx_float32 beta, vx_array valid_roi, vx_image input, vx_image output, vx_uint32 sample_stride = 1, vx_uint32 num_channels = 1);
 	virtual vx_status DeInitialize();
 	virtual vx_status SolveForGains(vx_float32 alpha, vx_float32 beta, vx_uint32 *IMat, vx_uint32 *NMat, vx_uint32 num_images, vx_array pGains, vx_uint32 rows, vx_uint32 cols);
+	virtual vx_status SolveForGains(vx_float32 alpha, vx_float32 beta, vx_uint32 *IMat, vx_uint32 *NMat, vx_uint32 num_images, vx_float32 *pGains, vx_uint32 rows, vx_uint32 cols);
 
 protected:
 	vx_uint32	m_numImages;
 	vx_node		m_node;
 	vx_uint32	m_width, m_height, m_stride,m_stride_x;
 	vx_uint32   m_blockgainsStride;
+	vx_uint32   m_sampleStride;			// use every Nth row of the overlaps for the gain statistics
+	vx_uint32   m_numChannels;			// 1: one luma gain per image, 3: R, G, B gains per image
 	vx_float32	m_alpha, m_beta;
 	vx_image	m_InputImage, m_OutputImage;
 	vx_array	m_valid_roi;
 	vx_rectangle_t m_pRoi_rect[MAX_NUM_IMAGES_IN_STITCHED_OUTPUT][MAX_NUM_IMAGES_IN_STITCHED_OUTPUT];	// assuming 
 	block_gain_info *m_pblockgainInfo;
-	vx_uint32 **m_NMat, **m_IMat;
+	vx_uint32 **m_NMat, **m_IMat;		// m_IMat has m_numChannels*m_numImages rows: one block of rows per channel
 	vx_float64 **m_AMat;
-	vx_float32 *m_Gains;
+	vx_float32 *m_Gains;				// m_numChannels*m_numImages gains: R gains of all images, followed by G and B gains
 	vx_rectangle_t mValidRect[MAX_NUM_IMAGES_IN_STITCHED_OUTPUT];
 
 // functions
@@ -67,6 +70,7 @@ protected:
 
 private:
 	void solve_gauss(vx_float64 **A, vx_float32* g, int num);
+	void solve_channel_gains(vx_uint32 **IMat, vx_float32 *gains);
 	vx_status applygains_thread_func(vx_int32 img_num, char *in_base_addr);
 };
 
@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
 #include "exposure_compensation.h"
+#include "color_convert.h"
 
 //! \brief The input validator callback.
 static vx_status VX_CALLBACK exposure_comp_calcErrorFn_input_validator(vx_node node, vx_uint32 index)
@@ -78,6 +79,40 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_input_validator(vx_node n
 		}
 		ERROR_CHECK_STATUS(vxReleaseArray((vx_array *)&ref));
 	}
+	else if (index == 5 || index == 6 || index == 7)
+	{ // object of SCALAR type: current frame, update interval, and stagger flag
+		vx_enum itemtype = VX_TYPE_INVALID;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+		if (itemtype == VX_TYPE_UINT32) {
+			status = VX_SUCCESS;
+		}
+		else {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp update schedule scalar type should be a UINT32\n");
+		}
+	}
+	else if (index == 8)
+	{ // object of SCALAR type: sample stride
+		vx_enum itemtype = VX_TYPE_INVALID;
+		vx_uint32 sample_stride = 0;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype == VX_TYPE_UINT32) {
+			ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)ref, &sample_stride));
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+		if (itemtype != VX_TYPE_UINT32) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp sample stride scalar type should be a UINT32\n");
+		}
+		else if (sample_stride < 1 || sample_stride > 16) {
+			status = VX_ERROR_INVALID_VALUE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp sample stride should be in range [1..16]\n");
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+	}
 	else if (index == 3)
 	{ // image of format U008
 		if (ref){
@@ -133,14 +168,245 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_query_target_support(vx_g
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	char textBuffer[256];
+	int EXPCOMP_TARGET = 0;
+	if (StitchGetEnvironmentVariable("EXPCOMP_TARGET", textBuffer, sizeof(textBuffer))) { EXPCOMP_TARGET = atoi(textBuffer); }
+
+	if (!EXPCOMP_TARGET)
+		supported_target_affinity = StitchGetColorKernelTargetAffinity();
+	else
+		supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+
 	return VX_SUCCESS;
 }
 
+//! \brief The luma (or R, G, B) sums of both cameras over one 128x32 overlap block (must match exposure_comp_calc_errorfn).
+//  - the block is processed in 8x2 pixel cells: a cell is used if it starts inside the block
+//    and its row is a multiple of sample_stride
+//  - a pixel is used if it is valid in both cameras and (with mask) the mask of both cameras is set
+//  - with num_channels = 3, sumI[0..2] and sumJ[0..2] are the R, G, B sums, otherwise sumI[0] and sumJ[0] are luma sums
+//  - with SSE2, four pixels are summed per step (the block width is a multiple of 8 pixels)
+#if defined(__SSE2__) || defined(_M_X64)
+static inline vx_uint32 exposure_comp_hsum_epi32(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+	return (vx_uint32)_mm_cvtsi128_si32(v);
+}
+
+static void exposure_comp_calc_block_sums(const StitchOverlapPixelEntry& entry,
+	const vx_uint8 * in_buf, vx_uint32 in_stride, vx_size in_cam_size,
+	const vx_uint8 * wt_buf, vx_uint32 wt_stride, vx_size wt_cam_size,
+	vx_uint32 sample_stride, vx_uint32 num_channels, vx_uint32 sumI[3], vx_uint32 sumJ[3])
+{
+	vx_uint32 width = ((entry.end_x + 7) >> 3) << 3;
+	vx_uint32 height = ((entry.end_y + 1) >> 1) << 1;
+	const vx_uint8 * pI = in_buf + in_cam_size * entry.camId0 + entry.start_y * in_stride + (entry.start_x << 2);
+	const vx_uint8 * pJ = in_buf + in_cam_size * entry.camId1 + entry.start_y * in_stride + (entry.start_x << 2);
+	const vx_uint8 * pWI = wt_buf ? wt_buf + wt_cam_size * entry.camId0 + entry.start_y * wt_stride + entry.start_x : nullptr;
+	const vx_uint8 * pWJ = wt_buf ? wt_buf + wt_cam_size * entry.camId1 + entry.start_y * wt_stride + entry.start_x : nullptr;
+	const __m128i invalid = _mm_set1_epi32((int)0x80000000);
+	const __m128i byte_mask = _mm_set1_epi32(0xff);
+	const __m128i wt_bit = _mm_set1_epi32(0x80);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i sI0 = zero, sI1 = zero, sI2 = zero, sJ0 = zero, sJ1 = zero, sJ2 = zero;
+	for (vx_uint32 y = 0; y < height; y++) {
+		if ((y >> 1) % sample_stride)
+			continue;
+		const __m128i * I = (const __m128i *)(pI + y * in_stride);
+		const __m128i * J = (const __m128i *)(pJ + y * in_stride);
+		const vx_uint8 * WI = pWI ? pWI + y * wt_stride : nullptr;
+		const vx_uint8 * WJ = pWJ ? pWJ + y * wt_stride : nullptr;
+		for (vx_uint32 x = 0; x < width; x += 4) {
+			__m128i pixI = _mm_loadu_si128(I++);
+			__m128i pixJ = _mm_loadu_si128(J++);
+			// skip = all ones for the pixels that are not used
+			__m128i skip = _mm_or_si128(_mm_cmpeq_epi32(pixI, invalid), _mm_cmpeq_epi32(pixJ, invalid));
+			if (WI) {
+				vx_uint32 wI, wJ;
+				memcpy(&wI, WI + x, sizeof(wI));
+				memcpy(&wJ, WJ + x, sizeof(wJ));
+				__m128i w = _mm_cvtsi32_si128((int)(wI & wJ));
+				w = _mm_unpacklo_epi16(_mm_unpacklo_epi8(w, zero), zero);
+				skip = _mm_or_si128(skip, _mm_cmpeq_epi32(_mm_and_si128(w, wt_bit), zero));
+			}
+			pixI = _mm_andnot_si128(skip, pixI);
+			pixJ = _mm_andnot_si128(skip, pixJ);
+			if (num_channels == 3) {
+				sI0 = _mm_add_epi32(sI0, _mm_and_si128(pixI, byte_mask));
+				sI1 = _mm_add_epi32(sI1, _mm_and_si128(_mm_srli_epi32(pixI, 8), byte_mask));
+				sI2 = _mm_add_epi32(sI2, _mm_and_si128(_mm_srli_epi32(pixI, 16), byte_mask));
+				sJ0 = _mm_add_epi32(sJ0, _mm_and_si128(pixJ, byte_mask));
+				sJ1 = _mm_add_epi32(sJ1, _mm_and_si128(_mm_srli_epi32(pixJ, 8), byte_mask));
+				sJ2 = _mm_add_epi32(sJ2, _mm_and_si128(_mm_srli_epi32(pixJ, 16), byte_mask));
+			}
+			else {
+				sI0 = _mm_add_epi32(sI0, _mm_srli_epi32(pixI, 24));
+				sJ0 = _mm_add_epi32(sJ0, _mm_srli_epi32(pixJ, 24));
+			}
+		}
+	}
+	sumI[0] = exposure_comp_hsum_epi32(sI0);
+	sumJ[0] = exposure_comp_hsum_epi32(sJ0);
+	if (num_channels == 3) {
+		sumI[1] = exposure_comp_hsum_epi32(sI1); sumI[2] = exposure_comp_hsum_epi32(sI2);
+		sumJ[1] = exposure_comp_hsum_epi32(sJ1); sumJ[2] = exposure_comp_hsum_epi32(sJ2);
+	}
+}
+#else
+static void exposure_comp_calc_block_sums(const StitchOverlapPixelEntry& entry,
+	const vx_uint8 * in_buf, vx_uint32 in_stride, vx_size in_cam_size,
+	const vx_uint8 * wt_buf, vx_uint32 wt_stride, vx_size wt_cam_size,
+	vx_uint32 sample_stride, vx_uint32 num_channels, vx_uint32 sumI[3], vx_uint32 sumJ[3])
+{
+	vx_uint32 width = ((entry.end_x + 7) >> 3) << 3;
+	vx_uint32 height = ((entry.end_y + 1) >> 1) << 1;
+	const vx_uint8 * pI = in_buf + in_cam_size * entry.camId0 + entry.start_y * in_stride + (entry.start_x << 2);
+	const vx_uint8 * pJ = in_buf + in_cam_size * entry.camId1 + entry.start_y * in_stride + (entry.start_x << 2);
+	const vx_uint8 * pWI = wt_buf ? wt_buf + wt_cam_size * entry.camId0 + entry.start_y * wt_stride + entry.start_x : nullptr;
+	const vx_uint8 * pWJ = wt_buf ? wt_buf + wt_cam_size * entry.camId1 + entry.start_y * wt_stride + entry.start_x : nullptr;
+	if (num_channels == 3) {
+		vx_uint32 sI[3] = { 0, 0, 0 }, sJ[3] = { 0, 0, 0 };
+		for (vx_uint32 y = 0; y < height; y++) {
+			if ((y >> 1) % sample_stride)
+				continue;
+			const vx_uint32 * I = (const vx_uint32 *)(pI + y * in_stride);
+			const vx_uint32 * J = (const vx_uint32 *)(pJ + y * in_stride);
+			const vx_uint8 * WI = pWI ? pWI + y * wt_stride : nullptr;
+			const vx_uint8 * WJ = pWJ ? pWJ + y * wt_stride : nullptr;
+			for (vx_uint32 x = 0; x < width; x++) {
+				vx_uint32 valid = (vx_uint32)((I[x] != 0x80000000) & (J[x] != 0x80000000));
+				if (WI) valid &= (WI[x] & WJ[x]) >> 7;
+				vx_uint32 mask = 0u - valid;
+				vx_uint32 pixI = I[x] & mask, pixJ = J[x] & mask;
+				sI[0] += pixI & 0xff; sI[1] += (pixI >> 8) & 0xff; sI[2] += (pixI >> 16) & 0xff;
+				sJ[0] += pixJ & 0xff; sJ[1] += (pixJ >> 8) & 0xff; sJ[2] += (pixJ >> 16) & 0xff;
+			}
+		}
+		for (vx_uint32 c = 0; c < 3; c++) {
+			sumI[c] = sI[c];
+			sumJ[c] = sJ[c];
+		}
+		return;
+	}
+	vx_uint32 sI = 0, sJ = 0;
+	for (vx_uint32 y = 0; y < height; y++) {
+		if ((y >> 1) % sample_stride)
+			continue;
+		const vx_uint32 * I = (const vx_uint32 *)(pI + y * in_stride);
+		const vx_uint32 * J = (const vx_uint32 *)(pJ + y * in_stride);
+		if (pWI) {
+			const vx_uint8 * WI = pWI + y * wt_stride;
+			const vx_uint8 * WJ = pWJ + y * wt_stride;
+			for (vx_uint32 x = 0; x < width; x++) {
+				vx_uint32 mask = 0u - (vx_uint32)((I[x] != 0x80000000) & (J[x] != 0x80000000) & ((WI[x] & WJ[x]) >> 7));
+				sI += (I[x] & mask) >> 24;
+				sJ += (J[x] & mask) >> 24;
+			}
+		}
+		else {
+			for (vx_uint32 x = 0; x < width; x++) {
+				vx_uint32 mask = 0u - (vx_uint32)((I[x] != 0x80000000) & (J[x] != 0x80000000));
+				sI += (I[x] & mask) >> 24;
+				sJ += (J[x] & mask) >> 24;
+			}
+		}
+	}
+	sumI[0] = sI;
+	sumJ[0] = sJ;
+}
+#endif
+
 //! \brief The kernel execution.
+//  - same as the GPU kernel: the block sums (scaled by sample_stride/16) are added to the A_matrix running sums
+//  - with per-channel gains, A_matrix has 3*num_cameras rows: one num_cameras x num_cameras block for each of R, G, B
+//  - each thread accumulates into a local partial matrix, which is merged into a shared one at the end of the loop
 static vx_status VX_CALLBACK exposure_comp_calcErrorFn_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	vx_uint32 num_cameras = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &num_cameras));
+	vx_image input = (vx_image)parameters[1];
+	vx_array exp_data = (vx_array)parameters[2];
+	vx_image mask_image = (vx_image)parameters[3];
+	vx_matrix mat = (vx_matrix)parameters[4];
+	vx_size columns = 0, rows = 0, num_entries = 0;
+	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_COLUMNS, &columns, sizeof(columns)));
+	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_ROWS, &rows, sizeof(rows)));
+	ERROR_CHECK_STATUS(vxQueryArray(exp_data, VX_ARRAY_ATTRIBUTE_NUMITEMS, &num_entries, sizeof(num_entries)));
+	if (!num_cameras || num_cameras > rows || num_cameras > columns)
+		return VX_ERROR_INVALID_DIMENSION;
+	vx_uint32 num_channels = (rows == 3 * num_cameras) ? 3 : 1;
+
+	// get the optional update schedule: pairs are only accumulated on their phase frame of the interval
+	vx_uint32 current_frame = 0, interval = 1, stagger = 0;
+	if (parameters[5]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[5], &current_frame));
+	if (parameters[6]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[6], &interval));
+	if (parameters[7]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[7], &stagger));
+	if (interval < 1) interval = 1;
+	vx_uint32 phase = current_frame % interval;
+	vx_uint32 sample_stride = 1;
+	if (parameters[8]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[8], &sample_stride));
+	if (sample_stride < 1) sample_stride = 1;
+	bool scheduled = (interval == 1);
+	for (vx_uint32 i = 0; !scheduled && i < num_cameras; i++)
+		for (vx_uint32 j = i + 1; !scheduled && j < num_cameras; j++)
+			scheduled = (exposure_comp_pair_phase(i, j, interval, stagger) == phase);
+	if (!num_entries || !scheduled)
+		return VX_SUCCESS;
+
+	// access input images and table
+	vx_uint32 width = 0, height = 0;
+	ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	vx_uint32 height_one = height / num_cameras;
+	vx_rectangle_t rect = { 0, 0, width, height };
+	vx_imagepatch_addressing_t in_addr = { 0 }, wt_addr = { 0 };
+	vx_uint8 * in_buf = nullptr, * wt_buf = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input, &rect, 0, &in_addr, (void **)&in_buf, VX_READ_ONLY));
+	if (mask_image) {
+		ERROR_CHECK_STATUS(vxAccessImagePatch(mask_image, &rect, 0, &wt_addr, (void **)&wt_buf, VX_READ_ONLY));
+	}
+	vx_size stride = 0;
+	StitchOverlapPixelEntry * entries = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(exp_data, 0, num_entries, &stride, (void **)&entries, VX_READ_ONLY));
+
+	// accumulate block sums into per-thread partial matrices
+	vx_size count = rows * columns;
+	std::vector<vx_uint32> partial(count, 0);
+	vx_size in_cam_size = (vx_size)in_addr.stride_y * height_one;
+	vx_size wt_cam_size = (vx_size)wt_addr.stride_y * height_one;
+	#pragma omp parallel
+	{
+		std::vector<vx_uint32> sums(count, 0);
+		#pragma omp for schedule(dynamic, 16)
+		for (vx_int32 k = 0; k < (vx_int32)num_entries; k++) {
+			const StitchOverlapPixelEntry& entry = vxArrayItem(StitchOverlapPixelEntry, entries, k, stride);
+			if (interval > 1 && exposure_comp_pair_phase(entry.camId0, entry.camId1, interval, stagger) != phase)
+				continue;
+			vx_uint32 sumI[3], sumJ[3];
+			exposure_comp_calc_block_sums(entry, in_buf, in_addr.stride_y, in_cam_size, wt_buf, wt_addr.stride_y, wt_cam_size, sample_stride, num_channels, sumI, sumJ);
+			for (vx_uint32 c = 0; c < num_channels; c++) {
+				sums[(c * num_cameras + entry.camId0) * columns + entry.camId1] += (sumI[c] * sample_stride) >> 4;
+				sums[(c * num_cameras + entry.camId1) * columns + entry.camId0] += (sumJ[c] * sample_stride) >> 4;
+			}
+		}
+		#pragma omp critical
+		for (vx_size i = 0; i < count; i++)
+			partial[i] += sums[i];
+	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(exp_data, 0, num_entries, entries));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input, &rect, 0, &in_addr, in_buf));
+	if (mask_image) {
+		ERROR_CHECK_STATUS(vxCommitImagePatch(mask_image, &rect, 0, &wt_addr, wt_buf));
+	}
+
+	// add the partial matrix to the A_matrix running sums (modulo 2^32, same as atomic_add on the GPU)
+	std::vector<vx_uint32> AMat(count);
+	ERROR_CHECK_STATUS(vxReadMatrix(mat, &AMat[0]));
+	for (vx_size i = 0; i < count; i++)
+		AMat[i] += partial[i];
+	ERROR_CHECK_STATUS(vxWriteMatrix(mat, &AMat[0]));
+	return VX_SUCCESS;
 }
 
 //! \brief The OpenCL global work updater callback.
@@ -199,6 +465,10 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 	vx_array exp_data = (vx_array)avxGetNodeParamRef(node, 2);
 	ERROR_CHECK_STATUS(vxQueryArray(exp_data, VX_ARRAY_ATTRIBUTE_CAPACITY, &arr_size, sizeof(arr_size)));
 	ERROR_CHECK_STATUS(vxReleaseArray(&exp_data));
+	vx_size rows = 0;
+	vx_matrix mat = (vx_matrix)avxGetNodeParamRef(node, 4);
+	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_ROWS, &rows, sizeof(rows)));
+	ERROR_CHECK_STATUS(vxReleaseMatrix(&mat));
 	vx_image mask_image = (vx_image)avxGetNodeParamRef(node, 3);
 	if (mask_image != NULL){
 		ERROR_CHECK_STATUS(vxQueryImage(mask_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
@@ -206,6 +476,48 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 		ERROR_CHECK_STATUS(vxQueryImage(mask_image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
 	}
 
+	// optional update schedule: overlaps are only accumulated on their update frames
+	//   the phase of an overlap is 0 without stagger, otherwise a hash of the camera pair
+	vx_scalar s_current_frame = (vx_scalar)avxGetNodeParamRef(node, 5);
+	std::string kernel_args, schedule_check;
+	if (s_current_frame) {
+		ERROR_CHECK_STATUS(vxReleaseScalar(&s_current_frame));
+		kernel_args = ", uint current_frame, uint update_interval, uint stagger";
+		schedule_check =
+			"	if (update_interval > 1) {\n"
+			"		uint2 pair = (uint2)((offs.s0 & 0x1f), ((offs.s1>>12) & 0x1f));\n"
+			"		uint phase = stagger ? ((min(pair.s0, pair.s1) * 32 + max(pair.s0, pair.s1)) % update_interval) : 0;\n"
+			"		if ((current_frame % update_interval) != phase) return;\n"
+			"	}\n";
+	}
+
+	// optional sample stride: only every Nth row of 8x2 cells is used and the block sums are scaled by N
+	vx_uint32 sample_stride = 1;
+	vx_scalar s_sample_stride = (vx_scalar)avxGetNodeParamRef(node, 8);
+	if (s_sample_stride) {
+		ERROR_CHECK_STATUS(vxReadScalarValue(s_sample_stride, &sample_stride));
+		ERROR_CHECK_STATUS(vxReleaseScalar(&s_sample_stride));
+		kernel_args += ", uint sample_stride";
+	}
+	char text[128];
+	std::string sample_check, sample_add;
+	if (sample_stride > 1) {
+		sprintf(text, " && ((ly %% %d) == 0)", sample_stride);
+		sample_check = text;
+	}
+	sprintf(text, "			atomic_add(&pAMat[idx1], (int)(s1*%.4ff));\n", sample_stride * 0.0625);
+	sample_add = text;
+
+	// per-channel gains: A_matrix has a num_cameras x num_cameras block for each of R, G, B and
+	//   each work-item keeps the (R, G, B, Y) sums of its cell instead of the luma sums of its 4 columns
+	bool rgb_gains = (rows == 3 * num_cameras);
+	const char * sum_defs = rgb_gains ?
+		"#define ACCUM_SUMS(sum, pix, mask) pix &= as_uint4(as_int4(mask) >> 31); "
+		"sum += convert_uint4(as_uchar4(pix.s0)) + convert_uint4(as_uchar4(pix.s1)) + convert_uint4(as_uchar4(pix.s2)) + convert_uint4(as_uchar4(pix.s3))\n"
+		"#define CELL_SUMS(sum) (sum)\n" :
+		"#define ACCUM_SUMS(sum, pix, mask) sum += (pix & mask) >> 24\n"
+		"#define CELL_SUMS(sum) (sum.s0 + sum.s1 + sum.s2 + sum.s3)\n";
+
 	// set kernel configuration
 	vx_uint32 height_one = (vx_uint32)(input_height / num_cameras);
 	strcpy(opencl_kernel_function_name, "exposure_comp_calc_errorfn_mask");
@@ -220,31 +532,36 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 		sprintf(item,
 			"#pragma OPENCL EXTENSION cl_amd_media_ops : enable\n"
 			"#pragma OPENCL EXTENSION cl_amd_media_ops2 : enable\n"
+			"%s"
 			"__attribute__((reqd_work_group_size(%d, %d, 1)))\n"
 			"__kernel void %s(uint num_cameras,\n" // opencl_kernel_function_name
 			"			uint	pIn_width, uint	pIn_height, __global uchar *pIn_buf, uint pIn_stride, uint	pIn_offs,\n"
 			"			__global uchar * exp_data, uint	exp_data_offs, uint exp_data_num,\n"
 			"			uint	pWt_width, uint	pWt_height, __global uchar *pWt_buf, uint pWt_stride, uint	pWt_offs,\n"
-			"			__global int * pAMat, uint cols, uint rows)\n"
+			"			__global int * pAMat, uint cols, uint rows%s)\n" // kernel_args
 			"{\n"
 			"	int grp_id = get_global_id(0)>>4;\n"
 			"   if (grp_id < exp_data_num) {\n"
-			"	__local uint  sumI[256], sumJ[256];\n"
+			"	__local %s  sumI[256], sumJ[256];\n"
 			"	uint2 offs = ((__global uint2 *)(exp_data+exp_data_offs))[grp_id];\n"
 			"	uint size = (uint)(pIn_stride*%d);\n"
 			"	uint wt_size = (uint)(pWt_stride*%d);\n"
-			, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, height_one, height_one);
+			, sum_defs, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, kernel_args.c_str(), rgb_gains ? "uint4" : "uint", height_one, height_one);
 		opencl_kernel_code = item;
+		opencl_kernel_code += schedule_check;
 		opencl_kernel_code +=
 			"	int lx = get_local_id(0);\n"
 			"	int ly = get_local_id(1);\n"
 			"	int lid = mad24(ly, (int)get_local_size(0), lx);\n"
 			"   sumI[lid] = 0; sumJ[lid] = 0;\n"
-			"	bool isValid = ((lx<<3) < (int)(offs.s1&0x7f)) && (ly*2 < (int)((offs.s1>>7)&0x1f));\n"
+			"	bool isValid = ((lx<<3) < (int)(offs.s1&0x7f)) && (ly*2 < (int)((offs.s1>>7)&0x1f))";
+		opencl_kernel_code += sample_check;
+		opencl_kernel_code +=
+			";\n"
 			"	if (isValid) {\n"
 			"		global uint *pI, *pJ;\n"
 			"		uint4 maskSrc, I, J, mask; \n"
-			"		uint4 Isum4, Jsum4;\n"
+			"		uint4 Isum4 = (uint4)0, Jsum4 = (uint4)0;\n"
 			"		int   gx = (lx<<3) + ((offs.s0 >> 5) & 0x3FFF);\n"
 			"		int   gy = (ly<<1) + (offs.s0 >> 19);\n"
 			"		uint2 cam_id = (uint2)((offs.s0 & 0x1f), ((offs.s1>>12) & 0x1f));\n"
@@ -263,7 +580,7 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000))) & (int)maskIJ.s1;\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000))) & (int)maskIJ.s2;\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000))) & (int)maskIJ.s3;\n"
-			"		Isum4	= (I&mask)>>24; Jsum4 = (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		I = vload4(1, pI);\n"
 			"		J = vload4(1, pJ); \n"
 			"		maskIJ = as_char4(maskSrc.s1);\n"
@@ -271,7 +588,7 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000))) & (int)maskIJ.s1;\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000))) & (int)maskIJ.s2;\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000))) & (int)maskIJ.s3;\n"
-			"		Isum4	+= (I&mask)>>24; Jsum4 += (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		pI += (pIn_stride>>2); pJ += (pIn_stride>>2);\n"
 			"		I = vload4(0, pI);\n"
 			"		J = vload4(0, pJ); \n"
@@ -280,7 +597,7 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000))) & (int)maskIJ.s1;\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000))) & (int)maskIJ.s2;\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000))) & (int)maskIJ.s3;\n"
-			"		Isum4	+= (I&mask)>>24; Jsum4 += (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		I = vload4(1, pI); \n"
 			"		J = vload4(1, pJ); \n"
 			"		maskIJ = as_char4(maskSrc.s3);\n"
@@ -288,9 +605,9 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000))) & (int)maskIJ.s1;\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000))) & (int)maskIJ.s2;\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000))) & (int)maskIJ.s3;\n"
-			"		Isum4 += ((I&mask) >> 24); Jsum4 += ((J & mask) >> 24); \n"
-			"		sumI[lid] = mad24(Isum4.s3, (uint)1, mad24(Isum4.s2, (uint)1, mad24(Isum4.s1, (uint)1, Isum4.s0)));\n"
-			"		sumJ[lid] = mad24(Jsum4.s3, (uint)1, mad24(Jsum4.s2, (uint)1, mad24(Jsum4.s1, (uint)1, Jsum4.s0)));\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
+			"		sumI[lid] = CELL_SUMS(Isum4);\n"
+			"		sumJ[lid] = CELL_SUMS(Jsum4);\n"
 			"		barrier(CLK_LOCAL_MEM_FENCE);\n";
 	}
 	else
@@ -298,29 +615,34 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 		sprintf(item,
 			"#pragma OPENCL EXTENSION cl_amd_media_ops : enable\n"
 			"#pragma OPENCL EXTENSION cl_amd_media_ops2 : enable\n"
+			"%s"
 			"__attribute__((reqd_work_group_size(%d, %d, 1)))\n"
 			"__kernel void %s(uint num_cameras,\n" // opencl_kernel_function_name
 			"			uint	pIn_width, uint	pIn_height, __global uchar *pIn_buf, uint pIn_stride, uint	pIn_offs,\n"
 			"			__global uchar * exp_data, uint	exp_data_offs, uint exp_data_num,\n"
-			"			__global int * pAMat, uint cols, uint rows)\n"
+			"			__global int * pAMat, uint cols, uint rows%s)\n" // kernel_args
 			"{\n"
 			"	int grp_id = get_global_id(0)>>4;\n"
 			"   if (grp_id < exp_data_num) {\n"
-			"	__local uint  sumI[256], sumJ[256];\n"
+			"	__local %s  sumI[256], sumJ[256];\n"
 			"	uint2 offs = ((__global uint2 *)(exp_data+exp_data_offs))[grp_id];\n"
 			"	uint size = (uint)(pIn_stride*%d);\n"
-			, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, height_one);
+			, sum_defs, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, kernel_args.c_str(), rgb_gains ? "uint4" : "uint", height_one);
 		opencl_kernel_code = item;
+		opencl_kernel_code += schedule_check;
 		opencl_kernel_code +=
 			"	int lx = get_local_id(0);\n"
 			"	int ly = get_local_id(1);\n"
 			"	int lid = mad24(ly, (int)get_local_size(0), lx);\n"
 			"   sumI[lid] = 0; sumJ[lid] = 0;\n"
-			"	bool isValid = ((lx<<3) < (int)(offs.s1&0x7f)) && (ly*2 < (int)((offs.s1>>7)&0x1f));\n"
+			"	bool isValid = ((lx<<3) < (int)(offs.s1&0x7f)) && (ly*2 < (int)((offs.s1>>7)&0x1f))";
+		opencl_kernel_code += sample_check;
+		opencl_kernel_code +=
+			";\n"
 			"	if (isValid) {\n"
 			"		global uint *pI, *pJ;\n"
 			"		uint4  I, J, mask; \n"
-			"		uint4 Isum4, Jsum4;\n"
+			"		uint4 Isum4 = (uint4)0, Jsum4 = (uint4)0;\n"
 			"		int   gx = (lx<<3) + ((offs.s0 >> 5) & 0x3FFF);\n"
 			"		int   gy = (ly<<1) + (offs.s0 >> 19);\n"
 			"		uint2 cam_id = (uint2)((offs.s0 & 0x1f), ((offs.s1>>12) & 0x1f));\n"
@@ -333,14 +655,14 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000)));\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000)));\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000)));\n"
-			"		Isum4	= (I&mask)>>24; Jsum4 = (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		I = vload4(1, pI);\n"
 			"		J = vload4(1, pJ);\n"
 			"		mask.s0	= select(0xff000000, 0u, ((I.s0==0x80000000) | (J.s0==0x80000000)));\n"
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000)));\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000)));\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000)));\n"
-			"		Isum4	+= (I&mask)>>24; Jsum4 += (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		pI += (pIn_stride>>2); pJ += (pIn_stride>>2);\n"
 			"		I = vload4(0, pI);\n"
 			"		J = vload4(0, pJ); \n"
@@ -348,16 +670,16 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000)));\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000)));\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000)));\n"
-			"		Isum4	+= (I&mask)>>24; Jsum4 += (J & mask)>>24;\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
 			"		I = vload4(1, pI); \n"
 			"		J = vload4(1, pJ); \n"
 			"		mask.s0	= select(0xff000000, 0u, ((I.s0==0x80000000) | (J.s0==0x80000000)));\n"
 			"		mask.s1	= select(0xff000000, 0u, ((I.s1==0x80000000) | (J.s1==0x80000000)));\n"
 			"		mask.s2	= select(0xff000000, 0u, ((I.s2==0x80000000) | (J.s2==0x80000000)));\n"
 			"		mask.s3	= select(0xff000000, 0u, ((I.s3==0x80000000) | (J.s3==0x80000000)));\n"
-			"		Isum4 += ((I&mask) >> 24); Jsum4 += ((J & mask) >> 24); \n"
-			"		sumI[lid] = mad24(Isum4.s3, (uint)1, mad24(Isum4.s2, (uint)1, mad24(Isum4.s1, (uint)1, Isum4.s0)));\n"
-			"		sumJ[lid] = mad24(Jsum4.s3, (uint)1, mad24(Jsum4.s2, (uint)1, mad24(Jsum4.s1, (uint)1, Jsum4.s0)));\n"
+			"		ACCUM_SUMS(Isum4, I, mask); ACCUM_SUMS(Jsum4, J, mask);\n"
+			"		sumI[lid] = CELL_SUMS(Isum4);\n"
+			"		sumJ[lid] = CELL_SUMS(Jsum4);\n"
 			"		barrier(CLK_LOCAL_MEM_FENCE);\n";
 	}
 	opencl_kernel_code +=
@@ -393,20 +715,37 @@ static vx_status VX_CALLBACK exposure_comp_calcErrorFn_opencl_codegen(
 		"			sumI[lid]	+= sumI[lid+8];\n"
 		"			sumJ[lid]	+= sumJ[lid+8];\n"
 		"		}\n"
-		"		barrier(CLK_LOCAL_MEM_FENCE);\n"
-		"		uint idx1, s1; uint4 t1;\n"
-		"		if (!lid)\n"
-		"		{\n"
-		"			idx1 = mad24(cam_id.x, cols, cam_id.y);\n"
-		"			t1 = ((local uint4*)sumI)[0] + ((local uint4*)sumI)[1];\n"
-		"			s1 = t1.s0 + t1.s1 + t1.s2 + t1.s3;\n"
-		"			atomic_add(&pAMat[idx1], (int)(s1*0.0625f));\n"
-		"		}\n"
-		"		else if (lid == 1){\n"
-		"			idx1 = mad24(cam_id.y, cols, cam_id.x);\n"
-		"			t1 = ((local uint4*)sumJ)[0] + ((local uint4*)sumJ)[1];\n"
-		"			s1 = t1.s0 + t1.s1 + t1.s2 + t1.s3;\n"
-		"			atomic_add(&pAMat[idx1], (int)(s1*0.0625f));\n"
+		"		barrier(CLK_LOCAL_MEM_FENCE);\n";
+	if (rgb_gains) {
+		opencl_kernel_code +=
+			"		if (lid < 6)\n"
+			"		{\n"
+			"			uint c = (lid < 3) ? lid : lid - 3;\n"
+			"			uint idx1 = (lid < 3) ? mad24(cam_id.x, cols, cam_id.y) : mad24(cam_id.y, cols, cam_id.x);\n"
+			"			idx1 = mad24(c * num_cameras, cols, idx1);\n"
+			"			local uint4 * sums = (lid < 3) ? sumI : sumJ;\n"
+			"			uint4 t1 = sums[0] + sums[1] + sums[2] + sums[3] + sums[4] + sums[5] + sums[6] + sums[7];\n"
+			"			uint s1 = (c == 0) ? t1.s0 : ((c == 1) ? t1.s1 : t1.s2);\n";
+		opencl_kernel_code += sample_add;
+	}
+	else {
+		opencl_kernel_code +=
+			"		uint idx1, s1; uint4 t1;\n"
+			"		if (!lid)\n"
+			"		{\n"
+			"			idx1 = mad24(cam_id.x, cols, cam_id.y);\n"
+			"			t1 = ((local uint4*)sumI)[0] + ((local uint4*)sumI)[1];\n"
+			"			s1 = t1.s0 + t1.s1 + t1.s2 + t1.s3;\n";
+		opencl_kernel_code += sample_add;
+		opencl_kernel_code +=
+			"		}\n"
+			"		else if (lid == 1){\n"
+			"			idx1 = mad24(cam_id.y, cols, cam_id.x);\n"
+			"			t1 = ((local uint4*)sumJ)[0] + ((local uint4*)sumJ)[1];\n"
+			"			s1 = t1.s0 + t1.s1 + t1.s2 + t1.s3;\n";
+		opencl_kernel_code += sample_add;
+	}
+	opencl_kernel_code +=
 		"		}\n"
 		"	}\n"
 		"	}\n"
@@ -422,7 +761,7 @@ vx_status exposure_comp_calcErrorFn_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.expcomp_compute_gainmatrix",
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_COMPUTE_GAINMAT,
 		exposure_comp_calcErrorFn_kernel,
-		5,
+		9,
 		exposure_comp_calcErrorFn_input_validator,
 		exposure_comp_calcErrorFn_output_validator,
 		nullptr,
@@ -441,6 +780,10 @@ vx_status exposure_comp_calcErrorFn_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_OPTIONAL));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_OUTPUT, VX_TYPE_MATRIX, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 8, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
 	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
@@ -463,7 +806,13 @@ static vx_status VX_CALLBACK exposure_comp_applygains_input_validator(vx_node no
 		vx_size capacity = 0;
 		ERROR_CHECK_STATUS(vxQueryArray(arr, VX_ARRAY_ATTRIBUTE_CAPACITY, &capacity, sizeof(capacity)));
 		ERROR_CHECK_STATUS(vxReleaseArray(&arr));
-		vx_uint32 numCameras = (vx_uint32)capacity;
+		vx_uint32 num_channels = 1;
+		vx_scalar s_num_channels = (vx_scalar)avxGetNodeParamRef(node, 4);
+		if (s_num_channels) {
+			ERROR_CHECK_STATUS(vxReadScalarValue(s_num_channels, &num_channels));
+			ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_channels));
+		}
+		vx_uint32 numCameras = (vx_uint32)capacity / std::max(num_channels, 1u);
 		// check input image format and dimensions
 		vx_uint32 input_width = 0, input_height = 0;
 		vx_df_image input_format = VX_DF_IMAGE_VIRT;
@@ -475,7 +824,7 @@ static vx_status VX_CALLBACK exposure_comp_applygains_input_validator(vx_node no
 			status = VX_ERROR_INVALID_TYPE;
 			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation doesn't support input image format: %4.4s\n", &input_format);
 		}
-		else if ((input_height % numCameras) != 0) {
+		else if (!numCameras || (input_height % numCameras) != 0) {
 			status = VX_ERROR_INVALID_DIMENSION;
 			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation invalid input image dimensions: %dx%d (height should be multiple of %d)\n", input_width, input_height, numCameras);
 		}
@@ -483,6 +832,27 @@ static vx_status VX_CALLBACK exposure_comp_applygains_input_validator(vx_node no
 			status = VX_SUCCESS;
 		}
 	}
+	else if (index == 4)
+	{ // object of SCALAR type: number of gains per camera
+		vx_enum itemtype = VX_TYPE_INVALID;
+		vx_uint32 num_channels = 0;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype == VX_TYPE_UINT32) {
+			ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)ref, &num_channels));
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+		if (itemtype != VX_TYPE_UINT32) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation gain channels scalar type should be a UINT32\n");
+		}
+		else if (num_channels != 1 && num_channels != 3) {
+			status = VX_ERROR_INVALID_VALUE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation gain channels should be 1 (luma) or 3 (R, G, B)\n");
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+	}
 	else if (index == 1)
 	{ // array object for gains
 		vx_enum itemtype = VX_TYPE_INVALID;
@@ -552,14 +922,84 @@ static vx_status VX_CALLBACK exposure_comp_applygains_query_target_support(vx_gr
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = StitchGetColorKernelTargetAffinity();
 	return VX_SUCCESS;
 }
 
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK exposure_comp_applygains_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	// host implementation: same blocks and gains as the OpenCL kernel
+	vx_image input_image = (vx_image)parameters[0];
+	vx_array gain_array = (vx_array)parameters[1];
+	vx_array valid_array = (vx_array)parameters[2];
+	vx_image output_image = (vx_image)parameters[3];
+	vx_uint32 num_channels = 1;
+	if (parameters[4]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[4], &num_channels));
+	vx_size capacity = 0, num_gains = 0, num_entries = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(gain_array, VX_ARRAY_ATTRIBUTE_CAPACITY, &capacity, sizeof(capacity)));
+	ERROR_CHECK_STATUS(vxQueryArray(gain_array, VX_ARRAY_ATTRIBUTE_NUMITEMS, &num_gains, sizeof(num_gains)));
+	ERROR_CHECK_STATUS(vxQueryArray(valid_array, VX_ARRAY_ATTRIBUTE_NUMITEMS, &num_entries, sizeof(num_entries)));
+	vx_uint32 num_cam = std::max((vx_uint32)capacity / std::max(num_channels, 1u), 1u);
+	vx_uint32 input_width = 0, input_height = 0, output_width = 0, output_height = 0;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	vx_uint32 height_one_in = input_height / num_cam, height_one_out = output_height / num_cam;
+
+	// gains of each camera: R, G, B (all 1.0 until the first solve)
+	std::vector<vx_float32> gains(num_cam * 3, 1.0f);
+	if (num_gains >= num_cam * num_channels) {
+		vx_map_id map_id = 0;
+		vx_size stride = 0;
+		vx_float32 * ptr = nullptr;
+		ERROR_CHECK_STATUS(vxMapArrayRange(gain_array, 0, num_cam * num_channels, &map_id, &stride, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+		for (vx_uint32 cam = 0; cam < num_cam; cam++)
+			for (vx_uint32 c = 0; c < 3; c++)
+				gains[cam * 3 + c] = ptr[(num_channels == 3 ? c * num_cam : 0) + cam];
+		ERROR_CHECK_STATUS(vxUnmapArrayRange(gain_array, map_id));
+	}
+
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height };
+	vx_rectangle_t output_rect = { 0, 0, output_width, output_height };
+	vx_imagepatch_addressing_t input_addr, output_addr;
+	void * input_ptr = nullptr, * output_ptr = nullptr;
+	vx_size entry_stride = 0;
+	StitchExpCompCalcEntry * entries = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+	if (num_entries > 0)
+		ERROR_CHECK_STATUS(vxAccessArrayRange(valid_array, 0, num_entries, &entry_stride, (void **)&entries, VX_READ_ONLY));
+
+	// each entry is a block of 16x16 groups of 8x2 pixels: the block is clipped to end_x/end_y pixels
+	#pragma omp parallel for
+	for (vx_int32 i = 0; i < (vx_int32)num_entries; i++) {
+		StitchExpCompCalcEntry entry = entries[i];
+		const vx_float32 * g = &gains[entry.camId * 3];
+		for (vx_uint32 ly = 0; ly < 16 && ly * 2 < entry.end_y; ly++) {
+			vx_uint32 y = (entry.dstY + ly) * 2;
+			for (vx_uint32 row = 0; row < 2; row++) {
+				const vx_uint8 * ip = (const vx_uint8 *)input_ptr + (height_one_in * entry.camId + y + row) * input_addr.stride_y;
+				vx_uint8 * op = (vx_uint8 *)output_ptr + (height_one_out * entry.camId + y + row) * output_addr.stride_y;
+				for (vx_uint32 lx = 0; lx < 16 && lx * 8 < entry.end_x; lx++) {
+					vx_uint32 offset = (entry.dstX + lx) * 32;
+					for (vx_uint32 k = offset; k < offset + 32; k += 4) {
+						op[k + 0] = StitchClampToU8(ip[k + 0] * g[0]);
+						op[k + 1] = StitchClampToU8(ip[k + 1] * g[1]);
+						op[k + 2] = StitchClampToU8(ip[k + 2] * g[2]);
+						op[k + 3] = ip[k + 3];
+					}
+				}
+			}
+		}
+	}
+
+	if (num_entries > 0)
+		ERROR_CHECK_STATUS(vxCommitArrayRange(valid_array, 0, num_entries, entries));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &input_rect, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+	return VX_SUCCESS;
 }
 
 //! \brief The OpenCL global work updater callback.
@@ -623,6 +1063,16 @@ static vx_status VX_CALLBACK exposure_comp_applygains_opencl_codegen(
 	vx_array gain_array = (vx_array)avxGetNodeParamRef(node, 1);
 	ERROR_CHECK_STATUS(vxQueryArray(gain_array, VX_ARRAY_ATTRIBUTE_CAPACITY, &num_cam, sizeof(num_cam)));
 	ERROR_CHECK_STATUS(vxReleaseArray(&gain_array));
+	// per-channel gains: the gains array has the R gains of all cameras, followed by G and B gains
+	vx_uint32 num_channels = 1;
+	const char * kernel_args = "";
+	vx_scalar s_num_channels = (vx_scalar)avxGetNodeParamRef(node, 4);
+	if (s_num_channels) {
+		ERROR_CHECK_STATUS(vxReadScalarValue(s_num_channels, &num_channels));
+		ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_channels));
+		kernel_args = ", uint num_channels";
+	}
+	num_cam /= std::max(num_channels, 1u);
 	if (!num_cam) num_cam = 1;	// has to be atleast 1
 
 	// set kernel configuration
@@ -636,7 +1086,17 @@ static vx_status VX_CALLBACK exposure_comp_applygains_opencl_codegen(
 	height_one_in = (vx_uint32)(input_height / num_cam);
 	height_one_out = (vx_uint32)(output_height / num_cam);
 	// opencl kernel header and reading
-	char item[8192];
+	char item[8192], gain_load[256];
+	if (num_channels == 3) {
+		sprintf(gain_load,
+			"	float4 g4 = (float4)(((__global float *)pG_buf)[cam_id], ((__global float *)pG_buf)[cam_id + %d], ((__global float *)pG_buf)[cam_id + %d], 1.0f);\n"
+			, (int)num_cam, (int)num_cam * 2);
+	}
+	else {
+		strcpy(gain_load,
+			"	float g = ((__global float *)pG_buf)[cam_id];\n"
+			"	float4 g4 = (float4)((float3)g, (float)1.0f);\n");
+	}
 	sprintf(item,
 		"#pragma OPENCL EXTENSION cl_amd_media_ops : enable\n"
 		"#pragma OPENCL EXTENSION cl_amd_media_ops2 : enable\n"
@@ -650,17 +1110,18 @@ static vx_status VX_CALLBACK exposure_comp_applygains_opencl_codegen(
 		"void %s(uint pIn_width, uint pIn_height, __global uchar * pIn_buf, uint pIn_stride, uint pIn_offset,\n"
 		"        __global uchar * pG_buf, uint pG_offs, uint pG_num,\n"
 		"        __global uchar * pExpData_buf, uint pExpData_offset, uint pExpData_num,\n"
-		"        uint pOut_width, uint pOut_height, __global uchar * pOut_buf, uint pOut_stride, uint pOut_offset)\n"
+		"        uint pOut_width, uint pOut_height, __global uchar * pOut_buf, uint pOut_stride, uint pOut_offset%s)\n"
 		"{\n"
 		"	int grp_id = get_global_id(0)>>4;\n"
 		"   if (grp_id < pExpData_num) {\n"
 		"	uint2 size = (uint2)((pIn_stride*%d), (pOut_stride*%d));\n"
-		, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, height_one_in, height_one_out);
+		, opencl_local_work[0], opencl_local_work[1], opencl_kernel_function_name, kernel_args, height_one_in, height_one_out);
 		opencl_kernel_code = item;
 		opencl_kernel_code +=
 				"	uint2 offs = ((__global uint2 *)(pExpData_buf+pExpData_offset))[grp_id];\n"
-				"	pG_buf += pG_offs; int cam_id = offs.s0&0x3f;\n"
-				"	float g = ((__global float *)pG_buf)[cam_id];\n"
+				"	pG_buf += pG_offs; int cam_id = offs.s0&0x3f;\n";
+		opencl_kernel_code += gain_load;
+		opencl_kernel_code +=
 				"	int  lx = get_local_id(0);\n"
 				"	int  ly = get_local_id(1);\n"
 				"   int   gx = lx + ((offs.s0 >> 6) & 0xFFF);\n"
@@ -670,7 +1131,6 @@ static vx_status VX_CALLBACK exposure_comp_applygains_opencl_codegen(
 				"   uchar4 offs4 = as_uchar4(offs.s1); \n"
 				"   if (((lx<<3) < (int)offs4.s2) && (ly*2 < (int)offs4.s3)) {\n"
 				"	uint8 r0, r1; float4 f4;\n"
-				"	float4 g4 = (float4)((float3)g, (float)1.0f);\n"
 				"	r0 =  *(__global uint8 *)pIn_buf;\n"
 				"	r1 =  *(__global uint8 *)(pIn_buf+pIn_stride);\n"
 				"	f4 = amd_unpack(r0.s0)*g4; r0.s0 = amd_pack(f4); \n"
@@ -704,7 +1164,7 @@ vx_status exposure_comp_applygains_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.expcomp_applygains",
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_APPLYGAINS,
 		exposure_comp_applygains_kernel,
-		4,
+		5,
 		exposure_comp_applygains_input_validator,
 		exposure_comp_applygains_output_validator,
 		nullptr,
@@ -721,6 +1181,7 @@ vx_status exposure_comp_applygains_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
 	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
@@ -793,6 +1254,37 @@ static vx_status VX_CALLBACK exposure_comp_solvegains_input_validator(vx_node no
 			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp_solve matrix data types are not valid\n");
 		}
 	}
+	else if (index == 5 || index == 6 || index == 7)
+	{ // object of SCALAR type: current frame, update interval, and stagger flag
+		vx_enum itemtype = VX_TYPE_INVALID;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+		if (itemtype == VX_TYPE_UINT32) {
+			status = VX_SUCCESS;
+		}
+		else {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp_solve update schedule scalar type should be a UINT32\n");
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+	}
+	else if (index == 8)
+	{ // scalar of type VX_TYPE_FLOAT32: temporal smoothing weight of previous gains
+		vx_enum type = VX_TYPE_INVALID;
+		vx_float32 smoothing = 0;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &type, sizeof(type)));
+		if (type != VX_TYPE_FLOAT32) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp_solve smoothing scalar type should be a float32\n");
+		}
+		else if (vxReadScalarValue((vx_scalar)ref, &smoothing) != VX_SUCCESS || smoothing < 0.0f || smoothing >= 1.0f) {
+			status = VX_ERROR_INVALID_VALUE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: exp_comp_solve smoothing value should be in range [0..1)\n");
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+	}
 	return status;
 }
 
@@ -823,13 +1315,69 @@ static vx_status VX_CALLBACK exposure_comp_solvegains_output_validator(vx_node n
 	return status;
 }
 
+//! \brief The solvegains node-local data.
+//  - calcErrorFn accumulates into A_matrix on the GPU without a per-frame reset: the intensity sums of
+//    a frame are the difference from the sums seen by the previous frame (modulo 2^32)
+//  - with an update interval of N frames, each overlap pair only accumulates on its phase frame of the
+//    interval (see exposure_comp_pair_phase), so A_matrix is only read on the solve frame of the interval
+//  - with per-channel gains, A_matrix has 3*num_cameras rows (R, G, B blocks) and all blocks share the count matrix
+struct exposure_comp_solvegains_data {
+	vx_size count;                // number of matrix elements
+	vx_uint32 * prevIMat;         // A_matrix running sums at previous solve
+	vx_uint32 * IMat, * NMat;     // per-frame work buffers
+	vx_uint32 numGains;           // number of valid gains in prevGains (0 until the first solve)
+	vx_float32 * prevGains;       // gains from previous solve for temporal smoothing
+	vx_float32 * gains;           // gains of the current solve
+};
+
+//! \brief The solvegains kernel initialize.
+static vx_status VX_CALLBACK exposure_comp_solvegains_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size columns = 0, rows = 0;
+	ERROR_CHECK_STATUS(vxQueryMatrix((vx_matrix)parameters[2], VX_MATRIX_ATTRIBUTE_COLUMNS, &columns, sizeof(columns)));
+	ERROR_CHECK_STATUS(vxQueryMatrix((vx_matrix)parameters[2], VX_MATRIX_ATTRIBUTE_ROWS, &rows, sizeof(rows)));
+	exposure_comp_solvegains_data * data = new exposure_comp_solvegains_data;
+	data->count = rows * columns;
+	data->prevIMat = new vx_uint32[data->count]();  // A_matrix is initialized to ZERO by lsInitialize
+	data->IMat = new vx_uint32[data->count];
+	data->NMat = new vx_uint32[data->count];
+	data->numGains = 0;
+	data->prevGains = new vx_float32[rows]();
+	data->gains = new vx_float32[rows];
+	vx_size size = sizeof(exposure_comp_solvegains_data);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	return VX_SUCCESS;
+}
+
+//! \brief The solvegains kernel deinitialize.
+static vx_status VX_CALLBACK exposure_comp_solvegains_deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(exposure_comp_solvegains_data)))
+	{
+		exposure_comp_solvegains_data * data = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+		if (data) {
+			delete[] data->prevIMat;
+			delete[] data->IMat;
+			delete[] data->NMat;
+			delete[] data->prevGains;
+			delete[] data->gains;
+			delete data;
+		}
+	}
+	return VX_SUCCESS;
+}
+
 static vx_status VX_CALLBACK exposure_comp_solvegains_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 	vx_status status = VX_FAILURE;
 	vx_float32 alpha = 0, beta = 0;
-	vx_uint32 *pIMat, *pNMat;
 	vx_uint32 numCameras;
-	CExpCompensator* exp_comp = new CExpCompensator();
+	exposure_comp_solvegains_data * data = nullptr;
+	ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	if (!data) return VX_ERROR_NOT_ALLOCATED;
 	vx_scalar scalar = (vx_scalar)parameters[0];
 	ERROR_CHECK_STATUS(vxReadScalarValue(scalar, &alpha));
 	scalar = (vx_scalar)parameters[1];
@@ -838,13 +1386,31 @@ static vx_status VX_CALLBACK exposure_comp_solvegains_kernel(vx_node node, const
 	vx_matrix mat = (vx_matrix)parameters[2];
 	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_COLUMNS, &columns, sizeof(columns)));
 	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_ROWS, &rows, sizeof(rows)));
-	pIMat = new vx_uint32[rows*columns];
-	ERROR_CHECK_STATUS(vxReadMatrix(mat, (void *)pIMat));
+	if (rows * columns != data->count) return VX_ERROR_INVALID_DIMENSION;
+	vx_uint32 num_channels = (rows == 3 * columns) ? 3 : 1;
+	// get the optional update schedule
+	vx_uint32 current_frame = 0, interval = 1, stagger = 0;
+	vx_float32 smoothing = 0;
+	if (parameters[5]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[5], &current_frame));
+	if (parameters[6]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[6], &interval));
+	if (parameters[7]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[7], &stagger));
+	if (parameters[8]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[8], &smoothing));
+	if (interval < 1) interval = 1;
+	// gains are only solved once per interval, after all pairs have been updated
+	if ((current_frame % interval) != exposure_comp_solve_phase(interval, stagger))
+		return VX_SUCCESS;
+	// every pair accumulated exactly once since the previous solve: its sums are the change of the running sums
+	ERROR_CHECK_STATUS(vxReadMatrix(mat, (void *)data->IMat));
+	for (vx_size i = 0; i < data->count; i++) {
+		vx_uint32 sum = data->IMat[i];
+		data->IMat[i] = sum - data->prevIMat[i];
+		data->prevIMat[i] = sum;
+	}
 	mat = (vx_matrix)parameters[3];
 	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_COLUMNS, &columns, sizeof(columns)));
 	ERROR_CHECK_STATUS(vxQueryMatrix(mat, VX_MATRIX_ATTRIBUTE_ROWS, &rows, sizeof(rows)));
-	pNMat = new vx_uint32[rows*columns];
-	ERROR_CHECK_STATUS(vxReadMatrix(mat, (void *)pNMat));
+	if (rows * columns * num_channels != data->count) return VX_ERROR_INVALID_DIMENSION;
+	ERROR_CHECK_STATUS(vxReadMatrix(mat, (void *)data->NMat));
 	// get output array pointer
 	vx_array arr = (vx_array)parameters[4];
 	// set the capacity and item_type of the array
@@ -861,12 +1427,44 @@ static vx_status VX_CALLBACK exposure_comp_solvegains_kernel(vx_node node, const
 		vxAddLogEntry((vx_reference)node, status, "ERROR: exposure_compensation_gain array capacity not enough\n");
 	}
 	numCameras = (vx_uint32)capacity;
-	vx_size stride = 0;
-	void *base = NULL;
-	status = exp_comp->SolveForGains(alpha, beta, pIMat, pNMat, numCameras, arr, (vx_uint32)rows, (vx_uint32)columns);
-	delete pIMat;
-	delete pNMat;
-	delete exp_comp;
+	if (num_channels > 1) {
+		// gains array has the R gains of all cameras, followed by G and B gains: each channel is solved separately
+		numCameras = (vx_uint32)(capacity / num_channels);
+		if (numCameras * num_channels != capacity || numCameras > rows)
+			return VX_ERROR_INVALID_DIMENSION;
+		CExpCompensator* exp_comp = new CExpCompensator();
+		status = VX_SUCCESS;
+		for (vx_uint32 c = 0; c < num_channels && status == VX_SUCCESS; c++) {
+			status = exp_comp->SolveForGains(alpha, beta, data->IMat + c * rows * columns, data->NMat, numCameras, data->gains + c * numCameras, (vx_uint32)rows, (vx_uint32)columns);
+		}
+		delete exp_comp;
+		if (status != VX_SUCCESS)
+			return status;
+		ERROR_CHECK_STATUS(vxTruncateArray(arr, 0));
+		ERROR_CHECK_STATUS(vxAddArrayItems(arr, capacity, data->gains, sizeof(vx_float32)));
+		numCameras = (vx_uint32)capacity;
+	}
+	else {
+		CExpCompensator* exp_comp = new CExpCompensator();
+		status = exp_comp->SolveForGains(alpha, beta, data->IMat, data->NMat, numCameras, arr, (vx_uint32)rows, (vx_uint32)columns);
+		delete exp_comp;
+		if (status != VX_SUCCESS)
+			return status;
+	}
+	// temporal smoothing: g = smoothing * g_prev + (1 - smoothing) * g_new
+	if (numCameras <= rows * num_channels) {
+		vx_size stride = 0;
+		vx_float32 * gains = nullptr;
+		ERROR_CHECK_STATUS(vxAccessArrayRange(arr, 0, numCameras, &stride, (void **)&gains, VX_READ_AND_WRITE));
+		for (vx_uint32 i = 0; i < numCameras; i++) {
+			vx_float32 * gain = (vx_float32 *)((vx_uint8 *)gains + i * stride);
+			if (smoothing > 0.0f && data->numGains == numCameras)
+				*gain = smoothing * data->prevGains[i] + (1.0f - smoothing) * *gain;
+			data->prevGains[i] = *gain;
+		}
+		ERROR_CHECK_STATUS(vxCommitArrayRange(arr, 0, numCameras, gains));
+		data->numGains = numCameras;
+	}
 	return status;
 }
 
@@ -877,11 +1475,11 @@ vx_status exposure_comp_solvegains_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.expcomp_solvegains",
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_SOLVE,
 		exposure_comp_solvegains_kernel,
-		5,
+		9,
 		exposure_comp_solvegains_input_validator,
 		exposure_comp_solvegains_output_validator,
-		nullptr,
-		nullptr);
+		exposure_comp_solvegains_initialize,
+		exposure_comp_solvegains_deinitialize);
 	ERROR_CHECK_OBJECT(kernel);
 	// set kernel parameters
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
@@ -889,6 +1487,10 @@ vx_status exposure_comp_solvegains_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_MATRIX, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_MATRIX, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 8, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
 	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
@@ -1023,9 +1625,11 @@ vx_status GenerateExpCompBuffers(
 {
 	const vx_rectangle_t * const * overlapRegion = paddedPixelCamMap ? overlapPadded : overlapValid;
 
-	// generate validTable
-	vx_uint32 validEntryCount = 0;
-	for (vx_uint32 i = 0; i < numCamera; i++) {
+	// generate validTable: entries of each camera are generated in parallel and then
+	// concatenated in camera order, so that the table is same as the one from a serial scan
+	std::vector< std::vector<StitchExpCompCalcEntry> > validList(numCamera);
+	#pragma omp parallel for schedule(dynamic)
+	for (vx_int32 i = 0; i < (vx_int32)numCamera; i++) {
 		vx_uint32 camMaskBit = (1 << i);
 		vx_uint32 start_x = overlapValid[i][i].start_x, end_x = overlapValid[i][i].end_x;
 		vx_uint32 start_y = overlapValid[i][i].start_y, end_y = overlapValid[i][i].end_y;
@@ -1048,70 +1652,89 @@ vx_status GenerateExpCompBuffers(
 					}
 					if (count > 0) {
 						// add valid entry
-						if (validEntryCount < validTableSize){
-							StitchExpCompCalcEntry validEntry;
-							validEntry.camId = i;
-							validEntry.dstX = (xs >> 3);
-							validEntry.dstY = (ys >> 1);
-							validEntry.start_x = xs & 7;
-							validEntry.start_y = ys & 1;
-							validEntry.end_x = xe - xs - 1;
-							validEntry.end_y = ye - ys - 1;
-							validTable[validEntryCount] = validEntry;
-						}
-						validEntryCount++;
+						StitchExpCompCalcEntry validEntry;
+						validEntry.camId = i;
+						validEntry.dstX = (xs >> 3);
+						validEntry.dstY = (ys >> 1);
+						validEntry.start_x = xs & 7;
+						validEntry.start_y = ys & 1;
+						validEntry.end_x = xe - xs - 1;
+						validEntry.end_y = ye - ys - 1;
+						validList[i].push_back(validEntry);
 					}
 				}
 			}
 		}
 	}
+	vx_uint32 validEntryCount = 0;
+	for (vx_uint32 i = 0; i < numCamera; i++) {
+		for (size_t k = 0; k < validList[i].size(); k++) {
+			if (validEntryCount < validTableSize)
+				validTable[validEntryCount] = validList[i][k];
+			validEntryCount++;
+		}
+	}
 
-	// generate overlapTable and overlapPixelCountMatrix
-	memset(overlapPixelCountMatrix, 0, numCamera * numCamera * sizeof(vx_int32));
-	vx_uint32 overlapEntryCount = 0;
-	for (vx_uint32 i = 1; i < numCamera; i++) {
-		for (vx_uint32 j = 0; j < i; j++) {
-			vx_uint32 overlapMaskBits = (1 << i) | (1 << j);
-			vx_uint32 start_x = overlapRegion[i][j].start_x, end_x = overlapRegion[i][j].end_x;
-			vx_uint32 start_y = overlapRegion[i][j].start_y, end_y = overlapRegion[i][j].end_y;
-			if ((start_x < end_x) && (start_y < end_y))	{
-				for (vx_uint32 ys = start_y; ys < end_y; ys += 32) {
-					for (vx_uint32 xs = start_x; xs < end_x; xs += 128) {
-						vx_uint32 xe = (xs + 128) < end_x ? (xs + 128) : end_x;
-						vx_uint32 ye = (ys +  32) < end_y ? (ys +  32) : end_y;
-						// count valid pixels
-						vx_int32 count = 0;
-						for (vx_uint32 y = ys; y < ye; y++) {
-							for (vx_uint32 x = xs; x < xe; x++) {
-								if ((validPixelCamMap[y * eqrWidth + x] & overlapMaskBits) == overlapMaskBits) {
-									count++;
-								}
-							}
-						}
-						if (count > 0) {
-							overlapPixelCountMatrix[i * numCamera + j] += count;
-							overlapPixelCountMatrix[j * numCamera + i] += count;
-							// add overlapTable entry
-							if (overlapEntryCount < overlapTableSize) {
-								StitchOverlapPixelEntry overlapEntry;
-								overlapEntry.camId0 = i;
-								overlapEntry.start_x = xs;
-								overlapEntry.start_y = ys;
-								overlapEntry.end_x = xe - xs - 1;
-								overlapEntry.end_y = ye - ys - 1;
-								overlapEntry.camId1 = j;
-								overlapEntry.camId2 = 0x1F;
-								overlapEntry.camId3 = 0x1F;
-								overlapEntry.camId4 = 0x1F;
-								overlapTable[overlapEntryCount] = overlapEntry;
+	// generate overlapTable and overlapPixelCountMatrix: camera pair (i,j), j < i, has index i*(i-1)/2+j;
+	// entries of each pair are generated in parallel and then concatenated in pair order
+	vx_int32 numPairs = (vx_int32)(numCamera * (numCamera - 1) / 2);
+	std::vector< std::vector<StitchOverlapPixelEntry> > overlapList(numPairs);
+	std::vector<vx_int32> overlapPixelCount(numPairs, 0);
+	#pragma omp parallel for schedule(dynamic)
+	for (vx_int32 pair = 0; pair < numPairs; pair++) {
+		vx_uint32 i = 1;
+		while ((vx_int32)(i * (i + 1) / 2) <= pair)
+			i++;
+		vx_uint32 j = pair - i * (i - 1) / 2;
+		vx_uint32 overlapMaskBits = (1 << i) | (1 << j);
+		vx_uint32 start_x = overlapRegion[i][j].start_x, end_x = overlapRegion[i][j].end_x;
+		vx_uint32 start_y = overlapRegion[i][j].start_y, end_y = overlapRegion[i][j].end_y;
+		if ((start_x < end_x) && (start_y < end_y))	{
+			for (vx_uint32 ys = start_y; ys < end_y; ys += 32) {
+				for (vx_uint32 xs = start_x; xs < end_x; xs += 128) {
+					vx_uint32 xe = (xs + 128) < end_x ? (xs + 128) : end_x;
+					vx_uint32 ye = (ys +  32) < end_y ? (ys +  32) : end_y;
+					// count valid pixels
+					vx_int32 count = 0;
+					for (vx_uint32 y = ys; y < ye; y++) {
+						for (vx_uint32 x = xs; x < xe; x++) {
+							if ((validPixelCamMap[y * eqrWidth + x] & overlapMaskBits) == overlapMaskBits) {
+								count++;
 							}
-							overlapEntryCount++;
 						}
 					}
+					if (count > 0) {
+						overlapPixelCount[pair] += count;
+						// add overlapTable entry
+						StitchOverlapPixelEntry overlapEntry;
+						overlapEntry.camId0 = i;
+						overlapEntry.start_x = xs;
+						overlapEntry.start_y = ys;
+						overlapEntry.end_x = xe - xs - 1;
+						overlapEntry.end_y = ye - ys - 1;
+						overlapEntry.camId1 = j;
+						overlapEntry.camId2 = 0x1F;
+						overlapEntry.camId3 = 0x1F;
+						overlapEntry.camId4 = 0x1F;
+						overlapList[pair].push_back(overlapEntry);
+					}
 				}
 			}
 		}
 	}
+	memset(overlapPixelCountMatrix, 0, numCamera * numCamera * sizeof(vx_int32));
+	vx_uint32 overlapEntryCount = 0;
+	for (vx_uint32 i = 1, pair = 0; i < numCamera; i++) {
+		for (vx_uint32 j = 0; j < i; j++, pair++) {
+			overlapPixelCountMatrix[i * numCamera + j] += overlapPixelCount[pair];
+			overlapPixelCountMatrix[j * numCamera + i] += overlapPixelCount[pair];
+			for (size_t k = 0; k < overlapList[pair].size(); k++) {
+				if (overlapEntryCount < overlapTableSize)
+					overlapTable[overlapEntryCount] = overlapList[pair][k];
+				overlapEntryCount++;
+			}
+		}
+	}
 
 	// check for buffer overflow error condition and updated output entry counts
 	if (validEntryCount > validTableSize || overlapEntryCount > overlapTableSize) {
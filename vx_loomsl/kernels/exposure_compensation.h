@@ -51,6 +51,19 @@ typedef struct {
 	vx_uint32 camId4  :  5; // values [0..30] overlapping cameraId; 31 indicates invalid cameraId
 } StitchOverlapPixelEntry;
 
+//////////////////////////////////////////////////////////////////////
+//! \brief The gain update schedule with an update interval of N frames:
+//  each overlap pair only accumulates statistics on its phase frame of the interval (must match the
+//  OpenCL code of exposure_comp_calc_errorfn), and gains are solved once per interval after all pairs.
+inline vx_uint32 exposure_comp_pair_phase(vx_uint32 i, vx_uint32 j, vx_uint32 interval, vx_uint32 stagger)
+{
+	return stagger ? ((std::min(i, j) * 32 + std::max(i, j)) % interval) : 0;
+}
+inline vx_uint32 exposure_comp_solve_phase(vx_uint32 interval, vx_uint32 stagger)
+{
+	return stagger ? interval - 1 : 0;
+}
+
 //////////////////////////////////////////////////////////////////////
 //! \brief The kernel registration functions.
 vx_status exposure_comp_calcErrorFn_publish(vx_context context);
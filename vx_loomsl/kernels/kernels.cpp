@@ -48,6 +48,7 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
 	// register kernels
 	ERROR_CHECK_STATUS(color_convert_publish(context));
 	ERROR_CHECK_STATUS(warp_publish(context));
+	ERROR_CHECK_STATUS(simple_remap_publish(context));
 	ERROR_CHECK_STATUS(exposure_compensation_publish(context));
 	ERROR_CHECK_STATUS(exposure_comp_calcErrorFn_publish(context));
 	ERROR_CHECK_STATUS(exposure_comp_solvegains_publish(context));
@@ -65,6 +66,7 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
 	ERROR_CHECK_STATUS(seamfind_cost_accumulate_publish(context));
 	ERROR_CHECK_STATUS(seamfind_path_trace_publish(context));
 	ERROR_CHECK_STATUS(seamfind_set_weights_publish(context));
+	ERROR_CHECK_STATUS(seamfind_analyze_publish(context));
 	return VX_SUCCESS;
 }
 
@@ -292,6 +294,24 @@ VX_API_ENTRY vx_node VX_API_CALL stitchWarpNode(vx_graph graph, vx_enum method,
 	return node;
 }
 
+/**
+* \brief Function to create Stitch Simple Remap node
+*/
+VX_API_ENTRY vx_node VX_API_CALL stitchSimpleRemapNode(vx_graph graph, vx_image input, vx_array SimpleRemapEntry, vx_image output)
+{
+	vx_reference params[] = {
+		(vx_reference)input,
+		(vx_reference)SimpleRemapEntry,
+		(vx_reference)output
+	};
+	vx_node node = stitchCreateNode(graph,
+		AMDOVX_KERNEL_STITCHING_SIMPLE_REMAP,
+		params,
+		dimof(params));
+
+	return node;
+}
+
 /**
 * \brief Function to create Stitch Merge node
 */
@@ -370,9 +390,14 @@ VX_API_ENTRY vx_node VX_API_CALL stitchInitializeStitchRemapNode(vx_graph graph,
 /**
 * \brief Function to create Calculate Error Function node
 */
-VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompCalcErrorFnNode(vx_graph graph, vx_uint32 numCameras, vx_image input, vx_array exp_data, vx_image mask, vx_matrix out_intensity)
+VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompCalcErrorFnNode(vx_graph graph, vx_uint32 numCameras, vx_image input, vx_array exp_data, vx_image mask, vx_matrix out_intensity,
+	vx_scalar current_frame, vx_uint32 update_interval, vx_uint32 stagger, vx_uint32 sample_stride)
 {
-	vx_scalar Num_Camera = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &numCameras);
+	vx_context context = vxGetContext((vx_reference)graph);
+	vx_scalar Num_Camera = vxCreateScalar(context, VX_TYPE_UINT32, &numCameras);
+	vx_scalar Interval = current_frame ? vxCreateScalar(context, VX_TYPE_UINT32, &update_interval) : nullptr;
+	vx_scalar Stagger = current_frame ? vxCreateScalar(context, VX_TYPE_UINT32, &stagger) : nullptr;
+	vx_scalar Sample_Stride = (sample_stride > 1) ? vxCreateScalar(context, VX_TYPE_UINT32, &sample_stride) : nullptr;
 
 	vx_reference params[] = {
 		(vx_reference)Num_Camera,
@@ -380,6 +405,10 @@ VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompCalcErrorFnNode(vx_graph grap
 		(vx_reference)exp_data,
 		(vx_reference)mask,
 		(vx_reference)out_intensity,
+		(vx_reference)current_frame,
+		(vx_reference)Interval,
+		(vx_reference)Stagger,
+		(vx_reference)Sample_Stride,
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_COMPUTE_GAINMAT,
@@ -387,16 +416,24 @@ VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompCalcErrorFnNode(vx_graph grap
 		dimof(params));
 
 	vxReleaseScalar(&Num_Camera);
+	if (Interval) vxReleaseScalar(&Interval);
+	if (Stagger) vxReleaseScalar(&Stagger);
+	if (Sample_Stride) vxReleaseScalar(&Sample_Stride);
 	return node;
 }
 
 /**
 * \brief Function to create Calculate Gains node
 */
-VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph graph, vx_float32 alpha, vx_float32 beta, vx_matrix in_intensity, vx_matrix in_count, vx_array out_gains)
+VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph graph, vx_float32 alpha, vx_float32 beta, vx_matrix in_intensity, vx_matrix in_count, vx_array out_gains,
+	vx_scalar current_frame, vx_uint32 update_interval, vx_uint32 stagger, vx_float32 smoothing)
 {
-	vx_scalar Alpha = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_FLOAT32, &alpha);
-	vx_scalar Beta = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_FLOAT32, &beta);
+	vx_context context = vxGetContext((vx_reference)graph);
+	vx_scalar Alpha = vxCreateScalar(context, VX_TYPE_FLOAT32, &alpha);
+	vx_scalar Beta = vxCreateScalar(context, VX_TYPE_FLOAT32, &beta);
+	vx_scalar Interval = current_frame ? vxCreateScalar(context, VX_TYPE_UINT32, &update_interval) : nullptr;
+	vx_scalar Stagger = current_frame ? vxCreateScalar(context, VX_TYPE_UINT32, &stagger) : nullptr;
+	vx_scalar Smoothing = vxCreateScalar(context, VX_TYPE_FLOAT32, &smoothing);
 
 	vx_reference params[] = {
 		(vx_reference)Alpha,
@@ -404,6 +441,10 @@ VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph gra
 		(vx_reference)in_intensity,
 		(vx_reference)in_count,
 		(vx_reference)out_gains,
+		(vx_reference)current_frame,
+		(vx_reference)Interval,
+		(vx_reference)Stagger,
+		(vx_reference)Smoothing,
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_SOLVE,
@@ -412,26 +453,32 @@ VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph gra
 
 	vxReleaseScalar(&Alpha);
 	vxReleaseScalar(&Beta);
+	if (Interval) vxReleaseScalar(&Interval);
+	if (Stagger) vxReleaseScalar(&Stagger);
+	vxReleaseScalar(&Smoothing);
 	return node;
 }
 
 /**
 * \brief Function to create Apply Gains node
 */
-VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompApplyGainNode(vx_graph graph, vx_image input, vx_array in_gains, vx_array in_offsets, vx_image output)
+VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompApplyGainNode(vx_graph graph, vx_image input, vx_array in_gains, vx_array in_offsets, vx_image output, vx_uint32 num_gain_channels)
 {
+	vx_scalar Num_Channels = (num_gain_channels > 1) ? vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &num_gain_channels) : nullptr;
 
 	vx_reference params[] = {
 		(vx_reference)input,
 		(vx_reference)in_gains,
 		(vx_reference)in_offsets,
 		(vx_reference)output,
+		(vx_reference)Num_Channels,
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_EXPCOMP_APPLYGAINS,
 		params,
 		dimof(params));
 
+	if (Num_Channels) vxReleaseScalar(&Num_Channels);
 	return node;
 }
 
@@ -499,7 +546,8 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostGenerateNode(vx_graph graph,
 
 //*\brief Function to create SeamFind Cost Accumulate Node - GPU 
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostAccumulateNode(vx_graph graph, vx_scalar current_frame, vx_uint32 output_width, vx_uint32 output_height,
-	vx_image magnitude_img, vx_image phase_img, vx_image mask_img, vx_array valid_seam, vx_array pref_seam, vx_array info_seam, vx_array accum_seam)
+	vx_image magnitude_img, vx_image phase_img, vx_image mask_img, vx_array valid_seam, vx_array pref_seam, vx_array info_seam, vx_array accum_seam,
+	vx_scalar executeFlag)
 {
 	vx_scalar OUTPUT_WIDTH = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &output_width);
 	vx_scalar OUTPUT_HEIGHT = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &output_height);
@@ -514,7 +562,8 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostAccumulateNode(vx_graph graph
 		(vx_reference)valid_seam,
 		(vx_reference)pref_seam,
 		(vx_reference)info_seam,
-		(vx_reference)accum_seam
+		(vx_reference)accum_seam,
+		(vx_reference)executeFlag
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_COST_ACCUMULATE,
@@ -528,7 +577,7 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostAccumulateNode(vx_graph graph
 
 //*\brief Function to create SeamFind Path Trace node - GPU/CPU
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindPathTraceNode(vx_graph graph, vx_scalar current_frame, vx_image weight_image, vx_array seam_info,
-	vx_array seam_accum, vx_array seam_pref, vx_array paths)
+	vx_array seam_accum, vx_array seam_pref, vx_array paths, vx_scalar executeFlag)
 {
 	vx_reference params[] = {
 		(vx_reference)current_frame,
@@ -536,7 +585,8 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindPathTraceNode(vx_graph graph, vx_
 		(vx_reference)seam_info,
 		(vx_reference)seam_accum,
 		(vx_reference)seam_pref,
-		(vx_reference)paths
+		(vx_reference)paths,
+		(vx_reference)executeFlag
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_PATH_TRACE,
@@ -548,7 +598,7 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindPathTraceNode(vx_graph graph, vx_
 
 //*\brief Function to create SeamFind Set Weights node - GPU
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindSetWeightsNode(vx_graph graph, vx_scalar current_frame, vx_uint32 NumCam, vx_uint32 output_width, vx_uint32 output_height, vx_array seam_weight, vx_array seam_path,
-	vx_array seam_pref, vx_image weight_image, vx_uint32 flags)
+	vx_array seam_pref, vx_image weight_image, vx_uint32 flags, vx_scalar executeFlag)
 {
 	vx_scalar NUM_CAM = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &NumCam);
 	vx_scalar OUTPUT_WIDTH = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_UINT32, &output_width);
@@ -564,7 +614,8 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindSetWeightsNode(vx_graph graph, vx
 		(vx_reference)seam_path,
 		(vx_reference)seam_pref,
 		(vx_reference)weight_image,
-		(vx_reference)FLAGS
+		(vx_reference)FLAGS,
+		(vx_reference)executeFlag
 	};
 	vx_node node = stitchCreateNode(graph,
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_SET_WEIGHTS,
@@ -578,6 +629,22 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindSetWeightsNode(vx_graph graph, vx
 	return node;
 }
 
+//*\brief Function to create SeamFind Analyze node - CPU
+VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindAnalyzeNode(vx_graph graph, vx_scalar current_frame, vx_array seam_pref, vx_scalar executeFlag)
+{
+	vx_reference params[] = {
+		(vx_reference)current_frame,
+		(vx_reference)seam_pref,
+		(vx_reference)executeFlag
+	};
+	vx_node node = stitchCreateNode(graph,
+		AMDOVX_KERNEL_STITCHING_SEAMFIND_ANALYZE,
+		params,
+		dimof(params));
+
+	return node;
+}
+
 /***********************************************************************************************************************************
 Stitch Multiband blending nodes.
 ************************************************************************************************************************************/
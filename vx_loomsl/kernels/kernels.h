@@ -36,7 +36,9 @@ THE SOFTWARE.
 //////////////////////////////////////////////////////////////////////
 // common header files
 #include "live_stitch_api.h"
+#if _OPENMP
 #include <omp.h>
+#endif
 #include <vector>
 #include <VX/vx.h>
 #include <vx_ext_amd.h>
@@ -139,8 +141,11 @@ enum vx_kernel_stitching_amd_e {
 	//! \brief The Seam Finding kernel 4. Kernel name is "com.amd.loomsl.seamfind_set_weights".
 	AMDOVX_KERNEL_STITCHING_SEAMFIND_SET_WEIGHTS = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_STITCHING) + 0x016,
 
-	//! \brief The Seam Finding kernel. Kernel name is "com.amd.stitching.seamfind_analyze".
-	AMDOVX_KERNEL_STITCHING_SEAMFIND_ANALYZE = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_STITCHING) + 0x017
+	//! \brief The Seam Finding analyze kernel. Kernel name is "com.amd.loomsl.seamfind_analyze".
+	AMDOVX_KERNEL_STITCHING_SEAMFIND_ANALYZE = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_STITCHING) + 0x017,
+
+	//! \brief The Simple Remap kernel. Kernel name is "com.amd.loomsl.simple_remap".
+	AMDOVX_KERNEL_STITCHING_SIMPLE_REMAP = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_STITCHING) + 0x018
 
 };
 
@@ -203,6 +208,17 @@ VX_API_ENTRY vx_node VX_API_CALL stitchLensDistortionNode(vx_graph graph, vx_mat
 VX_API_ENTRY vx_node VX_API_CALL stitchWarpNode(vx_graph graph, vx_enum method, vx_uint32 num_cam,
 	vx_array ValidPixelEntry, vx_array WarpRemapEntry, vx_image input, vx_image output, vx_image outputLuma, vx_uint32 num_camera_columns);
 
+/*! \brief [Graph] Creates a Simple Remap node.
+* \param [in] graph The reference to the graph.
+* \param [in] input The input image (RGB or RGBX).
+* \param [in] input The input array of StitchSimpleRemapEntry: one entry for every output pixel.
+* \param [out] output The output image (same format as input).
+* \see <tt>AMDOVX_KERNEL_STITCHING_SIMPLE_REMAP</tt>
+* \return <tt>\ref vx_node</tt>.
+* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
+*/
+VX_API_ENTRY vx_node VX_API_CALL stitchSimpleRemapNode(vx_graph graph, vx_image input, vx_array SimpleRemapEntry, vx_image output);
+
 /*! \brief [Graph] Creates a Stitch Merge node.
 * \param [in] graph The reference to the graph.
 * \param [in] input The camera id image.
@@ -244,28 +260,38 @@ VX_API_ENTRY vx_node VX_API_CALL stitchInitializeStitchRemapNode(vx_graph graph,
 * \param [in] input      Input image
 * \param [in] exp_data   Input Array of expdata.
 * \param [in] mask       Mask image.
-* \param [out] out_intensity     Output matrix for sum of overlapping pixels.
+* \param [out] out_intensity     Output matrix for sum of overlapping pixels (3*numCameras rows for R, G, B sums).
+* \param [in] current_frame   The current frame scalar (uint32: optional; nullptr to update every frame)
+* \param [in] update_interval Number of frames between gain updates (used only with current_frame)
+* \param [in] stagger         Spread overlap updates across the interval: 0 - all at once, 1 - staggered
+* \param [in] sample_stride   Use every Nth row of 8x2 pixel cells in the overlap statistics: 1 - 16 (1: all rows)
 * \see <tt>AMDOVX_KERNEL_STITCHING_EXPOSURE_COMP_CALC_ERROR_FUNC</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompCalcErrorFnNode(vx_graph graph, vx_uint32 numCameras,
-	vx_image input, vx_array exp_data, vx_image mask, vx_matrix out_intensity);
+	vx_image input, vx_array exp_data, vx_image mask, vx_matrix out_intensity,
+	vx_scalar current_frame, vx_uint32 update_interval, vx_uint32 stagger, vx_uint32 sample_stride);
 
 
 /*! \brief [Graph] Creates a ExposureCompSolveForGain node.
 * \param [in] graph         The reference to the graph.
 * \param [in] alpha         Input scalar (float32 alpha value: typically square of standard deviation of normalized gain error)
 * \param [in] beta          Input scalar (float32 beta value: typically square of standard deviation of normalized intensity error)
-* \param [in] in_intensity  Input matrix for sum of overlapping pixels.
+* \param [in] in_intensity  Input matrix for sum of overlapping pixels (3x rows of in_count for R, G, B gains).
 * \param [in] in_count      Input matrix for count of overlapping pixels.
-* \param [out] out_gains    Output array for gains.
+* \param [out] out_gains    Output array for gains (R gains of all cameras, followed by G and B gains with 3 channels).
+* \param [in] current_frame   The current frame scalar (uint32: optional; nullptr to solve every frame)
+* \param [in] update_interval Number of frames between gain updates (used only with current_frame)
+* \param [in] stagger         Spread overlap updates across the interval: 0 - all at once, 1 - staggered
+* \param [in] smoothing       Weight of previous gains in new gains (float32: 0.0 - no smoothing, must be less than 1.0)
 * \see <tt>AMDOVX_KERNEL_STITCHING_EXPOSURE_COMP_SOLVE_FOR_GAIN</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph graph, vx_float32 alpha,
-	vx_float32 beta, vx_matrix in_intensity, vx_matrix in_count, vx_array out_gains);
+	vx_float32 beta, vx_matrix in_intensity, vx_matrix in_count, vx_array out_gains,
+	vx_scalar current_frame, vx_uint32 update_interval, vx_uint32 stagger, vx_float32 smoothing);
 
 /*! \brief [Graph] Creates a ExposureCompApplyGain node.
 * \param [in] graph      The reference to the graph.
@@ -273,12 +299,13 @@ VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompSolveForGainNode(vx_graph gra
 * \param [in] in_gains   Array of valid regions of rectangles
 * \param [in] in_offsets Array of StitchExpCompCalcEntry
 * \param [out] output    Exposure adjusted image.
+* \param [in] num_gain_channels Number of gains per camera in in_gains: 1 - luma gain, 3 - R, G, B gains
 * \see <tt>AMDOVX_KERNEL_STITCHING_EXPOSURE_COMP_SOLVE_FOR_GAIN</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchExposureCompApplyGainNode(vx_graph graph, vx_image input,
-	vx_array in_gains, vx_array in_offsets, vx_image output);
+	vx_array in_gains, vx_array in_offsets, vx_image output, vx_uint32 num_gain_channels);
 
 /*! \brief [Graph] Creates a stitchBlendMultiBandMerge node.
 * \param [in] graph         The reference to the graph.
@@ -414,13 +441,15 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindK2Node(vx_graph graph, vx_scalar
 * \param [in] pref_seam     The input array of seam preference.
 * \param [in] info_seam     The input seam info array.
 * \param [out] output       The output seam_accum array.
+* \param [in] executeFlag   The input scalar to bypass the execution of kernel.
 * \see <tt>AMDOVX_KERNEL_STITCHING_SEAMFIND_K2</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostAccumulateNode(vx_graph graph, vx_scalar current_frame,
 	vx_uint32 output_width, vx_uint32 output_height, vx_image magnitude_img, vx_image phase_img,
-	vx_image mask_img, vx_array valid_seam, vx_array pref_seam, vx_array info_seam, vx_array accum_seam);
+	vx_image mask_img, vx_array valid_seam, vx_array pref_seam, vx_array info_seam, vx_array accum_seam,
+	vx_scalar executeFlag);
 
 /*! \brief [Graph] Creates a SeamFind Accumulate node K3_A - GPU/CPU.
 * \param [in] graph The reference to the graph.
@@ -430,12 +459,13 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindCostAccumulateNode(vx_graph graph
 * \param [in] seam_accum    The input seam_accum array.
 * \param [in] seam_pref     The input array of seam preference
 * \param [out] output       The Path Array.
+* \param [in] executeFlag   The input scalar to bypass the execution of kernel.
 * \see <tt>AMDOVX_KERNEL_STITCHING_SEAMFIND_K3_A</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindPathTraceNode(vx_graph graph, vx_scalar current_frame, vx_image weight_image, vx_array seam_info,
-	vx_array seam_accum, vx_array seam_pref, vx_array paths);
+	vx_array seam_accum, vx_array seam_pref, vx_array paths, vx_scalar executeFlag);
 
 /*! \brief [Graph] Creates a SeamFind Accumulate node K3_B - GPU.
 * \param [in] graph         The reference to the graph.
@@ -447,13 +477,26 @@ VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindPathTraceNode(vx_graph graph, vx_
 * \param [in] seam_path     The input array of seam path .
 * \param [in] seam_pref     The input array of seam preference.
 * \param [out] output       The weight image.
+* \param [in] flags         The input debug flags.
+* \param [in] executeFlag   The input scalar to bypass the execution of kernel.
 * \see <tt>AMDOVX_KERNEL_STITCHING_SEAMFIND_K3_B</tt>
 * \return <tt>\ref vx_node</tt>.
 * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
 */
 VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindSetWeightsNode(vx_graph graph, vx_scalar current_frame, vx_uint32 NumCam,
 	vx_uint32 output_width, vx_uint32 output_height, vx_array seam_weight, vx_array seam_path,
-	vx_array seam_pref, vx_image weight_image, vx_uint32 flags);
+	vx_array seam_pref, vx_image weight_image, vx_uint32 flags, vx_scalar executeFlag);
+
+/*! \brief [Graph] Creates a SeamFind Analyze node - CPU.
+* \param [in] graph         The reference to the graph.
+* \param [in] current_frame The input Current Frame.
+* \param [in] seam_pref     The input array of seam preference.
+* \param [out] executeFlag  The output scalar set when any overlap is due for seam find on the current frame.
+* \see <tt>AMDOVX_KERNEL_STITCHING_SEAMFIND_ANALYZE</tt>
+* \return <tt>\ref vx_node</tt>.
+* \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
+*/
+VX_API_ENTRY vx_node VX_API_CALL stitchSeamFindAnalyzeNode(vx_graph graph, vx_scalar current_frame, vx_array seam_pref, vx_scalar executeFlag);
 
 /*! \brief [Graph] Creates a SeamFind CPU Node.
 * \param [in] graph         The reference to the graph.
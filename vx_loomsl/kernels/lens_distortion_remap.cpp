@@ -433,14 +433,15 @@ vx_status GenerateValidMaskImage(
 	vx_uint8 * maskBuf                    // [out] valid mask image buffer: size: [eqrWidth * eqrHeight * numCamera]
 	)
 {
-	vx_uint32 maskPosition = 0;
-	for (vx_uint32 camId = 0; camId < numCamera; camId++) {
-		vx_uint32 camMaskBit = 1 << camId;
-		for (vx_uint32 y = 0, pixelPosition = 0; y < eqrHeight; y++) {
-			for (vx_uint32 x = 0; x < eqrWidth; x++, pixelPosition++) {
-				maskBuf[maskPosition + x] = (validPixelCamMap[pixelPosition] & camMaskBit) ? 255 : 0;
-			}
-			maskPosition += maskStride;
+	// every row of every camera is independent
+	vx_int32 numRows = (vx_int32)(numCamera * eqrHeight);
+	#pragma omp parallel for
+	for (vx_int32 row = 0; row < numRows; row++) {
+		vx_uint32 camMaskBit = 1 << (row / eqrHeight);
+		const vx_uint32 * validPixelCamMapRow = validPixelCamMap + (row % eqrHeight) * eqrWidth;
+		vx_uint8 * maskRow = maskBuf + row * maskStride;
+		for (vx_uint32 x = 0; x < eqrWidth; x++) {
+			maskRow[x] = (validPixelCamMapRow[x] & camMaskBit) ? 255 : 0;
 		}
 	}
 	return VX_SUCCESS;
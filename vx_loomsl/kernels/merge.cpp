@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
 #include "merge.h"
+#include "color_convert.h"
 
 #pragma intrinsic(_BitScanReverse)
 
@@ -136,7 +137,7 @@ static vx_status VX_CALLBACK merge_output_validator(vx_node node, vx_uint32 inde
 {
 	vx_status status = VX_ERROR_INVALID_PARAMETERS;
 	if (index == 5)
-	{ // image of format RGB2
+	{ // image of format RGB2 or RGBX or UYVY or YUYV
 		// get image configuration
 		vx_image image = (vx_image)avxGetNodeParamRef(node, 0);
 		ERROR_CHECK_OBJECT(image);
@@ -161,7 +162,8 @@ static vx_status VX_CALLBACK merge_output_validator(vx_node node, vx_uint32 inde
 		{ // pick default output height as the input map height
 			output_height = input_height;
 		}
-		if ((output_format != VX_DF_IMAGE_RGB) && (output_format != VX_DF_IMAGE_RGBX))
+		if ((output_format != VX_DF_IMAGE_RGB) && (output_format != VX_DF_IMAGE_RGBX) &&
+			(output_format != VX_DF_IMAGE_UYVY) && (output_format != VX_DF_IMAGE_YUYV))
 		{ // pick default output format RGB
 			output_format = VX_DF_IMAGE_RGB;
 		}
@@ -180,7 +182,7 @@ static vx_status VX_CALLBACK merge_query_target_support(vx_graph graph, vx_node
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = StitchGetColorKernelTargetAffinity();
 	return VX_SUCCESS;
 }
 
@@ -323,6 +325,32 @@ static vx_status VX_CALLBACK merge_opencl_codegen(
 			"  }\n"
 			"}";
 	}
+	else if (output_format == VX_DF_IMAGE_UYVY || output_format == VX_DF_IMAGE_YUYV) {
+		// packed 4:2:2 output: BT.709 full range with chroma from even pixels (same as color_convert)
+		opencl_kernel_code +=
+			"  float3 cY = (float3)(0.2126f, 0.7152f, 0.0722f);\n"
+			"  float3 cU = (float3)(-0.1146f, -0.3854f, 0.5f);\n"
+			"  float3 cV = (float3)(0.5f, -0.4542f, -0.0458f);\n"
+			"  fa = clamp(fa, 0.0f, 255.0f);\n"
+			"  float4 f;\n";
+		if (output_format == VX_DF_IMAGE_UYVY) {
+			opencl_kernel_code +=
+				"  f.s0 = dot(cU, fa.s012) + 128.0f; f.s1 = dot(cY, fa.s012); f.s2 = dot(cV, fa.s012) + 128.0f; f.s3 = dot(cY, fa.s456); pRGB_out.s0 = amd_pack(f);\n"
+				"  f.s0 = dot(cU, fa.s89A) + 128.0f; f.s1 = dot(cY, fa.s89A); f.s2 = dot(cV, fa.s89A) + 128.0f; f.s3 = dot(cY, fa.sCDE); pRGB_out.s1 = amd_pack(f);\n";
+		}
+		else {
+			opencl_kernel_code +=
+				"  f.s0 = dot(cY, fa.s012); f.s1 = dot(cU, fa.s012) + 128.0f; f.s2 = dot(cY, fa.s456); f.s3 = dot(cV, fa.s012) + 128.0f; pRGB_out.s0 = amd_pack(f);\n"
+				"  f.s0 = dot(cY, fa.s89A); f.s1 = dot(cU, fa.s89A) + 128.0f; f.s2 = dot(cY, fa.sCDE); f.s3 = dot(cV, fa.s89A) + 128.0f; pRGB_out.s1 = amd_pack(f);\n";
+		}
+		opencl_kernel_code +=
+			"  if(camIdSelect != 31) {\n"
+			"    op_buf += op_offset + gy * op_stride + (gx << 3);\n"
+			"    *(__global uint2 *) op_buf = pRGB_out.s01;\n"
+			"    }\n"
+			"  }\n"
+			"}";
+	}
 	else { // RGBX out
 		opencl_kernel_code +=
 			"  pRGB_out.s0 = amd_pack(fa.s0123); pRGB_out.s0 |= Xmask;\n"
@@ -354,7 +382,102 @@ static vx_status VX_CALLBACK merge_deinitialize(vx_node node, const vx_reference
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK merge_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_IMPLEMENTED;
+	// host implementation: same camera selection and blending as the OpenCL kernel
+	vx_image cam_id_image = (vx_image)parameters[0];
+	vx_image group1_image = (vx_image)parameters[1];
+	vx_image group2_image = (vx_image)parameters[2];
+	vx_image input_image = (vx_image)parameters[3];
+	vx_image weight_image = (vx_image)parameters[4];
+	vx_image output_image = (vx_image)parameters[5];
+	vx_uint32 cam_id_width = 0, cam_id_height = 0, input_width = 0, input_height = 0, width = 0, height = 0;
+	vx_df_image output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(cam_id_image, VX_IMAGE_ATTRIBUTE_WIDTH, &cam_id_width, sizeof(cam_id_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(cam_id_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &cam_id_height, sizeof(cam_id_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+
+	vx_rectangle_t cam_id_rect = { 0, 0, cam_id_width, cam_id_height };
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height };
+	vx_rectangle_t output_rect = { 0, 0, width, height };
+	vx_imagepatch_addressing_t cam_id_addr, group1_addr, group2_addr, input_addr, weight_addr, output_addr;
+	void * cam_id_ptr = nullptr, * group1_ptr = nullptr, * group2_ptr = nullptr, * input_ptr = nullptr, * weight_ptr = nullptr, * output_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(cam_id_image, &cam_id_rect, 0, &cam_id_addr, &cam_id_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(group1_image, &cam_id_rect, 0, &group1_addr, &group1_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(group2_image, &cam_id_rect, 0, &group2_addr, &group2_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(weight_image, &input_rect, 0, &weight_addr, &weight_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+
+	vx_float32 wt_mul_factor = 1.0f / 255.0f;
+	#pragma omp parallel for
+	for (vx_int32 gy = 0; gy < (vx_int32)height; gy++) {
+		const vx_uint8 * cam_id_row = (const vx_uint8 *)cam_id_ptr + gy * cam_id_addr.stride_y;
+		const StitchMergeCamIdEntry * group1_row = (const StitchMergeCamIdEntry *)((const vx_uint8 *)group1_ptr + gy * group1_addr.stride_y);
+		const StitchMergeCamIdEntry * group2_row = (const StitchMergeCamIdEntry *)((const vx_uint8 *)group2_ptr + gy * group2_addr.stride_y);
+		vx_uint8 * op_row = (vx_uint8 *)output_ptr + gy * output_addr.stride_y;
+		for (vx_uint32 gx = 0; gx < (width >> 2); gx++) {
+			vx_uint8 camIdSelect = cam_id_row[gx >> 1];
+			if (camIdSelect == 31)
+				continue;
+			// pick the cameras contributing to this group of 4 pixels
+			vx_uint32 camList[6], camCount = 0;
+			bool weighted = camIdSelect > 31;
+			if (!weighted) {
+				camList[camCount++] = camIdSelect;
+			}
+			else {
+				StitchMergeCamIdEntry group1 = group1_row[gx >> 1];
+				camList[camCount++] = group1.camId0;
+				camList[camCount++] = group1.camId1;
+				if (camIdSelect > 128) camList[camCount++] = group1.camId2;
+				StitchMergeCamIdEntry group2 = group2_row[gx >> 1];
+				if (camIdSelect > 129) camList[camCount++] = group2.camId0;
+				if (camIdSelect > 130) camList[camCount++] = group2.camId1;
+				if (camIdSelect > 131) camList[camCount++] = group2.camId2;
+			}
+			vx_float32 fa[4][3] = { { 0 } };
+			for (vx_uint32 k = 0; k < camCount; k++) {
+				vx_uint32 camId = camList[k];
+				if (camId == 31)
+					continue;
+				vx_uint32 row = gy + height * camId;
+				const vx_uint8 * ip = (const vx_uint8 *)input_ptr + row * input_addr.stride_y + (gx << 4);
+				const vx_uint8 * wt = (const vx_uint8 *)weight_ptr + row * weight_addr.stride_y + (gx << 2);
+				for (int i = 0; i < 4; i++) {
+					vx_float32 w = weighted ? wt[i] * wt_mul_factor : 1.0f;
+					fa[i][0] += w * ip[4 * i + 0];
+					fa[i][1] += w * ip[4 * i + 1];
+					fa[i][2] += w * ip[4 * i + 2];
+				}
+			}
+			if (output_format == VX_DF_IMAGE_UYVY || output_format == VX_DF_IMAGE_YUYV) {
+				for (int i = 0; i < 4; i++)
+					for (int c = 0; c < 3; c++)
+						fa[i][c] = std::min(std::max(fa[i][c], 0.0f), 255.0f);
+				StitchRgbToYuvPair(output_format, fa[0], fa[1], op_row + (gx << 3));
+				StitchRgbToYuvPair(output_format, fa[2], fa[3], op_row + (gx << 3) + 4);
+			}
+			else {
+				vx_uint32 pixel_size = (output_format == VX_DF_IMAGE_RGBX) ? 4 : 3;
+				vx_uint8 * op = op_row + gx * 4 * pixel_size;
+				for (int i = 0; i < 4; i++, op += pixel_size) {
+					op[0] = StitchClampToU8(fa[i][0]); op[1] = StitchClampToU8(fa[i][1]); op[2] = StitchClampToU8(fa[i][2]);
+					if (pixel_size == 4) op[3] = 0xff;
+				}
+			}
+		}
+	}
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(cam_id_image, &cam_id_rect, 0, &cam_id_addr, cam_id_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(group1_image, &cam_id_rect, 0, &group1_addr, group1_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(group2_image, &cam_id_rect, 0, &group2_addr, group2_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &input_rect, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(weight_image, &input_rect, 0, &weight_addr, weight_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
@@ -406,19 +529,26 @@ vx_status GenerateMergeBuffers(
 	StitchMergeCamIdEntry * camGroup2Buf  // [out] camId Group2 table (image)
 	)
 {
-	for (vx_uint32 y = 0; y < eqrHeight; y++) {
+	// every row is independent
+	#pragma omp parallel for
+	for (vx_int32 y = 0; y < (vx_int32)eqrHeight; y++) {
+		const vx_uint32 * validPixelCamMapRow = validPixelCamMap + y * eqrWidth;
+		const vx_uint32 * paddedPixelCamMapRow = paddedPixelCamMap ? paddedPixelCamMap + y * eqrWidth : nullptr;
+		vx_uint8 * camIdRow = camIdBuf + y * camIdStride;
+		StitchMergeCamIdEntry * camGroup1Row = camGroup1Buf + y * (camGroup1Stride >> 1);
+		StitchMergeCamIdEntry * camGroup2Row = camGroup2Buf + y * (camGroup2Stride >> 1);
 		for (vx_uint32 x = 0, xi = 0; x < eqrWidth; x += 8, xi++) {
 			vx_uint32 validMaskFor8Pixels =
-				validPixelCamMap[x + 0] | validPixelCamMap[x + 1] |
-				validPixelCamMap[x + 2] | validPixelCamMap[x + 3] |
-				validPixelCamMap[x + 4] | validPixelCamMap[x + 5] |
-				validPixelCamMap[x + 6] | validPixelCamMap[x + 7];
-			if (paddedPixelCamMap) {
+				validPixelCamMapRow[x + 0] | validPixelCamMapRow[x + 1] |
+				validPixelCamMapRow[x + 2] | validPixelCamMapRow[x + 3] |
+				validPixelCamMapRow[x + 4] | validPixelCamMapRow[x + 5] |
+				validPixelCamMapRow[x + 6] | validPixelCamMapRow[x + 7];
+			if (paddedPixelCamMapRow) {
 				validMaskFor8Pixels |=
-					paddedPixelCamMap[x + 0] | paddedPixelCamMap[x + 1] |
-					paddedPixelCamMap[x + 2] | paddedPixelCamMap[x + 3] |
-					paddedPixelCamMap[x + 4] | paddedPixelCamMap[x + 5] |
-					paddedPixelCamMap[x + 6] | paddedPixelCamMap[x + 7];
+					paddedPixelCamMapRow[x + 0] | paddedPixelCamMapRow[x + 1] |
+					paddedPixelCamMapRow[x + 2] | paddedPixelCamMapRow[x + 3] |
+					paddedPixelCamMapRow[x + 4] | paddedPixelCamMapRow[x + 5] |
+					paddedPixelCamMapRow[x + 6] | paddedPixelCamMapRow[x + 7];
 			}
 			vx_uint32 count = __popcnt(validMaskFor8Pixels);
 			vx_uint8 camId = 31;
@@ -426,20 +556,20 @@ vx_status GenerateMergeBuffers(
 			if (count == 1) {
 				// use two pixel mode with second cam as 31 if not all 8 pixels are from same camera
 				vx_uint32 commonValidMaskFor8Pixels =
-					validPixelCamMap[x + 0] & validPixelCamMap[x + 1] &
-					validPixelCamMap[x + 2] & validPixelCamMap[x + 3] &
-					validPixelCamMap[x + 4] & validPixelCamMap[x + 5] &
-					validPixelCamMap[x + 6] & validPixelCamMap[x + 7];
-				if (paddedPixelCamMap) {
+					validPixelCamMapRow[x + 0] & validPixelCamMapRow[x + 1] &
+					validPixelCamMapRow[x + 2] & validPixelCamMapRow[x + 3] &
+					validPixelCamMapRow[x + 4] & validPixelCamMapRow[x + 5] &
+					validPixelCamMapRow[x + 6] & validPixelCamMapRow[x + 7];
+				if (paddedPixelCamMapRow) {
 					commonValidMaskFor8Pixels =
-						(validPixelCamMap[x + 0] & paddedPixelCamMap[x + 0]) &
-						(validPixelCamMap[x + 1] & paddedPixelCamMap[x + 1]) &
-						(validPixelCamMap[x + 2] & paddedPixelCamMap[x + 2]) &
-						(validPixelCamMap[x + 3] & paddedPixelCamMap[x + 3]) &
-						(validPixelCamMap[x + 4] & paddedPixelCamMap[x + 4]) &
-						(validPixelCamMap[x + 5] & paddedPixelCamMap[x + 5]) &
-						(validPixelCamMap[x + 6] & paddedPixelCamMap[x + 6]) &
-						(validPixelCamMap[x + 7] & paddedPixelCamMap[x + 7]);
+						(validPixelCamMapRow[x + 0] & paddedPixelCamMapRow[x + 0]) &
+						(validPixelCamMapRow[x + 1] & paddedPixelCamMapRow[x + 1]) &
+						(validPixelCamMapRow[x + 2] & paddedPixelCamMapRow[x + 2]) &
+						(validPixelCamMapRow[x + 3] & paddedPixelCamMapRow[x + 3]) &
+						(validPixelCamMapRow[x + 4] & paddedPixelCamMapRow[x + 4]) &
+						(validPixelCamMapRow[x + 5] & paddedPixelCamMapRow[x + 5]) &
+						(validPixelCamMapRow[x + 6] & paddedPixelCamMapRow[x + 6]) &
+						(validPixelCamMapRow[x + 7] & paddedPixelCamMapRow[x + 7]);
 				}
 
 				if (commonValidMaskFor8Pixels == 0) {
@@ -461,15 +591,10 @@ vx_status GenerateMergeBuffers(
 			}
 			StitchMergeCamIdEntry group1 = { id[0], id[1], id[2], 0 };
 			StitchMergeCamIdEntry group2 = { id[3], id[4], id[5], 0 };
-			camIdBuf[xi] = camId;
-			camGroup1Buf[xi] = group1;
-			camGroup2Buf[xi] = group2;
+			camIdRow[xi] = camId;
+			camGroup1Row[xi] = group1;
+			camGroup2Row[xi] = group2;
 		}
-		validPixelCamMap += eqrWidth;
-		if (paddedPixelCamMap) paddedPixelCamMap += eqrWidth;
-		camIdBuf += camIdStride;
-		camGroup1Buf += (camGroup1Stride >> 1);
-		camGroup2Buf += (camGroup2Stride >> 1);
 	}
 	return VX_SUCCESS;
 }
@@ -485,13 +610,15 @@ vx_status GenerateDefaultMergeMaskImage(
 	vx_uint8 * maskBuf                    // [out] mask image buffer: size: [eqrWidth * eqrHeight * numCamera]
 	)
 {
-	vx_uint32 maskPosition = 0;
-	for (vx_uint32 camId = 0; camId < numCamera; camId++) {
-		for (vx_uint32 y = 0, pixelPosition = 0; y < eqrHeight; y++) {
-			for (vx_uint32 x = 0; x < eqrWidth; x++, pixelPosition++) {
-				maskBuf[maskPosition + x] = (defaultCamIndex[pixelPosition] == camId) ? 255 : 0;
-			}
-			maskPosition += maskStride;
+	// every row of every camera is independent
+	vx_int32 numRows = (vx_int32)(numCamera * eqrHeight);
+	#pragma omp parallel for
+	for (vx_int32 row = 0; row < numRows; row++) {
+		vx_uint32 camId = row / eqrHeight;
+		const vx_uint8 * camIndexRow = defaultCamIndex + (row % eqrHeight) * eqrWidth;
+		vx_uint8 * maskRow = maskBuf + row * maskStride;
+		for (vx_uint32 x = 0; x < eqrWidth; x++) {
+			maskRow[x] = (camIndexRow[x] == camId) ? 255 : 0;
 		}
 	}
 	return VX_SUCCESS;
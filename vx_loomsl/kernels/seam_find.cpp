@@ -263,14 +263,13 @@ static vx_status VX_CALLBACK seamfind_model_kernel(vx_node node, const vx_refere
 	vx_uint8 *output_weight_ptr = (vx_uint8*)new_weight_image_ptr;
 
 	//Copy basic weight into output weight img
-	void *ptr1 = nullptr;	void *ptr2 = nullptr;
 	size_t len = output_weight_addr.stride_x * (output_weight_addr.dim_x * output_weight_addr.scale_x) / VX_SCALE_UNITY;
 
 #pragma omp parallel for
-	for (vx_uint32 y = 0; y < height; y += output_weight_addr.step_y)
+	for (vx_int32 y = 0; y < (vx_int32)height; y += output_weight_addr.step_y)
 	{
-		ptr1 = vxFormatImagePatchAddress2d(weight_image_ptr, 0, y - output_weight_rect.start_y, &output_weight_addr);
-		ptr2 = vxFormatImagePatchAddress2d(new_weight_image_ptr, 0, y - output_weight_rect.start_y, &output_weight_addr);
+		void *ptr1 = vxFormatImagePatchAddress2d(weight_image_ptr, 0, y - output_weight_rect.start_y, &output_weight_addr);
+		void *ptr2 = vxFormatImagePatchAddress2d(new_weight_image_ptr, 0, y - output_weight_rect.start_y, &output_weight_addr);
 		memcpy(ptr2, ptr1, len);
 	}
 
@@ -298,8 +297,7 @@ static vx_status VX_CALLBACK seamfind_model_kernel(vx_node node, const vx_refere
 	if (StitchGetEnvironmentVariable("SEAM_ADJUST", textBuffer, sizeof(textBuffer))){ SEAM_ADJUST = atoi(textBuffer); }
 	if (StitchGetEnvironmentVariable("PRINT_COST", textBuffer, sizeof(textBuffer))){ PRINT_COST = atoi(textBuffer); }
 
-	//Loop over all the overlap camera once
-#pragma omp parallel for shared(overlap_count)
+	//Loop over all the overlap camera once: overlap_count and the seam weights are updated in order, so this stays serial
 	for (vx_uint32 i = 0; i < NumCam; i++)
 	for (vx_uint32 j = i + 1; j < NumCam; j++)
 	{
@@ -322,7 +320,7 @@ static vx_status VX_CALLBACK seamfind_model_kernel(vx_node node, const vx_refere
 			if (y_dir >= x_dir)
 			{
 #if ENABLE_VERTICAL_SEAM
-#pragma omp parallel for shared(cost_array)
+				//Each row depends on the row above, so the cost scan is serial
 				for (vx_uint32 ye = Overlap_ROI[ID].start_y; ye <= Overlap_ROI[ID].end_y; ye++)
 				for (vx_uint32 xe = Overlap_ROI[ID].start_x; xe <= Overlap_ROI[ID].end_x; xe++)
 				{
@@ -423,8 +421,7 @@ static vx_status VX_CALLBACK seamfind_model_kernel(vx_node node, const vx_refere
 					if (output_weight_ptr[weight_pixel_check] == 255){ i_val = 255; j_val = 0; }
 					else{ i_val = 0; j_val = 255; }
 
-					//Weights manipulation to match the seam
-#pragma omp parallel for shared(i_val, j_val)
+					//Weights manipulation to match the seam: i_val/j_val flip at the seam, so the scan is serial
 					for (vx_int32 xe = Overlap_ROI[ID].end_x; xe >= (vx_int32)Overlap_ROI[ID].start_x; xe--)
 					{
 						vx_uint32 pixel_id_1 = ((min_y + offset_1) * Img_width) + xe;
@@ -478,7 +475,7 @@ static vx_status VX_CALLBACK seamfind_model_kernel(vx_node node, const vx_refere
 			else if (x_dir > y_dir)
 			{
 #if ENABLE_HORIZONTAL_SEAM
-#pragma omp parallel for shared(cost_array)
+				//Each column depends on the column to the left, so the cost scan is serial
 				for (vx_uint32 xe = Overlap_ROI[ID].start_x; xe <= Overlap_ROI[ID].end_x; xe++)
 				for (vx_uint32 ye = Overlap_ROI[ID].start_y; ye <= Overlap_ROI[ID].end_y; ye++)
 				{
@@ -1105,9 +1102,48 @@ static vx_status VX_CALLBACK seamfind_scene_detect_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief The scene detect node-local data: the environment overrides are resolved once at node initialize.
+struct seamfind_scene_detect_data {
+	int SEAM_THRESHOLD;     // SAD threshold for a scene change (overridden by the live threshold scalar)
+	int VIEW_SCENE_CHANGE;  // debug view of scene changes
+	int SCENE_DURATION;     // number of frames the seam stays locked after a scene change
+};
+
+//! \brief The kernel initialize.
+static vx_status VX_CALLBACK seamfind_scene_detect_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	seamfind_scene_detect_data * data = new seamfind_scene_detect_data;
+	char textBuffer[256];
+	data->SEAM_THRESHOLD = 1500; data->VIEW_SCENE_CHANGE = 0; data->SCENE_DURATION = 150;
+	if (StitchGetEnvironmentVariable("SEAM_THRESHOLD", textBuffer, sizeof(textBuffer))) { data->SEAM_THRESHOLD = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("VIEW_SCENE_CHANGE", textBuffer, sizeof(textBuffer))) { data->VIEW_SCENE_CHANGE = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("SCENE_DURATION", textBuffer, sizeof(textBuffer))) { data->SCENE_DURATION = atoi(textBuffer); }
+	vx_size size = sizeof(seamfind_scene_detect_data);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitialize.
+static vx_status VX_CALLBACK seamfind_scene_detect_deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(seamfind_scene_detect_data)))
+	{
+		seamfind_scene_detect_data * data = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+		if (data) delete data;
+	}
+	return VX_SUCCESS;
+}
+
 //! \brief The kernel execution on the CPU.
 static vx_status VX_CALLBACK seamfind_scene_detect_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
+	seamfind_scene_detect_data * data = nullptr;
+	ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	if (!data) return VX_ERROR_NOT_ALLOCATED;
+
 	//Number Of Cameras - Variable 0 & 1
 	vx_uint32 current_frame = 0, width_eqr = 0, height_eqr = 0, Threshold_scalar = 0;
 	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &current_frame));
@@ -1122,6 +1158,7 @@ static vx_status VX_CALLBACK seamfind_scene_detect_kernel(vx_node node, const vx
 	input_rect.start_x = input_rect.start_y = 0; input_rect.end_x = input_width; input_rect.end_y = input_height;
 	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, plane, &input_addr, &input_image_ptr, VX_READ_ONLY));
 	vx_uint8 *input_ptr = (vx_uint8*)input_image_ptr;
+	vx_int32 input_stride = input_addr.stride_y;
 	width_eqr = input_width;
 	height_eqr = (width_eqr >> 1);
 
@@ -1145,169 +1182,79 @@ static vx_status VX_CALLBACK seamfind_scene_detect_kernel(vx_node node, const vx
 	stride = sizeof(StitchSeamFindSceneEntry);
 	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_previous_scene, 0, arr_numitems, &stride, (void **)&Seam_Previous_scene, VX_READ_AND_WRITE));
 
-	//Local SeamScene Data
-	std::vector<StitchSeamFindSceneEntry> current_seam_scene;
-	current_seam_scene.resize(arr_numitems);
-
-	//Get ENV Variables to override/set pref
-	char textBuffer[256];
-	int SEAM_THRESHOLD = 1500, VIEW_SCENE_CHANGE = 0, SCENE_DURATION = 150, SEAM_FREQUENCY = 300;
-	if (StitchGetEnvironmentVariable("SEAM_THRESHOLD", textBuffer, sizeof(textBuffer))) { SEAM_THRESHOLD = atoi(textBuffer); }
-	if (StitchGetEnvironmentVariable("VIEW_SCENE_CHANGE", textBuffer, sizeof(textBuffer))) { VIEW_SCENE_CHANGE = atoi(textBuffer); }
-	if (StitchGetEnvironmentVariable("SCENE_DURATION", textBuffer, sizeof(textBuffer))) { SCENE_DURATION = atoi(textBuffer); }
-	if (StitchGetEnvironmentVariable("SEAM_FREQUENCY", textBuffer, sizeof(textBuffer))){ SEAM_FREQUENCY = atoi(textBuffer); }
+	//ENV Variables to override/set pref
+	int SEAM_THRESHOLD = data->SEAM_THRESHOLD, VIEW_SCENE_CHANGE = data->VIEW_SCENE_CHANGE, SCENE_DURATION = data->SCENE_DURATION;
 
 	//Live Updated Threshold value
 	if (Threshold_scalar){ SEAM_THRESHOLD = (int)((Threshold_scalar * (192 * 255)) * 0.01); }
 
-	//Loop over all the overlap camera once
-	for (vx_uint32 i = 0; i < arr_numitems; i++)
+	//Loop over all the overlap camera once: each overlap only updates its own preference and scene entries
+#pragma omp parallel for
+	for (vx_int32 i = 0; i < (vx_int32)arr_numitems; i++)
 	{
 		vx_uint32 offset_1 = SeamFindInfo_ptr[i].cam_id_1 * height_eqr;
 		vx_uint32 offset_2 = SeamFindInfo_ptr[i].cam_id_2 * height_eqr;
 		int y_dir = SeamFindInfo_ptr[i].end_y - SeamFindInfo_ptr[i].start_y;
 		int x_dir = SeamFindInfo_ptr[i].end_x - SeamFindInfo_ptr[i].start_x;
-		/***********************************************************************************************************************************
-		Vertical SeamCut
-		************************************************************************************************************************************/
-		if (y_dir >= x_dir)
-		{
-#if	ENABLE_VERTICAL_SEAM
-			//count down previous scene change
-			if (Seam_Pref[i].scene_flag != 0)
-			{
-				Seam_Pref[i].seam_lock--;
-				if (Seam_Pref[i].seam_lock == 0)
-				{
-					Seam_Pref[i].scene_flag = 0;
-					if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
-						Seam_Pref[i].start_frame = current_frame;
-				}
-			}
+		// Vertical SeamCut: segments are spread along y; Horizontal SeamCut: segments are spread along x
+		bool vertical = (y_dir >= x_dir);
+		if ((vertical && !ENABLE_VERTICAL_SEAM) || (!vertical && !ENABLE_HORIZONTAL_SEAM))
+			continue;
 
-			//Find current frame segement values
-			for (int f = 0; f < 8; f++)
-			{
-				int y_start = SeamFindInfo_ptr[i].start_y + ((y_dir / 8) * f);
-				for (int g = 0; g < 3; g++)
-				{
-					int x_start = SeamFindInfo_ptr[i].start_x + (((x_dir / 2) + ((x_dir / 10)*(g - 1))) - 4);
-					for (int k = 0; k < MAX_SEAM_BYTES; k++)
-					{
-						int cost_id_1 = ((y_start + offset_1)*width_eqr) + (x_start + k);
-						int cost_id_2 = ((y_start + offset_2)*width_eqr) + (x_start + k);
-						if (input_ptr[cost_id_1] && input_ptr[cost_id_2])
-						{
-#if 1
-							current_seam_scene[i].segment[(f * 3) + g][k] = abs(input_ptr[cost_id_1]); //Check cost from one image
-#else
-							current_seam_scene[i].segment[(f * 3) + g][k] = abs((input_ptr[cost_id_1] + input_ptr[cost_id_2]) / 2);//Check cost from two images
-#endif
-						}
-					}
-				}
-			}
-			//First Frame reference value stored
-			if (current_frame == 0)
-			{
-				for (int f = 0; f < MAX_SEGMENTS; f++)
-				for (int k = 0; k < MAX_SEAM_BYTES; k++)
-					Seam_Previous_scene[i].segment[f][k] = current_seam_scene[i].segment[f][k];
-			}
-			//Else calculate SAD and store the values
-			else
+		//count down previous scene change
+		if (Seam_Pref[i].scene_flag != 0)
+		{
+			Seam_Pref[i].seam_lock--;
+			if (Seam_Pref[i].seam_lock == 0)
 			{
-				int SAD = 0;
-				for (int f = 0; f < MAX_SEGMENTS; f++)
-				for (int k = 0; k < MAX_SEAM_BYTES; k++)
-				{
-					SAD += abs(Seam_Previous_scene[i].segment[f][k] - current_seam_scene[i].segment[f][k]);
-					Seam_Previous_scene[i].segment[f][k] = current_seam_scene[i].segment[f][k];
-				}
-				//if scene change detected, set seam to be found in the current frame
-				if (SAD > SEAM_THRESHOLD && Seam_Pref[i].scene_flag == 0)
-				{
+				Seam_Pref[i].scene_flag = 0;
+				if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
 					Seam_Pref[i].start_frame = current_frame;
-					Seam_Pref[i].scene_flag = 1;
-					Seam_Pref[i].seam_lock = SCENE_DURATION;
-					if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
-						Seam_Pref[i].scene_flag = (VIEW_SCENE_CHANGE + 1);
-				}
 			}
-#endif
 		}
-		/***********************************************************************************************************************************
-		Horizontal SeamCut
-		************************************************************************************************************************************/
-		else if (x_dir > y_dir)
+
+		//Find current frame segment values: each segment is MAX_SEAM_BYTES consecutive pixels of a row
+		//the cost is checked from one image and only where both images are valid
+		StitchSeamFindSceneEntry current_seam_scene;
+		for (int f = 0; f < 8; f++)
 		{
-#if ENABLE_HORIZONTAL_SEAM
-			//count down previous scene change
-			if (Seam_Pref[i].scene_flag != 0)
+			for (int g = 0; g < 3; g++)
 			{
-				Seam_Pref[i].seam_lock--;
-				if (Seam_Pref[i].seam_lock == 0)
-				{
-					Seam_Pref[i].scene_flag = 0;
-					if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
-						Seam_Pref[i].start_frame = current_frame;
+				int x_start, y_start;
+				if (vertical) {
+					y_start = SeamFindInfo_ptr[i].start_y + ((y_dir / 8) * f);
+					x_start = SeamFindInfo_ptr[i].start_x + (((x_dir / 2) + ((x_dir / 10)*(g - 1))) - 4);
 				}
-			}
-
-			//Find current frame segement value
-			for (int f = 0; f < 8; f++)
-			{
-				int x_start = SeamFindInfo_ptr[i].start_x + ((x_dir / 8) * f);
-				for (int g = 0; g < 3; g++)
-				{
-					int y_start = SeamFindInfo_ptr[i].start_y + (((y_dir / 2) + ((y_dir / 10)*(g - 1))) - 4);
-					for (int k = 0; k < MAX_SEAM_BYTES; k++)
-					{
-						int cost_id_1 = ((y_start + offset_1)*width_eqr) + (x_start + k);
-						int cost_id_2 = ((y_start + offset_2)*width_eqr) + (x_start + k);
-						if (input_ptr[cost_id_1] && input_ptr[cost_id_2])
-						{
-#if 1
-							current_seam_scene[i].segment[(f * 3) + g][k] = abs(input_ptr[cost_id_1]);//Check cost from one image
-#else
-							current_seam_scene[i].segment[(f * 3) + g][k] = abs((input_ptr[cost_id_1] + input_ptr[cost_id_2]) / 2);//Check cost from two images
-#endif
-						}
-					}
+				else {
+					x_start = SeamFindInfo_ptr[i].start_x + ((x_dir / 8) * f);
+					y_start = SeamFindInfo_ptr[i].start_y + (((y_dir / 2) + ((y_dir / 10)*(g - 1))) - 4);
 				}
-			}
-			//First Frame reference value stored
-			if (current_frame == 0)
-			{
-				for (int f = 0; f < MAX_SEGMENTS; f++)
+				const vx_uint8 * pixel_1 = input_ptr + (y_start + offset_1) * input_stride + x_start;
+				const vx_uint8 * pixel_2 = input_ptr + (y_start + offset_2) * input_stride + x_start;
+				vx_uint8 * segment = current_seam_scene.segment[(f * 3) + g];
 				for (int k = 0; k < MAX_SEAM_BYTES; k++)
-					Seam_Previous_scene[i].segment[f][k] = current_seam_scene[i].segment[f][k];
+					segment[k] = pixel_2[k] ? pixel_1[k] : 0;
 			}
-			//Else calculate SAD and store the values
-			else
+		}
+		//Calculate SAD against the previous frame, except for the first frame which only stores the reference values
+		if (current_frame != 0)
+		{
+			const vx_uint8 * prev = &Seam_Previous_scene[i].segment[0][0];
+			const vx_uint8 * curr = &current_seam_scene.segment[0][0];
+			int SAD = 0;
+			for (int k = 0; k < MAX_SEGMENTS * MAX_SEAM_BYTES; k++)
+				SAD += abs((int)prev[k] - (int)curr[k]);
+			//if scene change detected, set seam to be found in the current frame
+			if (SAD > SEAM_THRESHOLD && Seam_Pref[i].scene_flag == 0)
 			{
-				int SAD = 0;
-				for (int f = 0; f < MAX_SEGMENTS; f++)
-				for (int k = 0; k < MAX_SEAM_BYTES; k++)
-				{
-					SAD += abs(Seam_Previous_scene[i].segment[f][k] - current_seam_scene[i].segment[f][k]);
-					Seam_Previous_scene[i].segment[f][k] = current_seam_scene[i].segment[f][k];
-				}
-				//if scene change detected, set seam to be found in the current frame
-				if (SAD > SEAM_THRESHOLD && Seam_Pref[i].scene_flag == 0)
-				{
-					Seam_Pref[i].start_frame = current_frame;
-					Seam_Pref[i].scene_flag = 1;
-					Seam_Pref[i].seam_lock = SCENE_DURATION;
-					if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
-						Seam_Pref[i].scene_flag = (VIEW_SCENE_CHANGE + 1);
-				}
+				Seam_Pref[i].start_frame = current_frame;
+				Seam_Pref[i].scene_flag = 1;
+				Seam_Pref[i].seam_lock = SCENE_DURATION;
+				if (VIEW_SCENE_CHANGE == 1 || VIEW_SCENE_CHANGE == 2)
+					Seam_Pref[i].scene_flag = (VIEW_SCENE_CHANGE + 1);
 			}
-#endif
 		}
-		/***********************************************************************************************************************************
-		Special Case SeamCut: TBD
-		************************************************************************************************************************************/
+		Seam_Previous_scene[i] = current_seam_scene;
 	}
 
 	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &input_rect, 0, &input_addr, input_image_ptr));
@@ -1315,9 +1262,6 @@ static vx_status VX_CALLBACK seamfind_scene_detect_kernel(vx_node node, const vx
 	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_Pref, 0, arr_numitems, Seam_Pref));
 	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_previous_scene, 0, arr_numitems, Seam_Previous_scene));
 
-	//Clear Memory
-	current_seam_scene.clear();
-
 	return VX_SUCCESS;
 }
 
@@ -1331,8 +1275,8 @@ vx_status seamfind_scene_detect_publish(vx_context context)
 		6,
 		seamfind_scene_detect_input_validator,
 		seamfind_scene_detect_output_validator,
-		nullptr,
-		nullptr);
+		seamfind_scene_detect_initialize,
+		seamfind_scene_detect_deinitialize);
 	ERROR_CHECK_OBJECT(kernel);
 	amd_kernel_query_target_support_f query_target_support_f = seamfind_scene_detect_query_target_support;
 	amd_kernel_opencl_codegen_callback_f opencl_codegen_callback_f = seamfind_scene_detect_opencl_codegen;
@@ -1664,6 +1608,20 @@ static vx_status VX_CALLBACK seamfind_cost_accumulate_input_validator(vx_node no
 		}
 		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
 	}
+	else if (index == 10)
+	{ // object of SCALAR type for execute flag
+		vx_enum itemtype = VX_TYPE_INVALID;
+		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
+
+		if (itemtype == VX_TYPE_UINT32) {
+			status = VX_SUCCESS;
+		}
+		else {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: SeamFind Execute Flag scalar type should be a UINT32\n");
+		}
+		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
+	}
 	else if (index == 3)
 	{ // image of format U008
 		// check input image format and dimensions
@@ -1806,7 +1764,18 @@ static vx_status VX_CALLBACK seamfind_cost_accumulate_query_target_support(vx_gr
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	// the band refinement keeps the last seams in node local data and the coarse search is host only, so they run on the CPU.
+	// These modes are meant for CPU-only builds (STITCH_HOST_TARGET=1): in a GPU graph only this node moves to the CPU,
+	// and its images and tables are copied to and from the device on every due frame, which was not compared to the GPU kernel
+	char textBuffer[256];
+	int SEAM_REFINE_BAND = 0, SEAM_COARSE_SEARCH = 0;
+	if (StitchGetEnvironmentVariable("SEAM_REFINE_BAND", textBuffer, sizeof(textBuffer))) { SEAM_REFINE_BAND = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("SEAM_COARSE_SEARCH", textBuffer, sizeof(textBuffer))) { SEAM_COARSE_SEARCH = atoi(textBuffer); }
+
+	if (SEAM_REFINE_BAND <= 0 && SEAM_COARSE_SEARCH <= 0)
+		supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	else
+		supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
 	return VX_SUCCESS;
 }
 
@@ -1887,7 +1856,8 @@ static vx_status VX_CALLBACK seamfind_cost_accumulate_opencl_codegen(
 		"						__global char * seam_valid_buf, uint seam_valid_buf_offset, uint valid_pix_num_items,\n"
 		"						__global char * seam_pref_buf, uint seam_pref_buf_offset, uint seam_pref_num_items,\n"
 		"						__global char * seam_info_buf, uint seam_info_buf_offset, uint seam_info_num_items,\n"
-		"						__global char * seam_accum_buf, uint seam_accum_buf_offset, uint seam_num_items)\n"
+		"						__global char * seam_accum_buf, uint seam_accum_buf_offset, uint seam_num_items,\n"
+		"						uint execute_flag)\n"
 		, opencl_local_work[0], opencl_kernel_function_name);
 	opencl_kernel_code = item;
 	opencl_kernel_code +=
@@ -1895,7 +1865,7 @@ static vx_status VX_CALLBACK seamfind_cost_accumulate_opencl_codegen(
 		"\n"
 		"int gid = get_global_id(0);\n"
 		"\n"
-		"if (gid < valid_pix_num_items)\n"
+		"if (execute_flag && gid < valid_pix_num_items)\n"
 		"{\n"
 		"\n"
 		"	seam_valid_buf += seam_valid_buf_offset + (gid * 16);\n"
@@ -2324,10 +2294,459 @@ static vx_status VX_CALLBACK seamfind_cost_accumulate_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief The node local data of the CPU cost accumulate.
+struct seamfind_cost_accumulate_data {
+	int COST_SELECT;                    // cost from the first camera only (0) or from both cameras (1)
+	int SEAM_QUALITY;                   // edge bonus: 0 - off, 1 and 2 - thresholds
+	int SEAM_REFINE_BAND;               // half width of the search band around the last seam: 0 - full search
+	int SEAM_COARSE_SEARCH;             // half width of the full resolution corridor around the half resolution seam: 0 - full search
+	std::vector<vx_int16> seam;         // last seam of each overlap: [overlap * equi_width + seam row] (-1: no seam yet)
+	std::vector<vx_uint8> scheduled;    // overlaps due on the current frame
+};
+
+//! \brief The input images of the CPU cost accumulate.
+struct seamfind_cost_images {
+	const vx_uint8 * cost;  vx_int32 cost_stride;
+	const vx_uint8 * phase; vx_int32 phase_stride;
+	const vx_uint8 * mask;  vx_int32 mask_stride;
+	vx_int32 equi_width, equi_height;
+	int COST_SELECT, SEAM_QUALITY;
+};
+
+//! \brief Sum with the wrap around of the OpenCL kernel.
+static inline vx_int32 seamfind_wrap_add(vx_int32 a, vx_int32 b)
+{
+	return (vx_int32)((vx_uint32)a + (vx_uint32)b);
+}
+
+//! \brief Cost of the pixel at (x, y) of an overlap: 0x7F00FFFF when it is not valid in both cameras.
+static inline vx_int32 seamfind_pixel_cost(const seamfind_cost_images& in, vx_int32 row_1, vx_int32 row_2, vx_int32 x, vx_int32 y, bool vertical)
+{
+	if (!in.mask[(row_1 + y) * in.mask_stride + x] || !in.mask[(row_2 + y) * in.mask_stride + x])
+		return 0x7F00FFFF;
+	vx_int32 cost_img = (vx_int8)in.cost[(row_1 + y) * in.cost_stride + x];
+	if (vertical && in.COST_SELECT)
+		cost_img = (cost_img + (vx_int8)in.cost[(row_2 + y) * in.cost_stride + x]) / 2;
+	return cost_img;
+}
+
+//! \brief Accumulate the seam cost of one overlap: same dynamic program as the OpenCL kernel.
+// A seam row is an image row of a vertical seam or an image column of a horizontal seam.
+// When center is not null only the entries within +/-band of center[seam row] are computed;
+// the others are written as blocked entries and, like masked pixels, are never picked as parents.
+// Neighbours outside of the overlap rectangle are treated as masked.
+static void seamfind_accumulate_overlap(const seamfind_cost_images& in, const StitchSeamFindInformation& info,
+	const vx_int16 * center, vx_int32 band, StitchSeamFindAccumEntry * accum)
+{
+	const vx_int32 NO_PIXEL = 0x7F00FFFF, NO_COST = 0x7FFFFFFF;
+	vx_int32 width = info.end_x - info.start_x, height = info.end_y - info.start_y;
+	bool vertical = (height >= width);
+	vx_int32 length = vertical ? height : width, cross = vertical ? width : height;
+	vx_int32 row_1 = info.cam_id_1 * in.equi_height, row_2 = info.cam_id_2 * in.equi_height;
+
+	// edge bonus settings of the OpenCL kernel
+	vx_int32 winner_threshold = (vertical && in.SEAM_QUALITY == 2) ? 225 : 200;
+	vx_int32 edge_threshold = (vertical && in.SEAM_QUALITY == 1) ? 75 : 50;
+	vx_int8 edge_phase_1 = vertical ? 0 : 2, edge_phase_2 = vertical ? 4 : 6;
+
+	accum += info.offset;
+	vx_int32 prev_lo = 0, prev_hi = cross - 1;
+	for (vx_int32 r = 0; r < length; r++)
+	{
+		StitchSeamFindAccumEntry * accum_row = accum + r * cross;
+		vx_int32 lo = 0, hi = cross - 1;
+		if (center) {
+			lo = std::max(0, center[r] - band);
+			hi = std::min(cross - 1, center[r] + band);
+		}
+		for (vx_int32 c = 0; c < cross; c++)
+		{
+			if (c < lo || c > hi) {
+				accum_row[c].parent_x = accum_row[c].parent_y = -1;
+				accum_row[c].value = NO_COST;
+				accum_row[c].propagate = 0;
+				continue;
+			}
+			vx_int32 x = info.start_x + (vertical ? c : r);
+			vx_int32 y = info.start_y + (vertical ? r : c);
+			const vx_uint8 * cost_row = in.cost + (row_1 + y) * in.cost_stride;
+			const vx_uint8 * phase_row = in.phase + (row_1 + y) * in.phase_stride;
+			bool mask_img = in.mask[(row_1 + y) * in.mask_stride + x] && in.mask[(row_2 + y) * in.mask_stride + x];
+			vx_int32 Pixel = seamfind_pixel_cost(in, row_1, row_2, x, y, vertical);
+
+			// Parent at the start of the seam set to control value
+			StitchSeamFindAccumEntry& out = accum_row[c];
+			if (r == 0) {
+				out.parent_x = out.parent_y = -1;
+				out.value = Pixel;
+				out.propagate = (Pixel != NO_PIXEL) ? 1 : 0;
+				continue;
+			}
+
+			// magnitude and quantized phase across the seam
+			vx_int8 magnitude_R = 0, magnitude_L = 0, phase_R = 0, phase_L = 0;
+			if (vertical) {
+				if (x + 1 < in.equi_width) { magnitude_R = (vx_int8)cost_row[x + 1]; phase_R = (vx_int8)phase_row[x + 1]; }
+				if (x > 0) { magnitude_L = (vx_int8)cost_row[x - 1]; phase_L = (vx_int8)phase_row[x - 1]; }
+			}
+			else if (y > 0) {
+				if (y + 1 < in.equi_height) {
+					magnitude_R = (vx_int8)cost_row[x + in.cost_stride];
+					phase_R = (vx_int8)phase_row[x + in.phase_stride];
+				}
+				magnitude_L = (vx_int8)cost_row[x - in.cost_stride];
+				phase_L = (vx_int8)phase_row[x - in.phase_stride];
+			}
+			phase_R = phase_R >> 5;
+			phase_L = phase_L >> 5;
+
+			// Finding parent left (-1), middle (0) & right (+1) values on the previous seam row
+			const StitchSeamFindAccumEntry * accum_prev = accum_row - cross;
+			vx_int32 value[3] = { NO_COST, NO_COST, NO_COST }, prop[3] = { 0, 0, 0 };
+			for (vx_int32 k = 0; k < 3; k++) {
+				vx_int32 cn = c + k - 1;
+				if (cn < prev_lo || cn > prev_hi)
+					continue;
+				vx_int32 xn = info.start_x + (vertical ? cn : r - 1);
+				vx_int32 yn = info.start_y + (vertical ? r - 1 : cn);
+				if (in.mask[(row_1 + yn) * in.mask_stride + xn] && in.mask[(row_2 + yn) * in.mask_stride + xn]) {
+					value[k] = accum_prev[cn].value;
+					prop[k] = accum_prev[cn].propagate;
+				}
+			}
+			vx_int32 left = value[0], middle = value[1], right = value[2];
+
+			// Adding Bonus to the path next to an Edge
+			vx_int32 BONUS = 0;
+			if (in.SEAM_QUALITY == 1 || in.SEAM_QUALITY == 2) {
+				vx_int32 WINNER_R = (magnitude_R > winner_threshold) ? 50 : 0;
+				vx_int32 WINNER_L = (magnitude_L > winner_threshold) ? 50 : 0;
+				if (magnitude_R > edge_threshold && (phase_R == edge_phase_1 || phase_R == edge_phase_2))
+					BONUS += 100 + WINNER_R;
+				if (magnitude_L > edge_threshold && (phase_L == edge_phase_1 || phase_L == edge_phase_2))
+					BONUS += 100 + WINNER_L;
+			}
+
+			// Select Right, left or middle parent path: the entry is carried over from the previous seam row when none is selected
+			const vx_int32 NO_PARENT = 2;
+			vx_int32 parent = NO_PARENT;
+			StitchSeamFindAccumEntry entry = accum_prev[c];
+			if (mask_img && (prop[0] || prop[1] || prop[2])) {
+				vx_int32 valid_child = NO_COST;
+				if ((right < valid_child) && prop[2]) {
+					valid_child = right; parent = 1;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(right, Pixel), 2 * BONUS);
+					entry.propagate = 1;
+				}
+				if ((left < valid_child) && prop[0]) {
+					valid_child = left; parent = -1;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(left, Pixel), 2 * BONUS);
+					entry.propagate = 1;
+				}
+				if ((middle < valid_child) && prop[1]) {
+					parent = 0;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(middle, Pixel), -2 * BONUS);
+					entry.propagate = 1;
+				}
+			}
+			else {
+				if (right < middle && right < left) {
+					parent = 1;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(right, Pixel), 2 * BONUS);
+				}
+				else if (left < right && left < middle) {
+					parent = -1;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(left, Pixel), 2 * BONUS);
+				}
+				else {
+					parent = 0;
+					entry.value = seamfind_wrap_add(seamfind_wrap_add(middle, Pixel), -2 * BONUS);
+				}
+				entry.propagate = 0;
+			}
+			if (parent != NO_PARENT) {
+				entry.parent_x = (vx_int16)(vertical ? x + parent : x - 1);
+				entry.parent_y = (vx_int16)(vertical ? y - 1 : y + parent);
+			}
+			out = entry;
+		}
+		prev_lo = lo; prev_hi = hi;
+	}
+}
+
+//! \brief Trace the least cost seam of one overlap back from its last seam row, like the path trace kernel.
+// Returns false when the overlap has no seam; seam[] gets the cross position of each seam row.
+static bool seamfind_trace_overlap(const StitchSeamFindInformation& info, const StitchSeamFindAccumEntry * accum, vx_int16 * seam)
+{
+	vx_int32 width = info.end_x - info.start_x, height = info.end_y - info.start_y;
+	bool vertical = (height >= width);
+	vx_int32 length = vertical ? height : width, cross = vertical ? width : height;
+	if (length <= 0 || cross <= 0)
+		return false;
+
+	// Select the least cost pixel for the start of the seam
+	accum += info.offset;
+	const StitchSeamFindAccumEntry * accum_row = accum + (length - 1) * cross;
+	vx_int32 min_cost = 0x7FFFFFFF, c = -1;
+	for (vx_int32 k = cross - 1; k >= 0; k--) {
+		if (min_cost > accum_row[k].value && accum_row[k].propagate) {
+			min_cost = accum_row[k].value;
+			c = k;
+		}
+	}
+	if (c < 0)
+		return false;
+
+	// Traverse the parents: rows above the start of the path keep its first position
+	for (vx_int32 r = length - 1; r >= 0; r--) {
+		seam[r] = (vx_int16)c;
+		const StitchSeamFindAccumEntry& entry = accum[r * cross + c];
+		if (r > 0 && (entry.parent_x != -1 || entry.parent_y != -1)) {
+			vx_int32 cn = vertical ? (entry.parent_x - info.start_x) : (entry.parent_y - info.start_y);
+			if (cn >= 0 && cn < cross)
+				c = cn;
+		}
+	}
+	return true;
+}
+
+//! \brief Seam of one overlap searched at half resolution: least cost path over the mean cost of 2x2 valid pixels
+// (without the edge bonus), scaled back to a cross position per full resolution seam row.
+// Returns false when the overlap has no valid pixels.
+static bool seamfind_coarse_seam(const seamfind_cost_images& in, const StitchSeamFindInformation& info, vx_int16 * seam)
+{
+	const vx_int32 NO_PIXEL = 0x7F00FFFF, NO_COST = 0x7FFFFFFF;
+	vx_int32 width = info.end_x - info.start_x, height = info.end_y - info.start_y;
+	bool vertical = (height >= width);
+	vx_int32 length = vertical ? height : width, cross = vertical ? width : height;
+	vx_int32 row_1 = info.cam_id_1 * in.equi_height, row_2 = info.cam_id_2 * in.equi_height;
+	vx_int32 coarse_length = (length + 1) >> 1, coarse_cross = (cross + 1) >> 1;
+	if (coarse_length <= 0 || coarse_cross <= 0)
+		return false;
+
+	// accumulated cost and parent step (-1, 0, +1) of each half resolution pixel
+	std::vector<vx_int32> accum(coarse_length * coarse_cross);
+	std::vector<vx_int8> parent(coarse_length * coarse_cross, 0);
+	for (vx_int32 r = 0; r < coarse_length; r++)
+	{
+		for (vx_int32 c = 0; c < coarse_cross; c++)
+		{
+			vx_int32 sum = 0, count = 0;
+			for (vx_int32 rr = 2 * r; rr < std::min(2 * r + 2, length); rr++) {
+				for (vx_int32 cc = 2 * c; cc < std::min(2 * c + 2, cross); cc++) {
+					vx_int32 x = info.start_x + (vertical ? cc : rr);
+					vx_int32 y = info.start_y + (vertical ? rr : cc);
+					vx_int32 Pixel = seamfind_pixel_cost(in, row_1, row_2, x, y, vertical);
+					if (Pixel != NO_PIXEL) { sum += Pixel; count++; }
+				}
+			}
+			vx_int32& out = accum[r * coarse_cross + c];
+			out = NO_COST;
+			if (!count)
+				continue;
+			vx_int32 cost = sum / count;
+			if (r == 0) {
+				out = cost;
+				continue;
+			}
+			const vx_int32 * accum_prev = &accum[(r - 1) * coarse_cross];
+			for (vx_int32 k = -1; k <= 1; k++) {
+				vx_int32 cn = c + k;
+				if (cn >= 0 && cn < coarse_cross && accum_prev[cn] != NO_COST && (out == NO_COST || accum_prev[cn] + cost < out)) {
+					out = accum_prev[cn] + cost;
+					parent[r * coarse_cross + c] = (vx_int8)k;
+				}
+			}
+			if (out == NO_COST)
+				out = cost;
+		}
+	}
+
+	// trace back from the least cost pixel of the last row
+	vx_int32 c = -1;
+	const vx_int32 * accum_row = &accum[(coarse_length - 1) * coarse_cross];
+	for (vx_int32 k = 0; k < coarse_cross; k++) {
+		if (accum_row[k] != NO_COST && (c < 0 || accum_row[k] < accum_row[c]))
+			c = k;
+	}
+	if (c < 0)
+		return false;
+	for (vx_int32 r = coarse_length - 1; r >= 0; r--) {
+		vx_int16 center = (vx_int16)std::min(2 * c, cross - 1);
+		seam[2 * r] = center;
+		if (2 * r + 1 < length)
+			seam[2 * r + 1] = center;
+		c += parent[r * coarse_cross + c];
+	}
+	return true;
+}
+
+//! \brief The kernel initialize.
+static vx_status VX_CALLBACK seamfind_cost_accumulate_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	seamfind_cost_accumulate_data * data = new seamfind_cost_accumulate_data;
+	char textBuffer[256];
+	data->COST_SELECT = 0; data->SEAM_QUALITY = 1; data->SEAM_REFINE_BAND = 0; data->SEAM_COARSE_SEARCH = 0;
+	if (StitchGetEnvironmentVariable("COST_SELECT", textBuffer, sizeof(textBuffer))) { data->COST_SELECT = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("SEAM_QUALITY", textBuffer, sizeof(textBuffer))) { data->SEAM_QUALITY = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("SEAM_REFINE_BAND", textBuffer, sizeof(textBuffer))) { data->SEAM_REFINE_BAND = atoi(textBuffer); }
+	if (StitchGetEnvironmentVariable("SEAM_COARSE_SEARCH", textBuffer, sizeof(textBuffer))) { data->SEAM_COARSE_SEARCH = atoi(textBuffer); }
+	vx_size size = sizeof(seamfind_cost_accumulate_data);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitialize.
+static vx_status VX_CALLBACK seamfind_cost_accumulate_deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(seamfind_cost_accumulate_data)))
+	{
+		seamfind_cost_accumulate_data * data = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+		if (data) delete data;
+	}
+	return VX_SUCCESS;
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK seamfind_cost_accumulate_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	seamfind_cost_accumulate_data * data = nullptr;
+	ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	if (!data) return VX_ERROR_NOT_ALLOCATED;
+
+	//Execute Flag - Variable 10: no overlap is due on this frame when zero
+	vx_uint32 execute_flag = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[10], &execute_flag));
+	if (!execute_flag)
+		return VX_SUCCESS;
+
+	//Current Frame & Equirectangular Width/Height - Variable 0, 1 & 2
+	vx_uint32 current_frame = 0, equi_width = 0, equi_height = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &current_frame));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[1], &equi_width));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[2], &equi_height));
+
+	//Seam Find Preference & Information Arrays - Variable 7 & 8
+	vx_array Array_SeamFind_Pref = (vx_array)parameters[7];
+	vx_array Array_SeamFind_Info = (vx_array)parameters[8];
+	vx_size SeamFind_Pref_max = 0, SeamFind_Info_max = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Pref, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Pref_max, sizeof(SeamFind_Pref_max)));
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Info, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Info_max, sizeof(SeamFind_Info_max)));
+	vx_size num_overlaps = std::min(SeamFind_Pref_max, SeamFind_Info_max);
+	if (num_overlaps == 0)
+		return VX_SUCCESS;
+	StitchSeamFindPreference *SeamFind_Pref = nullptr;
+	vx_size stride_pref = sizeof(StitchSeamFindPreference);
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, &stride_pref, (void **)&SeamFind_Pref, VX_READ_ONLY));
+
+	//Check the overlap schedules: a seam scheduled by its start frame (first seam or scene change) gets a full search
+	std::vector<vx_uint8>& scheduled = data->scheduled;
+	scheduled.assign(num_overlaps, 0);
+	vx_uint32 scheduled_count = 0;
+	for (vx_size i = 0; i < num_overlaps; i++)
+	{
+		vx_int32 period = SeamFind_Pref[i].frequency + SeamFind_Pref[i].seam_type_num;
+		if (SeamFind_Pref[i].priority == -1) continue;
+		if ((vx_uint32)SeamFind_Pref[i].start_frame == current_frame) scheduled[i] = 2;
+		else if (period > 0 && ((current_frame + 1) % period) == 0) scheduled[i] = 1;
+		if (scheduled[i]) scheduled_count++;
+	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, SeamFind_Pref));
+	if (scheduled_count == 0)
+		return VX_SUCCESS;
+
+	//Magnitude, Phase & Mask Images - Variable 3, 4 & 5
+	vx_image image[3] = { (vx_image)parameters[3], (vx_image)parameters[4], (vx_image)parameters[5] };
+	vx_rectangle_t rect[3]; vx_imagepatch_addressing_t addr[3]; void * ptr[3] = { nullptr, nullptr, nullptr };
+	for (int k = 0; k < 3; k++) {
+		vx_uint32 width = 0, height = 0;
+		ERROR_CHECK_STATUS(vxQueryImage(image[k], VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+		ERROR_CHECK_STATUS(vxQueryImage(image[k], VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+		rect[k].start_x = rect[k].start_y = 0; rect[k].end_x = width; rect[k].end_y = height;
+		ERROR_CHECK_STATUS(vxAccessImagePatch(image[k], &rect[k], 0, &addr[k], &ptr[k], VX_READ_ONLY));
+	}
+	seamfind_cost_images in;
+	in.cost = (const vx_uint8 *)ptr[0]; in.cost_stride = addr[0].stride_y;
+	in.phase = (const vx_uint8 *)ptr[1]; in.phase_stride = addr[1].stride_y;
+	in.mask = (const vx_uint8 *)ptr[2]; in.mask_stride = addr[2].stride_y;
+	in.equi_width = (vx_int32)equi_width; in.equi_height = (vx_int32)equi_height;
+	in.COST_SELECT = data->COST_SELECT; in.SEAM_QUALITY = data->SEAM_QUALITY;
+
+	StitchSeamFindInformation *SeamFind_Info = nullptr;
+	vx_size stride_info = sizeof(StitchSeamFindInformation);
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Info, 0, SeamFind_Info_max, &stride_info, (void **)&SeamFind_Info, VX_READ_ONLY));
+
+	//Seam Find Accum Array - Variable 9: entries of overlaps that are not due are left as is
+	vx_array Array_SeamFind_Accum = (vx_array)parameters[9];
+	vx_size SeamFind_Accum_max = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Accum, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Accum_max, sizeof(SeamFind_Accum_max)));
+	StitchSeamFindAccumEntry *SeamFind_Accum = nullptr;
+	vx_size stride_accum = sizeof(StitchSeamFindAccumEntry);
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Accum, 0, SeamFind_Accum_max, &stride_accum, (void **)&SeamFind_Accum, VX_READ_AND_WRITE));
+
+	//Last seams: the band of the next search follows the last seam of the overlap
+	std::vector<vx_int16>& seam = data->seam;
+	if (seam.size() != num_overlaps * equi_width)
+		seam.assign(num_overlaps * equi_width, -1);
+
+	//Each overlap writes only its own accum entries and seam, so the overlaps due on the same frame run in parallel
+#pragma omp parallel for schedule(dynamic) if (scheduled_count > 1)
+	for (vx_int32 i = 0; i < (vx_int32)num_overlaps; i++)
+	{
+		if (!scheduled[i])
+			continue;
+		const StitchSeamFindInformation& info = SeamFind_Info[i];
+		vx_int32 width = info.end_x - info.start_x, height = info.end_y - info.start_y;
+		vx_int32 length = std::max(width, height), cross = std::min(width, height);
+		if (width <= 0 || height <= 0 || (vx_size)(info.offset + width * height) > SeamFind_Accum_max || length > (vx_int32)equi_width)
+			continue;
+
+		//Band search around the last seam, widened while the new seam runs into the band boundary
+		vx_int16 * last_seam = &seam[i * equi_width];
+		const vx_int16 * center = last_seam;
+		vx_int32 band = data->SEAM_REFINE_BAND;
+		if (scheduled[i] == 2 || last_seam[0] < 0 || band * 2 + 1 >= cross)
+			band = 0;
+		std::vector<vx_int16> new_seam(length), coarse_seam;
+		//Otherwise a full search can start with the seam searched at half resolution, refined within a full resolution corridor
+		if (!band && data->SEAM_COARSE_SEARCH > 0 && data->SEAM_COARSE_SEARCH * 2 + 1 < cross) {
+			coarse_seam.resize(length);
+			if (seamfind_coarse_seam(in, info, &coarse_seam[0])) {
+				center = &coarse_seam[0];
+				band = data->SEAM_COARSE_SEARCH;
+			}
+		}
+		for (;;)
+		{
+			seamfind_accumulate_overlap(in, info, band ? center : nullptr, band, SeamFind_Accum);
+			if (!seamfind_trace_overlap(info, SeamFind_Accum, &new_seam[0])) {
+				new_seam.assign(length, -1);
+				break;
+			}
+			bool boundary_hit = false;
+			for (vx_int32 r = 0; band && r < length && !boundary_hit; r++) {
+				vx_int32 lo = center[r] - band, hi = center[r] + band;
+				boundary_hit = (lo > 0 && new_seam[r] <= lo) || (hi < cross - 1 && new_seam[r] >= hi);
+			}
+			if (!boundary_hit)
+				break;
+			band *= 2;
+			if (band * 2 + 1 >= cross)
+				band = 0;
+		}
+		memcpy(last_seam, &new_seam[0], length * sizeof(vx_int16));
+	}
+
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Accum, 0, SeamFind_Accum_max, SeamFind_Accum));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Info, 0, SeamFind_Info_max, SeamFind_Info));
+	for (int k = 0; k < 3; k++) {
+		ERROR_CHECK_STATUS(vxCommitImagePatch(image[k], &rect[k], 0, &addr[k], ptr[k]));
+	}
+
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
@@ -2337,11 +2756,11 @@ vx_status seamfind_cost_accumulate_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.seamfind_cost_accumulate",
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_COST_ACCUMULATE,
 		seamfind_cost_accumulate_kernel,
-		10,
+		11,
 		seamfind_cost_accumulate_input_validator,
 		seamfind_cost_accumulate_output_validator,
-		nullptr,
-		nullptr);
+		seamfind_cost_accumulate_initialize,
+		seamfind_cost_accumulate_deinitialize);
 	ERROR_CHECK_OBJECT(kernel);
 	amd_kernel_query_target_support_f query_target_support_f = seamfind_cost_accumulate_query_target_support;
 	amd_kernel_opencl_codegen_callback_f opencl_codegen_callback_f = seamfind_cost_accumulate_opencl_codegen;
@@ -2361,6 +2780,7 @@ vx_status seamfind_cost_accumulate_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 8, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 9, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 10, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
 
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
@@ -2382,8 +2802,8 @@ static vx_status VX_CALLBACK seamfind_path_trace_input_validator(vx_node node, v
 	vx_reference ref = avxGetNodeParamRef(node, index);
 	ERROR_CHECK_OBJECT(ref);
 	// validate each parameter
-	if (index == 0)
-	{ // object of SCALAR type for 
+	if (index == 0 || index == 6)
+	{ // object of SCALAR type for current frame and execute flag
 		vx_enum itemtype = VX_TYPE_INVALID;
 		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
 
@@ -2392,7 +2812,7 @@ static vx_status VX_CALLBACK seamfind_path_trace_input_validator(vx_node node, v
 		}
 		else {
 			status = VX_ERROR_INVALID_TYPE;
-			vxAddLogEntry((vx_reference)node, status, "ERROR: SeamFind Current Frame should be a UINT32\n");
+			vxAddLogEntry((vx_reference)node, status, "ERROR: SeamFind Current Frame/Execute Flag should be a UINT32\n");
 		}
 		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
 	}
@@ -2574,7 +2994,8 @@ static vx_status VX_CALLBACK seamfind_path_trace_opencl_codegen(
 		"						__global char * seam_info_buf, uint seam_info_buf_offset, uint seam_info_num_items,\n"
 		"						__global char * seam_accum_buf, uint seam_accum_buf_offset, uint seam_accum_num_items,\n"
 		"						__global char * seam_pref_buf, uint seam_pref_buf_offset, uint seam_pref_num_items,\n"
-		"						__global char * seam_path_buf, uint seam_path_buf_offset, uint seam_path_num_items)\n"
+		"						__global char * seam_path_buf, uint seam_path_buf_offset, uint seam_path_num_items,\n"
+		"						uint execute_flag)\n"
 		, opencl_local_work[0], opencl_kernel_function_name);
 	opencl_kernel_code = item;
 	opencl_kernel_code +=
@@ -2582,7 +3003,7 @@ static vx_status VX_CALLBACK seamfind_path_trace_opencl_codegen(
 		"\n"
 		"int gid = get_global_id(0);\n"
 		"\n"
-		"	if (gid < seam_info_num_items)\n"
+		"	if (execute_flag && gid < seam_info_num_items)\n"
 		"	{\n"
 		"\n"
 		"		seam_info_buf	+= seam_info_buf_offset + (gid * 16);\n"
@@ -2720,13 +3141,81 @@ static vx_status VX_CALLBACK seamfind_path_trace_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief The path trace node-local data: the path buffer is reused across frames.
+struct seamfind_path_trace_data {
+	std::vector<StitchSeamFindPathEntry> path;  // seam path of each overlap: [width_eqr * overlap count]
+	std::vector<vx_uint8> scheduled;            // overlap is due on the current frame: [overlap count]
+};
+
+//! \brief The kernel initialize.
+static vx_status VX_CALLBACK seamfind_path_trace_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	seamfind_path_trace_data * data = new seamfind_path_trace_data;
+	vx_size size = sizeof(seamfind_path_trace_data);
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)));
+	ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitialize.
+static vx_status VX_CALLBACK seamfind_path_trace_deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_size size = 0;
+	if (!vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_SIZE, &size, sizeof(size)) && (size == sizeof(seamfind_path_trace_data)))
+	{
+		seamfind_path_trace_data * data = nullptr;
+		ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+		if (data) delete data;
+	}
+	return VX_SUCCESS;
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK seamfind_path_trace_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
+	seamfind_path_trace_data * data = nullptr;
+	ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_LOCAL_DATA_PTR, &data, sizeof(data)));
+	if (!data) return VX_ERROR_NOT_ALLOCATED;
+
+	//Execute Flag - Variable 6: no overlap is due on this frame when zero
+	vx_uint32 execute_flag = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[6], &execute_flag));
+	if (!execute_flag)
+		return VX_SUCCESS;
+
 	//Number Of Cameras - Variable 0 
 	vx_uint32 current_frame = 0, width_eqr = 0, height_eqr = 0;
 	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &current_frame));
 
+	//SeamFindInfo Array - Variable 2
+	vx_size arr_numitems = 0;
+	vx_array SeamFindInfo = (vx_array)parameters[2];
+	ERROR_CHECK_STATUS(vxQueryArray(SeamFindInfo, VX_ARRAY_ATTRIBUTE_NUMITEMS, &arr_numitems, sizeof(arr_numitems)));
+
+	//Seam Find Preference Array - Variable 4
+	vx_array Array_SeamFind_Pref = (vx_array)parameters[4];
+	vx_size SeamFind_Pref_max = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Pref, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Pref_max, sizeof(SeamFind_Pref_max)));
+	if (arr_numitems == 0 || SeamFind_Pref_max == 0)
+		return VX_SUCCESS;
+	StitchSeamFindPreference *SeamFind_Pref = nullptr;
+	vx_size stride_pref = sizeof(StitchSeamFindPreference);
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, &stride_pref, (void **)&SeamFind_Pref, VX_READ_ONLY));
+
+	//Check the overlap schedules first: nothing else is mapped on frames without any overlap due
+	data->scheduled.assign(arr_numitems, 0);
+	vx_uint32 scheduled_count = 0;
+	for (vx_uint32 i = 0; i < (vx_uint32)std::min(arr_numitems, SeamFind_Pref_max); i++)
+	{
+		if (seamfind_is_overlap_due(SeamFind_Pref[i], current_frame)) {
+			data->scheduled[i] = 1;
+			scheduled_count++;
+		}
+	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, SeamFind_Pref));
+	if (scheduled_count == 0)
+		return VX_SUCCESS;
+
 	//Input Weight image - Variable 1
 	vx_image weight_image = (vx_image)parameters[1];
 	vx_uint32 width = 0, height = 0, plane = 0;
@@ -2740,10 +3229,6 @@ static vx_status VX_CALLBACK seamfind_path_trace_kernel(vx_node node, const vx_r
 	width_eqr = width;
 	height_eqr = (width_eqr >> 1);
 
-	//SeamFindInfo Array - Variable 2
-	vx_size arr_numitems = 0;
-	vx_array SeamFindInfo = (vx_array)parameters[2];
-	ERROR_CHECK_STATUS(vxQueryArray(SeamFindInfo, VX_ARRAY_ATTRIBUTE_NUMITEMS, &arr_numitems, sizeof(arr_numitems)));
 	StitchSeamFindInformation *SeamFindInfo_ptr = nullptr;
 	vx_size stride = sizeof(StitchSeamFindInformation);
 	ERROR_CHECK_STATUS(vxAccessArrayRange(SeamFindInfo, 0, arr_numitems, &stride, (void **)&SeamFindInfo_ptr, VX_READ_ONLY));
@@ -2756,23 +3241,18 @@ static vx_status VX_CALLBACK seamfind_path_trace_kernel(vx_node node, const vx_r
 	vx_size stride_accum = sizeof(StitchSeamFindAccumEntry);
 	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_ACCUM, 0, SeamFind_ACCUM_max, &stride_accum, (void **)&SeamFind_Accum, VX_READ_ONLY));
 
-	//Seam Find Accum Array - Variable 4
-	vx_array Array_SeamFind_Pref = (vx_array)parameters[4];
-	vx_size SeamFind_Pref_max = 0;
-	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Pref, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Pref_max, sizeof(SeamFind_Pref_max)));
-	StitchSeamFindPreference *SeamFind_Pref = nullptr;
-	vx_size stride_pref = sizeof(StitchSeamFindPreference);
-	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, &stride_pref, (void **)&SeamFind_Pref, VX_READ_ONLY));
-
-	std::vector<StitchSeamFindPathEntry> SeamFind_Path;
+	//Path buffer: the paths of overlaps that are not due keep their last trace (set_weights only reads paths of due overlaps)
+	std::vector<StitchSeamFindPathEntry>& SeamFind_Path = data->path;
 	vx_size  path_array_size = (vx_size)(width_eqr * arr_numitems);
-	SeamFind_Path.resize(path_array_size);
-
-	//Horizontal Overlap Counter
-	vx_uint32 horizontal_overlap = 1;
+	if (SeamFind_Path.size() != path_array_size) {
+		SeamFind_Path.clear();
+		SeamFind_Path.resize(path_array_size);
+	}
 
-	//Loop over all the overlaps
-	for (vx_uint32 i = 0; i < arr_numitems; i++)
+	//Loop over all the overlaps: only the ones due on this frame are traced
+	//each overlap writes only its own path row, so overlaps due on the same frame (e.g. after a scene change) are traced in parallel
+#pragma omp parallel for schedule(dynamic) if (scheduled_count > 1)
+	for (vx_int32 i = 0; i < (vx_int32)arr_numitems; i++)
 	{
 		vx_uint32 offset_1 = SeamFindInfo_ptr[i].cam_id_1 * height_eqr;
 		vx_uint32 offset_2 = SeamFindInfo_ptr[i].cam_id_2 * height_eqr;
@@ -2782,8 +3262,11 @@ static vx_status VX_CALLBACK seamfind_path_trace_kernel(vx_node node, const vx_r
 		vx_int32 min_cost = 0X7FFFFFFF;
 		vx_int32 min_x = -1, min_y = -1;
 
-		if (SeamFind_Pref[i].priority != -1 && ((SeamFind_Pref[i].start_frame == current_frame) || ((current_frame + 1) % (SeamFind_Pref[i].frequency + SeamFind_Pref[i].seam_type_num) == 0)))
+		if (data->scheduled[i])
 		{
+			//Clear the previous trace of this overlap
+			memset(&SeamFind_Path[i * width_eqr], 0, width_eqr * sizeof(StitchSeamFindPathEntry));
+
 			/***********************************************************************************************************************************
 			Vertical SeamCut
 			************************************************************************************************************************************/
@@ -2899,24 +3382,17 @@ static vx_status VX_CALLBACK seamfind_path_trace_kernel(vx_node node, const vx_r
 				float Path_travese_time = (float)((end_path_traverse - start_path_traverse) * factor);
 				printf("Overlap::%d,%d:::Best Path Find Time-->%f (ms) Path Traverse Time--> %f (ms) \n", i, j, Path_find_time, Path_travese_time);
 #endif
-				horizontal_overlap++;
 #endif
 			}
 		}
 	}
 	vx_array accum_seamFindPathEntry = (vx_array)parameters[5];
-	vx_size seamcut_path_size = width_eqr * arr_numitems;
-	StitchSeamFindPathEntry *StitchSeamCutPath_ptr = &SeamFind_Path[0];
 	ERROR_CHECK_STATUS(vxTruncateArray(accum_seamFindPathEntry, 0));
-	ERROR_CHECK_STATUS(vxAddArrayItems(accum_seamFindPathEntry, seamcut_path_size, StitchSeamCutPath_ptr, sizeof(StitchSeamFindPathEntry)));
+	ERROR_CHECK_STATUS(vxAddArrayItems(accum_seamFindPathEntry, path_array_size, &SeamFind_Path[0], sizeof(StitchSeamFindPathEntry)));
 
 	ERROR_CHECK_STATUS(vxCommitImagePatch(weight_image, &weight_rect, 0, &weight_addr, weight_image_ptr));
 	ERROR_CHECK_STATUS(vxCommitArrayRange(SeamFindInfo, 0, arr_numitems, SeamFindInfo_ptr));
 	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_ACCUM, 0, SeamFind_ACCUM_max, SeamFind_Accum));
-	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, SeamFind_Pref));
-
-	//Release Memory
-	SeamFind_Path.clear();
 
 	return VX_SUCCESS;
 }
@@ -2928,11 +3404,11 @@ vx_status seamfind_path_trace_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.seamfind_path_trace",
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_PATH_TRACE,
 		seamfind_path_trace_kernel,
-		6,
+		7,
 		seamfind_path_trace_input_validator,
 		seamfind_path_trace_output_validator,
-		nullptr,
-		nullptr);
+		seamfind_path_trace_initialize,
+		seamfind_path_trace_deinitialize);
 	ERROR_CHECK_OBJECT(kernel);
 	amd_kernel_query_target_support_f query_target_support_f = seamfind_path_trace_query_target_support;
 	amd_kernel_opencl_codegen_callback_f opencl_codegen_callback_f = seamfind_path_trace_opencl_codegen;
@@ -2948,6 +3424,7 @@ vx_status seamfind_path_trace_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 5, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
 
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
@@ -2959,7 +3436,7 @@ vx_status seamfind_path_trace_publish(vx_context context)
 
 /***********************************************************************************************************************************
 
-Seam Find Kernel - 5 --- Set Weight - GPU
+Seam Find Kernel - 5 --- Set Weight - GPU/CPU
 
 ************************************************************************************************************************************/
 //! \brief The input validator callback.
@@ -2970,7 +3447,7 @@ static vx_status VX_CALLBACK seamfind_set_weights_input_validator(vx_node node,
 	vx_reference ref = avxGetNodeParamRef(node, index);
 	ERROR_CHECK_OBJECT(ref);
 	// validate each parameter
-	if (index == 0 || index == 1 || index == 2 || index == 3 || index == 8)
+	if (index == 0 || index == 1 || index == 2 || index == 3 || index == 8 || index == 9)
 	{ // object of SCALAR type
 		vx_enum itemtype = VX_TYPE_INVALID;
 		ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)ref, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
@@ -3075,7 +3552,124 @@ static vx_status VX_CALLBACK seamfind_set_weights_deinitialize(vx_node node, con
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK seamfind_set_weights_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_IMPLEMENTED;
+	//Execute Flag - Variable 9: no overlap is due on this frame when zero
+	vx_uint32 execute_flag = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[9], &execute_flag));
+	if (!execute_flag)
+		return VX_SUCCESS;
+
+	//Current Frame, Number of Cameras, Equirectangular Width & Height - Variables 0-3
+	vx_uint32 current_frame = 0, NumCam = 0, equi_width = 0, equi_height = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &current_frame));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[1], &NumCam));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[2], &equi_width));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[3], &equi_height));
+
+	//Debug Flags - Variable 8
+	vx_uint32 debugFlags = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[8], &debugFlags));
+	bool DRAW_SEAM = ((debugFlags >> 8) & 1) != 0;
+	bool VIEW_SCENE_CHANGE = ((debugFlags >> 9) & 1) != 0;
+	bool SHOW_ALL_SEAMS = ((debugFlags >> 10) & 1) != 0;
+	if (SHOW_ALL_SEAMS)
+		DRAW_SEAM = true;
+
+	//Weight Entry, Path & Preference Arrays - Variables 4-6
+	vx_array Array_SeamFind_Weight = (vx_array)parameters[4];
+	vx_array Array_SeamFind_Path = (vx_array)parameters[5];
+	vx_array Array_SeamFind_Pref = (vx_array)parameters[6];
+	vx_size SeamFind_Weight_max = 0, SeamFind_Path_max = 0, SeamFind_Pref_max = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Weight, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Weight_max, sizeof(SeamFind_Weight_max)));
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Path, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Path_max, sizeof(SeamFind_Path_max)));
+	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Pref, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Pref_max, sizeof(SeamFind_Pref_max)));
+	if (SeamFind_Weight_max == 0 || SeamFind_Path_max == 0 || SeamFind_Pref_max == 0)
+		return VX_SUCCESS;
+	StitchSeamFindWeightEntry *SeamFind_Weight = nullptr;
+	StitchSeamFindPathEntry *SeamFind_Path = nullptr;
+	StitchSeamFindPreference *SeamFind_Pref = nullptr;
+	vx_size stride_weight = sizeof(StitchSeamFindWeightEntry), stride_path = sizeof(StitchSeamFindPathEntry), stride_pref = sizeof(StitchSeamFindPreference);
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Weight, 0, SeamFind_Weight_max, &stride_weight, (void **)&SeamFind_Weight, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Path, 0, SeamFind_Path_max, &stride_path, (void **)&SeamFind_Path, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, &stride_pref, (void **)&SeamFind_Pref, VX_READ_ONLY));
+
+	//Output Weight image - Variable 7: only the pixels of the active overlaps are updated
+	vx_image weight_image = (vx_image)parameters[7];
+	vx_uint32 width = 0, height = 0;
+	ERROR_CHECK_STATUS(vxQueryImage(weight_image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage(weight_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	void *weight_image_ptr = nullptr; vx_rectangle_t weight_rect;	vx_imagepatch_addressing_t weight_addr;
+	weight_rect.start_x = weight_rect.start_y = 0; weight_rect.end_x = width; weight_rect.end_y = height;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(weight_image, &weight_rect, 0, &weight_addr, &weight_image_ptr, VX_READ_AND_WRITE));
+	vx_uint8 *weight_ptr = (vx_uint8*)weight_image_ptr;
+	vx_int32 weight_stride = weight_addr.stride_y;
+
+	// the entries of an overlap are contiguous (see GenerateSeamFindBuffers), so each run of the same
+	// overlap_id is processed as one overlap. The runs are not parallelized: an overlap writes weights of
+	// pixels it shares with other overlaps (and clears the other cameras), and these pixels must get the
+	// same value on every frame, the value of the last run. The entries within a run are processed in parallel.
+	for (vx_size start = 0; start < SeamFind_Weight_max;)
+	{
+		vx_int16 overlap_id = SeamFind_Weight[start].overlap_id;
+		vx_size end = start + 1;
+		while (end < SeamFind_Weight_max && SeamFind_Weight[end].overlap_id == overlap_id)
+			end++;
+		if (overlap_id < 0 || (vx_size)overlap_id >= SeamFind_Pref_max || (vx_size)(overlap_id + 1) * equi_width > SeamFind_Path_max) {
+			start = end;
+			continue;
+		}
+		const StitchSeamFindPreference& pref = SeamFind_Pref[overlap_id];
+		if (seamfind_is_overlap_due(pref, current_frame))
+		{
+			const StitchSeamFindPathEntry * path_ptr = &SeamFind_Path[overlap_id * equi_width];
+#pragma omp parallel for
+			for (vx_int32 k = (vx_int32)start; k < (vx_int32)end; k++)
+			{
+				const StitchSeamFindWeightEntry& entry = SeamFind_Weight[k];
+				// pixel position across the seam and the seam path entry of its row (vertical) or column (horizontal)
+				vx_int32 pixel_pos = 0;
+				StitchSeamFindPathEntry path = { 0 };
+				if (entry.overlap_type == 0 && ENABLE_VERTICAL_SEAM) {
+					pixel_pos = entry.x;
+					path = path_ptr[entry.y];
+				}
+				else if (entry.overlap_type == 1 && ENABLE_HORIZONTAL_SEAM) {
+					pixel_pos = entry.y;
+					path = path_ptr[entry.x];
+				}
+				else
+					continue;
+				vx_uint8 * weight_1 = weight_ptr + (entry.y + entry.cam_id_1 * equi_height) * weight_stride + entry.x;
+				vx_uint8 * weight_2 = weight_ptr + (entry.y + entry.cam_id_2 * equi_height) * weight_stride + entry.x;
+				if (!SHOW_ALL_SEAMS)
+				{
+					// the seam splits the overlap: camera 1 gets full weight on one side and camera 2 on the other
+					vx_uint8 value_1 = (path.weight_value_i == 255) ? 255 : 0;
+					if (pixel_pos < path.min_pixel)
+						value_1 = 255 - value_1;
+					*weight_1 = value_1;
+					*weight_2 = 255 - value_1;
+					if (VIEW_SCENE_CHANGE && pref.scene_flag == 2)
+						*weight_1 = *weight_2 = 50;
+					else if (VIEW_SCENE_CHANGE && pref.scene_flag == 3)
+						*weight_1 = *weight_2 = 255;
+					for (vx_int32 cam = 0; cam < (vx_int32)NumCam; cam++) {
+						if (cam != entry.cam_id_1 && cam != entry.cam_id_2)
+							weight_ptr[(entry.y + cam * equi_height) * weight_stride + entry.x] = 0;
+					}
+				}
+				if (DRAW_SEAM && pixel_pos == path.min_pixel)
+					*weight_1 = *weight_2 = 0;
+			}
+		}
+		start = end;
+	}
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(weight_image, &weight_rect, 0, &weight_addr, weight_image_ptr));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Weight, 0, SeamFind_Weight_max, SeamFind_Weight));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Path, 0, SeamFind_Path_max, SeamFind_Path));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, SeamFind_Pref));
+
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel target support callback.
@@ -3084,7 +3678,15 @@ static vx_status VX_CALLBACK seamfind_set_weights_query_target_support(vx_graph
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	char textBuffer[256];
+	int SEAM_FIND_TARGET = 0;
+	if (StitchGetEnvironmentVariable("SEAM_FIND_TARGET", textBuffer, sizeof(textBuffer))) { SEAM_FIND_TARGET = atoi(textBuffer); }
+
+	if (!SEAM_FIND_TARGET)
+		supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	else
+		supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+
 	return VX_SUCCESS;
 }
 
@@ -3170,14 +3772,15 @@ static vx_status VX_CALLBACK seamfind_set_weights_opencl_codegen(
 		"        __global char * seam_valid_buf, uint seam_valid_buf_offset, uint valid_pix_num_items,\n"
 		"        __global char * path_buf, uint path_buf_offset, uint path_num_items,\n"
 		"		 __global char * seam_pref_buf, uint seam_pref_buf_offset, uint seam_pref_num_items,\n"
-		"        uint weight_width, uint weight_height, __global uchar * weight_buf, uint weight_stride, uint weight_offset, uint flags)\n"
+		"        uint weight_width, uint weight_height, __global uchar * weight_buf, uint weight_stride, uint weight_offset, uint flags,\n"
+		"        uint execute_flag)\n"
 		, opencl_local_work[0], opencl_kernel_function_name);
 	opencl_kernel_code = item;
 	opencl_kernel_code +=
 		"{\n"
 		"	int gid = get_global_id(0);\n"
 		"\n"
-		"		if (gid < valid_pix_num_items)\n"
+		"		if (execute_flag && gid < valid_pix_num_items)\n"
 		"		{\n"
 		"\n"
 		"			seam_valid_buf += seam_valid_buf_offset + (gid * 12);\n"
@@ -3463,7 +4066,7 @@ vx_status seamfind_set_weights_publish(vx_context context)
 	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.seamfind_set_weights",
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_SET_WEIGHTS,
 		seamfind_set_weights_kernel,
-		9,
+		10,
 		seamfind_set_weights_input_validator,
 		seamfind_set_weights_output_validator,
 		seamfind_set_weights_initialize,
@@ -3487,6 +4090,7 @@ vx_status seamfind_set_weights_publish(vx_context context)
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 7, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
 	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 8, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 9, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
 
 	// finalize and release kernel object
 	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
@@ -3558,6 +4162,8 @@ static vx_status VX_CALLBACK seamfind_analyze_output_validator(vx_node node, vx_
 			status = VX_ERROR_INVALID_TYPE;
 			vxAddLogEntry((vx_reference)node, status, "ERROR: SeamFind Analyze scalar type should be a UINT32\n");
 		}
+		// set output scalar meta data
+		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_SCALAR_ATTRIBUTE_TYPE, &itemtype, sizeof(itemtype)));
 		ERROR_CHECK_STATUS(vxReleaseScalar((vx_scalar *)&ref));
 	}
 	return status;
@@ -3574,19 +4180,21 @@ static vx_status VX_CALLBACK seamfind_analyze_kernel(vx_node node, const vx_refe
 	vx_array Array_SeamFind_Pref = (vx_array)parameters[1];
 	vx_size SeamFind_Pref_max = 0;
 	ERROR_CHECK_STATUS(vxQueryArray(Array_SeamFind_Pref, VX_ARRAY_ATTRIBUTE_NUMITEMS, &SeamFind_Pref_max, sizeof(SeamFind_Pref_max)));
+	if (SeamFind_Pref_max == 0)
+		return VX_ERROR_INVALID_DIMENSION;
 	StitchSeamFindPreference *SeamFind_Pref = nullptr;
 	vx_size stride_pref = sizeof(StitchSeamFindPreference);
 	ERROR_CHECK_STATUS(vxAccessArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, &stride_pref, (void **)&SeamFind_Pref, VX_READ_ONLY));
 
+	//Flag is set when any overlap is due on this frame (same schedule as the seam find kernels)
 	vx_uint32 flag = 0;
 
-	for (int i = 0; i < SeamFind_Pref_max; i++)
+	for (vx_size i = 0; i < SeamFind_Pref_max && !flag; i++)
 	{
-		if (SeamFind_Pref[i].start_frame == current_frame) flag++;
-		else if ((current_frame + 1) % (SeamFind_Pref[i].frequency + SeamFind_Pref[i].seam_type_num) == 0) flag++;
-
-		if (flag) break;
+		if (seamfind_is_overlap_due(SeamFind_Pref[i], current_frame))
+			flag = 1;
 	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(Array_SeamFind_Pref, 0, SeamFind_Pref_max, SeamFind_Pref));
 
 	vx_scalar Scalar_flag = (vx_scalar)parameters[2];
 	ERROR_CHECK_STATUS(vxWriteScalarValue(Scalar_flag, &flag));
@@ -3598,7 +4206,7 @@ static vx_status VX_CALLBACK seamfind_analyze_kernel(vx_node node, const vx_refe
 vx_status seamfind_analyze_publish(vx_context context)
 {
 	// add kernel to the context with callbacks
-	vx_kernel kernel = vxAddKernel(context, "com.amd.stitching.seamfind_analyze",
+	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.seamfind_analyze",
 		AMDOVX_KERNEL_STITCHING_SEAMFIND_ANALYZE,
 		seamfind_analyze_kernel,
 		3,
@@ -3753,9 +4361,9 @@ vx_status GenerateSeamFindBuffers(
 	// generate tables
 	vx_uint32 accumulation_entry = 0, valid_entry = 0, weight_entry = 0, overlap_number = 0;
 	vx_int16 horizontal_overlap = 0, vertical_overlap = 0;
+	std::vector<vx_uint32> overlapPair; // (cam_i << 16) | (cam_j << 8) | seam type of each overlap, in overlap_number order
 	for (vx_uint32 i = 1; i < numCamera; i++) {
 		for (vx_uint32 j = 0; j < i; j++) {
-			vx_uint32 overlapMaskBits = (1 << i) | (1 << j);
 			vx_uint32 start_x = overlapValid[i][j].start_x, end_x = overlapValid[i][j].end_x;
 			vx_uint32 start_y = overlapValid[i][j].start_y, end_y = overlapValid[i][j].end_y;
 			if (start_x < end_x && start_y < end_y) {
@@ -3828,23 +4436,6 @@ vx_status GenerateSeamFindBuffers(
 						prefTable[overlap_number] = prefTableEntry;
 					}
 				}
-				for (vx_uint32 ye = start_y; ye < end_y; ye++) {
-					for (vx_uint32 xe = start_x; xe < end_x; xe++)	{
-						if ((validPixelCamMap[ye  * eqrWidth + xe] & overlapMaskBits) == overlapMaskBits) {
-							if (weight_entry < weightTableSize) {
-								StitchSeamFindWeightEntry weightTableEntry = { 0 };
-								weightTableEntry.x = xe;
-								weightTableEntry.y = ye;
-								weightTableEntry.cam_id_1 = j;
-								weightTableEntry.cam_id_2 = i;
-								weightTableEntry.overlap_id = overlap_number;
-								weightTableEntry.overlap_type = SEAM_TYPE;
-								weightTable[weight_entry] = weightTableEntry;
-							}
-							weight_entry++;
-						}
-					}
-				}
 				if (overlap_number < prefInfoTableSize)	{
 					StitchSeamFindInformation infoTableEntry = { 0 };
 					infoTableEntry.cam_id_1 = j;
@@ -3856,12 +4447,46 @@ vx_status GenerateSeamFindBuffers(
 					infoTableEntry.offset = accumulation_entry;
 					infoTable[overlap_number] = infoTableEntry;
 				}
+				overlapPair.push_back((i << 16) | (j << 8) | (vx_uint8)SEAM_TYPE);
 				accumulation_entry += overlapWidth * overlapHeight;
 				overlap_number++;
 			}
 		}
 	}
 
+	// generate weightTable: entries of each overlap are generated in parallel and
+	// then concatenated in overlap order, so that the table is same as the one from a serial scan
+	std::vector< std::vector<StitchSeamFindWeightEntry> > weightList(overlapPair.size());
+	#pragma omp parallel for schedule(dynamic)
+	for (vx_int32 overlap = 0; overlap < (vx_int32)overlapPair.size(); overlap++) {
+		vx_uint32 i = overlapPair[overlap] >> 16, j = (overlapPair[overlap] >> 8) & 0xff;
+		vx_int16 SEAM_TYPE = (vx_int8)(overlapPair[overlap] & 0xff);
+		vx_uint32 overlapMaskBits = (1 << i) | (1 << j);
+		vx_uint32 start_x = overlapValid[i][j].start_x, end_x = overlapValid[i][j].end_x;
+		vx_uint32 start_y = overlapValid[i][j].start_y, end_y = overlapValid[i][j].end_y;
+		for (vx_uint32 ye = start_y; ye < end_y; ye++) {
+			for (vx_uint32 xe = start_x; xe < end_x; xe++)	{
+				if ((validPixelCamMap[ye  * eqrWidth + xe] & overlapMaskBits) == overlapMaskBits) {
+					StitchSeamFindWeightEntry weightTableEntry = { 0 };
+					weightTableEntry.x = xe;
+					weightTableEntry.y = ye;
+					weightTableEntry.cam_id_1 = j;
+					weightTableEntry.cam_id_2 = i;
+					weightTableEntry.overlap_id = overlap;
+					weightTableEntry.overlap_type = SEAM_TYPE;
+					weightList[overlap].push_back(weightTableEntry);
+				}
+			}
+		}
+	}
+	for (size_t overlap = 0; overlap < weightList.size(); overlap++) {
+		for (size_t k = 0; k < weightList[overlap].size(); k++) {
+			if (weight_entry < weightTableSize)
+				weightTable[weight_entry] = weightList[overlap][k];
+			weight_entry++;
+		}
+	}
+
 	// check for buffer overflow error condition
 	if (valid_entry > validTableSize || weight_entry > weightTableSize ||
 		accumulation_entry > accumTableSize || overlap_number > prefInfoTableSize)
@@ -3876,7 +4501,8 @@ vx_status GenerateSeamFindBuffers(
 		entry.parent_y = -1;
 		entry.value = -1;
 		entry.propagate = -1;
-		for (vx_uint32 i = 0; i < accumulation_entry; i++) {
+		#pragma omp parallel for
+		for (vx_int32 i = 0; i < (vx_int32)accumulation_entry; i++) {
 			accumTable[i] = entry;
 		}
 	}
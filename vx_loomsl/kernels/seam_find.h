@@ -119,6 +119,14 @@ typedef struct{
 	vx_int32 value;
 }StitchSeamFindAccum;
 
+//! \brief Check if the seam of an overlap is due on a frame: on its start frame (first seam or scene change)
+//  and every (frequency + seam_type_num) frames, unless the overlap is disabled (priority -1).
+inline bool seamfind_is_overlap_due(const StitchSeamFindPreference& pref, vx_uint32 current_frame)
+{
+	vx_int32 period = pref.frequency + pref.seam_type_num;
+	return pref.priority != -1 && (((vx_uint32)pref.start_frame == current_frame) || (period > 0 && ((current_frame + 1) % period) == 0));
+}
+
 vx_status Seamfind_CopyWeights(vx_image weight_image, vx_image new_weight_image, vx_rectangle_t *Overlap_ROI, vx_int32 *Overlap_matrix, vx_uint32 width, vx_uint32 height, vx_uint32 NumCam);
 vx_status Seamfind_seamrange(vx_uint32 *seam_adjust, vx_uint32 x_dir);
 vx_status seamfind_utility(vx_uint32 mode, vx_uint32 eqr_width, vx_uint32 num_cam, SeamFindSizeInfo *entry_var);
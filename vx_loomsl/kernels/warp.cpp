@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #define _CRT_SECURE_NO_WARNINGS
 #include "warp.h"
+#include "color_convert.h"
 
 #define WRITE_LUMA_AS_A 1
 
@@ -88,7 +89,7 @@ static vx_status VX_CALLBACK warp_input_validator(vx_node node, vx_uint32 index)
 
 	}
 	else if (index == 4)
-	{ // image of format RGB or RGBX
+	{ // image of format RGB or RGBX or UYVY or YUYV
 		// check input image format and dimensions
 		vx_uint32 input_width = 0, input_height = 0;
 		vx_df_image input_format = VX_DF_IMAGE_VIRT;
@@ -96,7 +97,7 @@ static vx_status VX_CALLBACK warp_input_validator(vx_node node, vx_uint32 index)
 		ERROR_CHECK_STATUS(vxQueryImage((vx_image)ref, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
 		ERROR_CHECK_STATUS(vxQueryImage((vx_image)ref, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
 		ERROR_CHECK_STATUS(vxReleaseImage((vx_image *)&ref));
-		if (input_format != VX_DF_IMAGE_RGB && input_format != VX_DF_IMAGE_RGBX) {
+		if (input_format != VX_DF_IMAGE_RGB && input_format != VX_DF_IMAGE_RGBX && input_format != VX_DF_IMAGE_UYVY && input_format != VX_DF_IMAGE_YUYV) {
 			status = VX_ERROR_INVALID_TYPE;
 			vxAddLogEntry((vx_reference)node, status, "ERROR: warp doesn't support input image format: %4.4s\n", &input_format);
 		}
@@ -135,10 +136,19 @@ static vx_status VX_CALLBACK warp_output_validator(vx_node node, vx_uint32 index
 		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
 		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
 		ERROR_CHECK_STATUS(vxReleaseImage(&image));
+		vx_df_image input_format = VX_DF_IMAGE_VIRT;
+		image = (vx_image)avxGetNodeParamRef(node, 4);
+		ERROR_CHECK_OBJECT(image);
+		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+		ERROR_CHECK_STATUS(vxReleaseImage(&image));
 		if (output_format != VX_DF_IMAGE_RGB && output_format != VX_DF_IMAGE_RGBX) {
 			// pick RGBX as default
 			output_format = VX_DF_IMAGE_RGBX;
 		}
+		if (input_format == VX_DF_IMAGE_UYVY || input_format == VX_DF_IMAGE_YUYV) {
+			// packed YUV input is only supported with RGBX output
+			output_format = VX_DF_IMAGE_RGBX;
+		}
 		// set output image meta data
 		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
 		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
@@ -185,7 +195,7 @@ static vx_status VX_CALLBACK warp_query_target_support(vx_graph graph, vx_node n
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = StitchGetColorKernelTargetAffinity();
 	return VX_SUCCESS;
 }
 
@@ -250,6 +260,11 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 	ERROR_CHECK_OBJECT(image);
 	ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
 	ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	StitchYuvToRgbParams yuv = { 0 };
+	bool bPacked422Input = (input_format == VX_DF_IMAGE_UYVY || input_format == VX_DF_IMAGE_YUYV);
+	if (bPacked422Input) {
+		ERROR_CHECK_STATUS(StitchGetYuvToRgbParams(image, yuv));
+	}
 	ERROR_CHECK_STATUS(vxReleaseImage(&image));
 	image = (vx_image)avxGetNodeParamRef(node, 5);						// output image
 	ERROR_CHECK_OBJECT(image);
@@ -283,9 +298,35 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 
 	// kernel header and reading
 	char item[8192];
-	sprintf(item,
+	opencl_kernel_code =
 		"#pragma OPENCL EXTENSION cl_amd_media_ops : enable\n"
-		"#pragma OPENCL EXTENSION cl_amd_media_ops2 : enable\n"
+		"#pragma OPENCL EXTENSION cl_amd_media_ops2 : enable\n";
+	if (bPacked422Input) {
+		// helpers to convert and bilinear interpolate packed 4:2:2 camera pixels (same math as color_convert)
+		sprintf(item,
+			"float3 p422_to_rgb(uint pair, uint odd)\n"
+			"{\n"
+			"  float y = mad(odd ? amd_unpack%d(pair) : amd_unpack%d(pair), %.8ff, %.8ff);\n" // yuv.posY1, yuv.posY0, yuv.r2f[0], yuv.r2f[1]
+			"  float u = mad(amd_unpack%d(pair), %.8ff, %.8ff);\n" // yuv.posU, yuv.r2f[2], yuv.r2f[3]
+			"  float v = mad(amd_unpack%d(pair), %.8ff, %.8ff);\n" // yuv.posV, yuv.r2f[2], yuv.r2f[3]
+			"  float3 f; f.s0 = mad(%.4ff, v, y); f.s1 = mad(%.4ff, u, mad(%.4ff, v, y)); f.s2 = mad(%.4ff, u, y);\n" // yuv.cRv, yuv.cGu, yuv.cGv, yuv.cBu
+			"  return clamp(f, 0.0f, 255.0f);\n"
+			"}\n"
+			"float3 p422_bilinear(__global uchar * ip_buf, uint ip_stride, uint sx, uint sy)\n"
+			"{\n"
+			"  uint x = sx >> 3, odd = x & 1;\n"
+			"  __global uchar * pt = ip_buf + (sy >> 3) * ip_stride + ((x >> 1) << 2);\n"
+			"  uint2 px0 = vload2(0, (__global uint *)pt), px1 = vload2(0, (__global uint *)(pt + ip_stride));\n"
+			"  float4 mf; mf.s0 = (sx & 7) * 0.125f; mf.s1 = (sy & 7) * 0.125f; mf.s2 = 1.0f - mf.s0; mf.s3 = 1.0f - mf.s1;\n"
+			"  float3 f0 = mad(p422_to_rgb(px0.s0, odd), mf.s2, p422_to_rgb(odd ? px0.s1 : px0.s0, odd ^ 1) * mf.s0);\n"
+			"  float3 f1 = mad(p422_to_rgb(px1.s0, odd), mf.s2, p422_to_rgb(odd ? px1.s1 : px1.s0, odd ^ 1) * mf.s0);\n"
+			"  return mad(f0, mf.s3, f1 * mf.s1);\n"
+			"}\n"
+			, yuv.posY1, yuv.posY0, yuv.r2f[0], yuv.r2f[1], yuv.posU, yuv.r2f[2], yuv.r2f[3], yuv.posV, yuv.r2f[2], yuv.r2f[3]
+			, yuv.cRv, yuv.cGu, yuv.cGv, yuv.cBu);
+		opencl_kernel_code += item;
+	}
+	sprintf(item,
 		"__kernel __attribute__((reqd_work_group_size(%d, 1, 1)))\n" // opencl_local_work[0]
 		"void %s(uint grayscale_compute_method,\n" // opencl_kernel_function_name
 		"        uint num_cameras,\n"
@@ -294,7 +335,7 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 		"        uint ip_width, uint ip_height, __global uchar * ip_buf, uint ip_stride, uint ip_offset,\n"
 		"        uint op_width, uint op_height, __global uchar * op_buf, uint op_stride, uint op_offset"
 		, opencl_local_work[0], opencl_kernel_function_name);
-	opencl_kernel_code = item;
+	opencl_kernel_code += item;
 	if (bWriteU8Image) {
 		opencl_kernel_code +=
 			",\n"
@@ -353,7 +394,39 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 		opencl_kernel_code += "    float3 RGBToY = (float3)(0.2126f, 0.7152f, 0.0722f);\n";
 #endif
 	}
-	if (input_format == VX_DF_IMAGE_RGB)
+	if (bPacked422Input)
+	{
+		// output_format is RGBX: see warp_output_validator
+		opencl_kernel_code +=
+			"    uint invalidPix = amd_pack((float4)(0.0f, 0.0f, 0.0f, 128.0f));\n";
+		for (int i = 0; i < 4; i++) {
+			sprintf(item,
+				"    // pixel[%d]\n"
+				"    sx = map.s%d & 0xffff; sy = (map.s%d >> 16) & 0xffff;\n"
+				"    f.s012 = (sx == 0xffff && sy == 0xffff) ? (float3)(0.0f) : p422_bilinear(ip_buf, ip_stride, sx, sy);\n"
+				, i, i, i);
+			opencl_kernel_code += item;
+			if (grayscale_compute_method == STITCH_GRAY_SCALE_COMPUTE_METHOD_AVG)
+				opencl_kernel_code += "    f.s3 = (f.s0 + f.s1 + f.s2) * 0.3333333333f;\n";
+			else
+			{
+				opencl_kernel_code +=
+					"    f.s3 = mad(f.s0, f.s0, mad(f.s1, f.s1, f.s2 * f.s2));\n"
+					"    f.s3 = sqrt(f.s3 * 0.3333333333f);\n";
+			}
+			if (bWriteU8Image) {
+#if WRITE_LUMA_AS_A
+				sprintf(item, "    Yval.s%d = select(mad(f.s0, RGBToY.s0, mad(f.s1, RGBToY.s1, f.s2 * RGBToY.s2)), 0.0f, sx == 0xffff && sy == 0xffff);\n", i);
+#else
+				sprintf(item, "    Yval.s%d = select(f.s3, 0.0f, sx == 0xffff && sy == 0xffff);\n", i);
+#endif
+				opencl_kernel_code += item;
+			}
+			sprintf(item, "    outpix.s%d = select(amd_pack(f), invalidPix, sx == 0xffff && sy == 0xffff);\n", i);
+			opencl_kernel_code += item;
+		}
+	}
+	else if (input_format == VX_DF_IMAGE_RGB)
 	{
 		opencl_kernel_code +=
 			"    uint3 px0, px1;\n"
@@ -721,10 +794,128 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief Fetch a camera pixel as RGBA for the host implementation (A is only meaningful for RGBX input).
+static inline void warp_fetch_pixel(vx_df_image format, const StitchYuvToRgbParams& yuv, const vx_uint8 * row, vx_uint32 x, vx_float32 pix[4])
+{
+	if (format == VX_DF_IMAGE_RGB) {
+		const vx_uint8 * pt = row + x * 3;
+		pix[0] = pt[0]; pix[1] = pt[1]; pix[2] = pt[2]; pix[3] = 0.0f;
+	}
+	else if (format == VX_DF_IMAGE_RGBX) {
+		const vx_uint8 * pt = row + x * 4;
+		pix[0] = pt[0]; pix[1] = pt[1]; pix[2] = pt[2]; pix[3] = pt[3];
+	}
+	else {
+		StitchYuvToRgb(yuv, row + ((x >> 1) << 2), x & 1, pix);
+		pix[3] = 0.0f;
+	}
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK warp_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	// host implementation: RGBX output only
+	vx_enum grayscale_compute_method;
+	vx_uint32 num_cameras = 0, num_camera_columns = 1;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &grayscale_compute_method));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[1], &num_cameras));
+	if (parameters[7]) {
+		ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[7], &num_camera_columns));
+	}
+	vx_array valid_arr = (vx_array)parameters[2];
+	vx_array remap_arr = (vx_array)parameters[3];
+	vx_image input_image = (vx_image)parameters[4];
+	vx_image output_image = (vx_image)parameters[5];
+	vx_image output_u8_image = (vx_image)parameters[6];
+	vx_uint32 input_width = 0, input_height = 0, output_width = 0, output_height = 0;
+	vx_df_image input_format = VX_DF_IMAGE_VIRT, output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	if (output_format != VX_DF_IMAGE_RGBX)
+		return VX_ERROR_NOT_SUPPORTED;
+	StitchYuvToRgbParams yuv = { 0 };
+	if (input_format == VX_DF_IMAGE_UYVY || input_format == VX_DF_IMAGE_YUYV) {
+		ERROR_CHECK_STATUS(StitchGetYuvToRgbParams(input_image, yuv));
+	}
+	vx_size num_items = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(valid_arr, VX_ARRAY_ATTRIBUTE_NUMITEMS, &num_items, sizeof(num_items)));
+	if (num_items == 0)
+		return VX_SUCCESS;
+
+	vx_size valid_stride = 0, remap_stride = 0;
+	StitchValidPixelEntry * valid_entry = nullptr;
+	StitchWarpRemapEntry * remap_entry = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(valid_arr, 0, num_items, &valid_stride, (void **)&valid_entry, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessArrayRange(remap_arr, 0, num_items, &remap_stride, (void **)&remap_entry, VX_READ_ONLY));
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height };
+	vx_rectangle_t output_rect = { 0, 0, output_width, output_height };
+	vx_imagepatch_addressing_t input_addr, output_addr, output_u8_addr;
+	void * input_ptr = nullptr, * output_ptr = nullptr, * output_u8_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+	if (output_u8_image) {
+		ERROR_CHECK_STATUS(vxAccessImagePatch(output_u8_image, &output_rect, 0, &output_u8_addr, &output_u8_ptr, VX_WRITE_ONLY));
+	}
+
+	// same addressing as the OpenCL kernel: each entry covers 8 consecutive output pixels of a camera
+	vx_uint32 ip_image_height_offs = input_height / num_cameras;
+	vx_uint32 op_image_height_offs = output_height / num_cameras;
+	#pragma omp parallel for
+	for (vx_int32 item = 0; item < (vx_int32)num_items; item++) {
+		const StitchValidPixelEntry * entry = (const StitchValidPixelEntry *)((const vx_uint8 *)valid_entry + item * valid_stride);
+		const vx_uint16 * map = (const vx_uint16 *)((const vx_uint8 *)remap_entry + item * remap_stride);
+		vx_uint32 camera_id = entry->camId, op_x = entry->dstX, op_y = entry->dstY;
+		vx_uint32 ip_row = (camera_id / num_camera_columns) * ip_image_height_offs;
+		vx_uint32 op_row = camera_id * op_image_height_offs + op_y;
+		vx_uint8 * op_buf = (vx_uint8 *)output_ptr + op_row * output_addr.stride_y + (op_x << 5);
+		vx_uint8 * op_u8_buf = output_u8_ptr ? (vx_uint8 *)output_u8_ptr + op_row * output_u8_addr.stride_y + (op_x << 3) : nullptr;
+		for (vx_uint32 i = 0; i < 8; i++) {
+			vx_uint32 sx = map[2 * i], sy = map[2 * i + 1];
+			if (sx == 0xffff && sy == 0xffff) {
+				op_buf[4 * i + 0] = op_buf[4 * i + 1] = op_buf[4 * i + 2] = 0; op_buf[4 * i + 3] = 128;
+				if (op_u8_buf) op_u8_buf[i] = 0;
+				continue;
+			}
+			vx_uint32 x0 = sx >> 3, y0 = sy >> 3;
+			vx_uint32 x1 = std::min(x0 + 1, input_width - 1);
+			const vx_uint8 * row0 = (const vx_uint8 *)input_ptr + (ip_row + y0) * input_addr.stride_y;
+			const vx_uint8 * row1 = (ip_row + y0 + 1 < input_height) ? row0 + input_addr.stride_y : row0;
+			vx_float32 fx = (sx & 7) * 0.125f, fy = (sy & 7) * 0.125f;
+			vx_float32 p00[4], p01[4], p10[4], p11[4], f[4];
+			warp_fetch_pixel(input_format, yuv, row0, x0, p00); warp_fetch_pixel(input_format, yuv, row0, x1, p01);
+			warp_fetch_pixel(input_format, yuv, row1, x0, p10); warp_fetch_pixel(input_format, yuv, row1, x1, p11);
+			for (int c = 0; c < 4; c++)
+				f[c] = (p00[c] * (1.0f - fx) + p01[c] * fx) * (1.0f - fy) + (p10[c] * (1.0f - fx) + p11[c] * fx) * fy;
+			if (input_format != VX_DF_IMAGE_RGBX) {
+				if (grayscale_compute_method == STITCH_GRAY_SCALE_COMPUTE_METHOD_AVG)
+					f[3] = (f[0] + f[1] + f[2]) * 0.3333333333f;
+				else
+					f[3] = sqrtf((f[0] * f[0] + f[1] * f[1] + f[2] * f[2]) * 0.3333333333f);
+			}
+			for (int c = 0; c < 4; c++)
+				op_buf[4 * i + c] = StitchClampToU8(f[c]);
+			if (op_u8_buf) {
+#if WRITE_LUMA_AS_A
+				op_u8_buf[i] = StitchClampToU8(f[0] * 0.2126f + f[1] * 0.7152f + f[2] * 0.0722f);
+#else
+				op_u8_buf[i] = StitchClampToU8(f[3]);
+#endif
+			}
+		}
+	}
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &input_rect, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+	if (output_u8_image) {
+		ERROR_CHECK_STATUS(vxCommitImagePatch(output_u8_image, &output_rect, 0, &output_u8_addr, output_u8_ptr));
+	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(valid_arr, 0, num_items, valid_entry));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(remap_arr, 0, num_items, remap_entry));
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
@@ -764,11 +955,261 @@ vx_status warp_publish(vx_context context)
 	return VX_SUCCESS;
 }
 
+//////////////////////////////////////////////////////////////////////
+// Simple remap: bilinear remap of the whole camera buffer into the output
+// using one StitchSimpleRemapEntry per output pixel (quick stitch mode).
+
+//! \brief The number of output rows processed together by a host thread.
+#define SIMPLE_REMAP_HOST_SLICE_HEIGHT   16
+
+//! \brief The input validator callback.
+static vx_status VX_CALLBACK simple_remap_input_validator(vx_node node, vx_uint32 index)
+{
+	vx_status status = VX_ERROR_INVALID_PARAMETERS;
+	// get reference for parameter at specified index
+	vx_reference ref = avxGetNodeParamRef(node, index);
+	ERROR_CHECK_OBJECT(ref);
+	// validate each parameter
+	if (index == 0)
+	{ // image of format RGB or RGBX
+		vx_df_image input_format = VX_DF_IMAGE_VIRT;
+		ERROR_CHECK_STATUS(vxQueryImage((vx_image)ref, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+		ERROR_CHECK_STATUS(vxReleaseImage((vx_image *)&ref));
+		if (input_format != VX_DF_IMAGE_RGB && input_format != VX_DF_IMAGE_RGBX) {
+			status = VX_ERROR_INVALID_TYPE;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: simple_remap doesn't support input image format: %4.4s\n", &input_format);
+		}
+		else {
+			status = VX_SUCCESS;
+		}
+	}
+	else if (index == 1)
+	{ // array object of StitchSimpleRemapEntry type
+		vx_size itemsize = 0;
+		ERROR_CHECK_STATUS(vxQueryArray((vx_array)ref, VX_ARRAY_ATTRIBUTE_ITEMSIZE, &itemsize, sizeof(itemsize)));
+		ERROR_CHECK_STATUS(vxReleaseArray((vx_array *)&ref));
+		if (itemsize == sizeof(StitchSimpleRemapEntry)) {
+			status = VX_SUCCESS;
+		}
+		else {
+			status = VX_ERROR_INVALID_DIMENSION;
+			vxAddLogEntry((vx_reference)node, status, "ERROR: simple_remap array element (StitchSimpleRemapEntry) size should be 4 bytes\n");
+		}
+	}
+	return status;
+}
+
+//! \brief The output validator callback.
+static vx_status VX_CALLBACK simple_remap_output_validator(vx_node node, vx_uint32 index, vx_meta_format meta)
+{
+	vx_status status = VX_ERROR_INVALID_PARAMETERS;
+	if (index == 2)
+	{ // image of same format as input
+		vx_uint32 output_width = 0, output_height = 0;
+		vx_df_image input_format = VX_DF_IMAGE_VIRT;
+		// get image configuration
+		vx_image image = (vx_image)avxGetNodeParamRef(node, 0);
+		ERROR_CHECK_OBJECT(image);
+		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+		ERROR_CHECK_STATUS(vxReleaseImage(&image));
+		image = (vx_image)avxGetNodeParamRef(node, index);
+		ERROR_CHECK_OBJECT(image);
+		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+		ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+		ERROR_CHECK_STATUS(vxReleaseImage(&image));
+		// set output image meta data
+		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+		ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(meta, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+		status = VX_SUCCESS;
+	}
+	return status;
+}
+
+//! \brief The kernel target support callback.
+static vx_status VX_CALLBACK simple_remap_query_target_support(vx_graph graph, vx_node node,
+	vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
+	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
+	)
+{
+	supported_target_affinity = StitchGetColorKernelTargetAffinity();
+	return VX_SUCCESS;
+}
+
+//! \brief The OpenCL code generator callback.
+static vx_status VX_CALLBACK simple_remap_opencl_codegen(
+	vx_node node,                                  // [input] node
+	const vx_reference parameters[],               // [input] parameters
+	vx_uint32 num,                                 // [input] number of parameters
+	bool opencl_load_function,                     // [input]  false: normal OpenCL kernel; true: reserved
+	char opencl_kernel_function_name[64],          // [output] kernel_name for clCreateKernel()
+	std::string& opencl_kernel_code,               // [output] string for clCreateProgramWithSource()
+	std::string& opencl_build_options,             // [output] options for clBuildProgram()
+	vx_uint32& opencl_work_dim,                    // [output] work_dim for clEnqueueNDRangeKernel()
+	vx_size opencl_global_work[],                  // [output] global_work[] for clEnqueueNDRangeKernel()
+	vx_size opencl_local_work[],                   // [output] local_work[] for clEnqueueNDRangeKernel()
+	vx_uint32& opencl_local_buffer_usage_mask,     // [output] reserved: must be ZERO
+	vx_uint32& opencl_local_buffer_size_in_bytes   // [output] reserved: must be ZERO
+	)
+{
+	// get image configuration
+	vx_uint32 output_width = 0, output_height = 0;
+	vx_df_image output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[2], VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[2], VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[2], VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	int N = (output_format == VX_DF_IMAGE_RGBX) ? 4 : 3;
+	// set kernel configuration: one work-item per output pixel
+	strcpy(opencl_kernel_function_name, "simple_remap");
+	vx_uint32 work_items[2] = { output_width, output_height };
+	opencl_work_dim = 2;
+	opencl_local_work[0] = 16;
+	opencl_local_work[1] = 4;
+	opencl_global_work[0] = (work_items[0] + opencl_local_work[0] - 1) & ~(opencl_local_work[0] - 1);
+	opencl_global_work[1] = (work_items[1] + opencl_local_work[1] - 1) & ~(opencl_local_work[1] - 1);
+
+	// Setting variables required by the interface
+	opencl_local_buffer_usage_mask = 0;
+	opencl_local_buffer_size_in_bytes = 0;
+
+	// kernel header and reading: bilinear weights are in 1/64 units so that host and GPU give identical results
+	char item[8192];
+	sprintf(item,
+		"__kernel __attribute__((reqd_work_group_size(%d, %d, 1)))\n" // opencl_local_work[0], opencl_local_work[1]
+		"void %s(uint ip_width, uint ip_height, __global uchar * ip_buf, uint ip_stride, uint ip_offset,\n" // opencl_kernel_function_name
+		"        __global char * remap_buf, uint remap_buf_offset, uint remap_num_items,\n"
+		"        uint op_width, uint op_height, __global uchar * op_buf, uint op_stride, uint op_offset)\n"
+		"{\n"
+		"  int gx = get_global_id(0);\n"
+		"  int gy = get_global_id(1);\n"
+		"  if ((gx < %d) && (gy < %d)) {\n" // work_items[0], work_items[1]
+		"    uint map = *(__global uint *) (remap_buf + remap_buf_offset + ((gy * %d + gx) << 2));\n" // work_items[0]
+		"    uint%d sum = (uint%d)0;\n" // N, N
+		"    if (map != 0xffffffff) {\n"
+		"      uint sx = map & 0xffff, sy = map >> 16;\n"
+		"      uint x0 = sx >> 3, y0 = sy >> 3;\n"
+		"      uint x1 = min(x0 + 1, ip_width - 1), y1 = min(y0 + 1, ip_height - 1);\n"
+		"      uint fx = sx & 7, fy = sy & 7;\n"
+		"      __global uchar * r0 = ip_buf + ip_offset + y0 * ip_stride;\n"
+		"      __global uchar * r1 = ip_buf + ip_offset + y1 * ip_stride;\n"
+		"      sum  = convert_uint%d(vload%d(0, r0 + x0 * %d)) * ((8 - fx) * (8 - fy));\n" // N, N, N
+		"      sum += convert_uint%d(vload%d(0, r0 + x1 * %d)) * (fx * (8 - fy));\n" // N, N, N
+		"      sum += convert_uint%d(vload%d(0, r1 + x0 * %d)) * ((8 - fx) * fy);\n" // N, N, N
+		"      sum += convert_uint%d(vload%d(0, r1 + x1 * %d)) * (fx * fy);\n" // N, N, N
+		"      sum = (sum + 32) >> 6;\n"
+		"    }\n"
+		"    vstore%d(convert_uchar%d(sum), 0, op_buf + op_offset + gy * op_stride + gx * %d);\n" // N, N, N
+		"  }\n"
+		"}\n"
+		, (int)opencl_local_work[0], (int)opencl_local_work[1], opencl_kernel_function_name, work_items[0], work_items[1], work_items[0]
+		, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N);
+	opencl_kernel_code = item;
+
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel execution.
+static vx_status VX_CALLBACK simple_remap_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+	vx_image input_image = (vx_image)parameters[0];
+	vx_array remap_arr = (vx_array)parameters[1];
+	vx_image output_image = (vx_image)parameters[2];
+	vx_uint32 input_width = 0, input_height = 0, output_width = 0, output_height = 0;
+	vx_df_image output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	vx_size num_items = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(remap_arr, VX_ARRAY_ATTRIBUTE_NUMITEMS, &num_items, sizeof(num_items)));
+	if (num_items != (vx_size)output_width * output_height) {
+		vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_DIMENSION, "ERROR: simple_remap table has %d entries, expected %d\n", (int)num_items, output_width * output_height);
+		return VX_ERROR_INVALID_DIMENSION;
+	}
+	const vx_uint32 N = (output_format == VX_DF_IMAGE_RGBX) ? 4 : 3;
+
+	vx_size remap_stride = 0;
+	StitchSimpleRemapEntry * remap_entry = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(remap_arr, 0, num_items, &remap_stride, (void **)&remap_entry, VX_READ_ONLY));
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height };
+	vx_rectangle_t output_rect = { 0, 0, output_width, output_height };
+	vx_imagepatch_addressing_t input_addr, output_addr;
+	void * input_ptr = nullptr, * output_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+
+	// each thread processes a horizontal slice of output rows: table and output are read/written sequentially
+	vx_int32 num_slices = (vx_int32)((output_height + SIMPLE_REMAP_HOST_SLICE_HEIGHT - 1) / SIMPLE_REMAP_HOST_SLICE_HEIGHT);
+	#pragma omp parallel for schedule(dynamic)
+	for (vx_int32 slice = 0; slice < num_slices; slice++) {
+		vx_uint32 y_end = std::min((vx_uint32)(slice + 1) * SIMPLE_REMAP_HOST_SLICE_HEIGHT, output_height);
+		for (vx_uint32 y = (vx_uint32)slice * SIMPLE_REMAP_HOST_SLICE_HEIGHT; y < y_end; y++) {
+			const vx_uint8 * map = (const vx_uint8 *)remap_entry + (vx_size)y * output_width * remap_stride;
+			vx_uint8 * op_buf = (vx_uint8 *)output_ptr + y * output_addr.stride_y;
+			for (vx_uint32 x = 0; x < output_width; x++, map += remap_stride, op_buf += N) {
+				const StitchSimpleRemapEntry * entry = (const StitchSimpleRemapEntry *)map;
+				vx_uint32 sx = entry->srcX, sy = entry->srcY;
+				if (sx == 0xffff && sy == 0xffff) {
+					for (vx_uint32 c = 0; c < N; c++)
+						op_buf[c] = 0;
+					continue;
+				}
+				vx_uint32 x0 = sx >> 3, y0 = sy >> 3;
+				vx_uint32 x1 = std::min(x0 + 1, input_width - 1), y1 = std::min(y0 + 1, input_height - 1);
+				vx_uint32 fx = sx & 7, fy = sy & 7;
+				vx_uint32 w00 = (8 - fx) * (8 - fy), w01 = fx * (8 - fy), w10 = (8 - fx) * fy, w11 = fx * fy;
+				const vx_uint8 * p0 = (const vx_uint8 *)input_ptr + y0 * input_addr.stride_y;
+				const vx_uint8 * p1 = (const vx_uint8 *)input_ptr + y1 * input_addr.stride_y;
+				const vx_uint8 * p00 = p0 + x0 * N, * p01 = p0 + x1 * N, * p10 = p1 + x0 * N, * p11 = p1 + x1 * N;
+				for (vx_uint32 c = 0; c < N; c++)
+					op_buf[c] = (vx_uint8)((p00[c] * w00 + p01[c] * w01 + p10[c] * w10 + p11[c] * w11 + 32) >> 6);
+			}
+		}
+	}
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, &input_rect, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(remap_arr, 0, num_items, remap_entry));
+	return VX_SUCCESS;
+}
+
+//! \brief The kernel publisher.
+vx_status simple_remap_publish(vx_context context)
+{
+	// add kernel to the context with callbacks
+	vx_kernel kernel = vxAddKernel(context, "com.amd.loomsl.simple_remap",
+		AMDOVX_KERNEL_STITCHING_SIMPLE_REMAP,
+		simple_remap_kernel,
+		3,
+		simple_remap_input_validator,
+		simple_remap_output_validator,
+		nullptr,
+		nullptr);
+	ERROR_CHECK_OBJECT(kernel);
+	amd_kernel_query_target_support_f query_target_support_f = simple_remap_query_target_support;
+	amd_kernel_opencl_codegen_callback_f opencl_codegen_callback_f = simple_remap_opencl_codegen;
+	ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT, &query_target_support_f, sizeof(query_target_support_f)));
+	ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_OPENCL_CODEGEN_CALLBACK, &opencl_codegen_callback_f, sizeof(opencl_codegen_callback_f)));
+
+	// set kernel parameters
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
+	ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+
+	// finalize and release kernel object
+	ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
+	ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+
+	return VX_SUCCESS;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Calculate buffer sizes and generate data in buffers for warp
 //   CalculateLargestWarpBufferSizes  - useful when reinitialize is enabled
 //   CalculateSmallestWarpBufferSizes - useful when reinitialize is disabled
 //   GenerateWarpBuffers              - generate tables
+//   GenerateSimpleRemapBuffer        - generate table for simple remap (quick stitch mode)
 
 vx_status CalculateLargestWarpBufferSizes(
 	vx_uint32 numCamera,                  // [in] number of cameras
@@ -818,6 +1259,20 @@ vx_status CalculateSmallestWarpBufferSizes(
 	return VX_SUCCESS;
 }
 
+//! \brief Get the mask of cameras used by 8 consecutive pixels.
+static inline vx_uint32 GetCamMaskFor8Pixels(const vx_uint32 * validPixelCamMap, const vx_uint32 * paddedPixelCamMap)
+{
+	vx_uint32 validMaskFor8Pixels =
+		validPixelCamMap[0] | validPixelCamMap[1] | validPixelCamMap[2] | validPixelCamMap[3] |
+		validPixelCamMap[4] | validPixelCamMap[5] | validPixelCamMap[6] | validPixelCamMap[7];
+	if (paddedPixelCamMap) {
+		validMaskFor8Pixels |=
+			paddedPixelCamMap[0] | paddedPixelCamMap[1] | paddedPixelCamMap[2] | paddedPixelCamMap[3] |
+			paddedPixelCamMap[4] | paddedPixelCamMap[5] | paddedPixelCamMap[6] | paddedPixelCamMap[7];
+	}
+	return validMaskFor8Pixels;
+}
+
 vx_status GenerateWarpBuffers(
 	vx_uint32 numCamera,                         // [in] number of cameras
 	vx_uint32 eqrWidth,                          // [in] output equirectangular image width
@@ -833,69 +1288,74 @@ vx_status GenerateWarpBuffers(
 	vx_size * mapEntryCount                      // [out] number of entries added to warp/valid map table
 	)
 {
-	vx_uint32  entryCount = 0;
-	for (vx_uint32 camId = 0; camId < numCamera; camId++)
+	// entries are ordered by camera and then by row: count the entries of each (camera, row) in parallel
+	// and use the running sum as the first entry of that row, so that all rows can be filled in parallel
+	vx_int32 numRows = (vx_int32)(numCamera * eqrHeight);
+	std::vector<vx_size> rowEntryOffset(numRows + 1, 0);
+	#pragma omp parallel for
+	for (vx_int32 row = 0; row < numRows; row++)
 	{
+		vx_uint32 camMapBit = 1 << (row / eqrHeight);
+		vx_uint32 rowPosition = (row % eqrHeight) * eqrWidth;
+		vx_size rowEntryCount = 0;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr += 8) {
+			vx_uint32 pixelPosition = rowPosition + x_eqr;
+			if (GetCamMaskFor8Pixels(validPixelCamMap + pixelPosition, paddedPixelCamMap ? paddedPixelCamMap + pixelPosition : nullptr) & camMapBit)
+				rowEntryCount++;
+		}
+		rowEntryOffset[row + 1] = rowEntryCount;
+	}
+	for (vx_int32 row = 0; row < numRows; row++)
+		rowEntryOffset[row + 1] += rowEntryOffset[row];
+	vx_size entryCount = rowEntryOffset[numRows];
+
+	#pragma omp parallel for
+	for (vx_int32 row = 0; row < numRows; row++)
+	{
+		vx_uint32 camId = row / eqrHeight, y_eqr = row % eqrHeight;
 		float xSrcOffset = (float)((camId % numCameraColumns) * camWidth) * 8.0f;
 		vx_uint32 camMapBit = 1 << camId;
 		const StitchCoord2dFloat * camSrcMapCurrent = camSrcMap + camId * eqrWidth * eqrHeight;
-		for (vx_uint32 y_eqr = 0, pixelPosition = 0; y_eqr < eqrHeight; y_eqr++)
+		vx_size entry = rowEntryOffset[row];
+		for (vx_uint32 x_eqr = 0, pixelPosition = y_eqr * eqrWidth; x_eqr < eqrWidth && entry < mapTableSize; x_eqr += 8, pixelPosition += 8)
 		{
-			for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr += 8, pixelPosition += 8)
+			// get camera use mask for consecutive 8 pixels from current pixel position
+			if (GetCamMaskFor8Pixels(validPixelCamMap + pixelPosition, paddedPixelCamMap ? paddedPixelCamMap + pixelPosition : nullptr) & camMapBit)
 			{
-				// get camera use mask for consecutive 8 pixels from current pixel position
-				vx_uint32 validMaskFor8Pixels =
-					validPixelCamMap[pixelPosition + 0] | validPixelCamMap[pixelPosition + 1] |
-					validPixelCamMap[pixelPosition + 2] | validPixelCamMap[pixelPosition + 3] |
-					validPixelCamMap[pixelPosition + 4] | validPixelCamMap[pixelPosition + 5] |
-					validPixelCamMap[pixelPosition + 6] | validPixelCamMap[pixelPosition + 7];
+				// get mask to check if all pixels are valid and set validMap entry
+				vx_uint32 allValidMaskFor8Pixels;
 				if (paddedPixelCamMap) {
-					validMaskFor8Pixels |=
-						paddedPixelCamMap[pixelPosition + 0] | paddedPixelCamMap[pixelPosition + 1] |
-						paddedPixelCamMap[pixelPosition + 2] | paddedPixelCamMap[pixelPosition + 3] |
-						paddedPixelCamMap[pixelPosition + 4] | paddedPixelCamMap[pixelPosition + 5] |
-						paddedPixelCamMap[pixelPosition + 6] | paddedPixelCamMap[pixelPosition + 7];
+					allValidMaskFor8Pixels =
+						(validPixelCamMap[pixelPosition + 0] & paddedPixelCamMap[pixelPosition + 0]) &
+						(validPixelCamMap[pixelPosition + 1] & paddedPixelCamMap[pixelPosition + 1]) &
+						(validPixelCamMap[pixelPosition + 2] & paddedPixelCamMap[pixelPosition + 2]) &
+						(validPixelCamMap[pixelPosition + 3] & paddedPixelCamMap[pixelPosition + 3]) &
+						(validPixelCamMap[pixelPosition + 4] & paddedPixelCamMap[pixelPosition + 4]) &
+						(validPixelCamMap[pixelPosition + 5] & paddedPixelCamMap[pixelPosition + 5]) &
+						(validPixelCamMap[pixelPosition + 6] & paddedPixelCamMap[pixelPosition + 6]) &
+						(validPixelCamMap[pixelPosition + 7] & paddedPixelCamMap[pixelPosition + 7]);
 				}
-				if (validMaskFor8Pixels & camMapBit)
-				{
-					if (entryCount < mapTableSize)
-					{
-						// get mask to check if all pixels are valid and set validMap entry
-						vx_uint32 allValidMaskFor8Pixels;
-						if (paddedPixelCamMap) {
-							allValidMaskFor8Pixels =
-								(validPixelCamMap[pixelPosition + 0] & paddedPixelCamMap[pixelPosition + 0]) &
-								(validPixelCamMap[pixelPosition + 1] & paddedPixelCamMap[pixelPosition + 1]) &
-								(validPixelCamMap[pixelPosition + 2] & paddedPixelCamMap[pixelPosition + 2]) &
-								(validPixelCamMap[pixelPosition + 3] & paddedPixelCamMap[pixelPosition + 3]) &
-								(validPixelCamMap[pixelPosition + 4] & paddedPixelCamMap[pixelPosition + 4]) &
-								(validPixelCamMap[pixelPosition + 5] & paddedPixelCamMap[pixelPosition + 5]) &
-								(validPixelCamMap[pixelPosition + 6] & paddedPixelCamMap[pixelPosition + 6]) &
-								(validPixelCamMap[pixelPosition + 7] & paddedPixelCamMap[pixelPosition + 7]);
-						}
-						else {
-							allValidMaskFor8Pixels =
-								validPixelCamMap[pixelPosition + 0] & validPixelCamMap[pixelPosition + 1] &
-								validPixelCamMap[pixelPosition + 2] & validPixelCamMap[pixelPosition + 3] &
-								validPixelCamMap[pixelPosition + 4] & validPixelCamMap[pixelPosition + 5] &
-								validPixelCamMap[pixelPosition + 6] & validPixelCamMap[pixelPosition + 7];
-						}
-						StitchValidPixelEntry validEntry = { 0 };
-						validEntry.camId = camId;
-						validEntry.allValid = (allValidMaskFor8Pixels & camMapBit) ? 1 : 0;
-						validEntry.dstX = x_eqr >> 3;
-						validEntry.dstY = y_eqr;
-						validMap[entryCount] = validEntry;
-						// set warpMap entry: NOTE: assumes that current structure of StitchWarpRemapEntry to be consetive (x,y) value pairs
-						const StitchCoord2dFloat * srcEntry = &camSrcMapCurrent[pixelPosition];
-						vx_uint16 * warpEntry = (vx_uint16 *)&warpMap[entryCount];
-						for (vx_uint32 i = 0; i < 8; i++, warpEntry += 2, srcEntry++) {
-							warpEntry[0] = (srcEntry->x < 0.0f) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->x * 8.0f + 0.5f + xSrcOffset);
-							warpEntry[1] = (srcEntry->y < 0.0f) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->y * 8.0f + 0.5f);
-						}
-					}
-					entryCount++;
+				else {
+					allValidMaskFor8Pixels =
+						validPixelCamMap[pixelPosition + 0] & validPixelCamMap[pixelPosition + 1] &
+						validPixelCamMap[pixelPosition + 2] & validPixelCamMap[pixelPosition + 3] &
+						validPixelCamMap[pixelPosition + 4] & validPixelCamMap[pixelPosition + 5] &
+						validPixelCamMap[pixelPosition + 6] & validPixelCamMap[pixelPosition + 7];
+				}
+				StitchValidPixelEntry validEntry = { 0 };
+				validEntry.camId = camId;
+				validEntry.allValid = (allValidMaskFor8Pixels & camMapBit) ? 1 : 0;
+				validEntry.dstX = x_eqr >> 3;
+				validEntry.dstY = y_eqr;
+				validMap[entry] = validEntry;
+				// set warpMap entry: NOTE: assumes that current structure of StitchWarpRemapEntry to be consetive (x,y) value pairs
+				const StitchCoord2dFloat * srcEntry = &camSrcMapCurrent[pixelPosition];
+				vx_uint16 * warpEntry = (vx_uint16 *)&warpMap[entry];
+				for (vx_uint32 i = 0; i < 8; i++, warpEntry += 2, srcEntry++) {
+					warpEntry[0] = (srcEntry->x < 0.0f) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->x * 8.0f + 0.5f + xSrcOffset);
+					warpEntry[1] = (srcEntry->y < 0.0f) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->y * 8.0f + 0.5f);
 				}
+				entry++;
 			}
 		}
 	}
@@ -908,3 +1368,43 @@ vx_status GenerateWarpBuffers(
 
 	return VX_SUCCESS;
 }
+
+vx_status GenerateSimpleRemapBuffer(
+	vx_uint32 numCamera,                         // [in] number of cameras
+	vx_uint32 numCameraColumns,                  // [in] number of camera columns
+	vx_uint32 camWidth,                          // [in] input camera image width
+	vx_uint32 camHeight,                         // [in] input camera image height
+	vx_uint32 eqrWidth,                          // [in] output equirectangular image width
+	vx_uint32 eqrHeight,                         // [in] output equirectangular image height
+	const StitchCoord2dFloat * camSrcMap,        // [in] camera coordinate mapping: size: [numCamera * eqrWidth * eqrHeight]
+	const vx_uint8 * camIndexBuf,                // [in] camera index of each pixel: size: [eqrWidth * eqrHeight]
+	StitchSimpleRemapEntry * remapMap            // [out] simple remap table: size: [eqrWidth * eqrHeight]
+	)
+{
+	vx_uint32 pixelsPerEqrImage = eqrWidth * eqrHeight;
+	float xSrcOffset[256], ySrcOffset[256];
+	for (vx_uint32 camId = 0; camId < numCamera; camId++) {
+		xSrcOffset[camId] = (float)((camId % numCameraColumns) * camWidth) * 8.0f;
+		ySrcOffset[camId] = (float)((camId / numCameraColumns) * camHeight) * 8.0f;
+	}
+	// every row is independent: fill the table in parallel
+	#pragma omp parallel for
+	for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++)
+	{
+		vx_uint32 pixelPosition = (vx_uint32)y_eqr * eqrWidth;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++)
+		{
+			StitchSimpleRemapEntry entry = { 0xffff, 0xffff };
+			vx_uint32 camId = camIndexBuf[pixelPosition];
+			if (camId < numCamera) {
+				const StitchCoord2dFloat * srcEntry = &camSrcMap[pixelPosition + camId * pixelsPerEqrImage];
+				if (srcEntry->x >= 0.0f && srcEntry->y >= 0.0f) {
+					entry.srcX = (vx_uint16)(srcEntry->x * 8.0f + 0.5f + xSrcOffset[camId]);
+					entry.srcY = (vx_uint16)(srcEntry->y * 8.0f + 0.5f + ySrcOffset[camId]);
+				}
+			}
+			remapMap[pixelPosition] = entry;
+		}
+	}
+	return VX_SUCCESS;
+}
@@ -68,15 +68,30 @@ typedef struct {
 	vx_uint16 srcY7;
 } StitchWarpRemapEntry;
 
+//////////////////////////////////////////////////////////////////////
+//! \brief The simple remap entry for one destination pixel (quick stitch mode).
+//  Entry is invalid if srcX and srcY has all bits set to 1s.
+//  For srcX and srcY coordinates in the whole camera buffer, below fixed-point representation is used:
+//     Q13.3
+typedef struct {
+	vx_uint16 srcX; // source pixel (x,y) for (dstX,dstY) in Q13.3 format
+	vx_uint16 srcY;
+} StitchSimpleRemapEntry;
+
+//! \brief The largest camera buffer width/height that can be addressed by StitchSimpleRemapEntry.
+#define STITCH_SIMPLE_REMAP_MAX_BUFFER_DIM   8191
+
 //////////////////////////////////////////////////////////////////////
 //! \brief The kernel registration functions.
 vx_status warp_publish(vx_context context);
+vx_status simple_remap_publish(vx_context context);
 
 //////////////////////////////////////////////////////////////////////
 // Calculate buffer sizes and generate data in buffers for warp
 //   CalculateLargestWarpBufferSizes  - useful when reinitialize is enabled
 //   CalculateSmallestWarpBufferSizes - useful when reinitialize is disabled
 //   GenerateWarpBuffers              - generate tables
+//   GenerateSimpleRemapBuffer        - generate table for simple remap (quick stitch mode)
 
 vx_status CalculateLargestWarpBufferSizes(
 	vx_uint32 numCamera,                  // [in] number of cameras
@@ -109,4 +124,16 @@ vx_status GenerateWarpBuffers(
 	vx_size * mapEntryCount                      // [out] number of entries added to warp/valid map table
 	);
 
+vx_status GenerateSimpleRemapBuffer(
+	vx_uint32 numCamera,                         // [in] number of cameras
+	vx_uint32 numCameraColumns,                  // [in] number of camera columns
+	vx_uint32 camWidth,                          // [in] input camera image width
+	vx_uint32 camHeight,                         // [in] input camera image height
+	vx_uint32 eqrWidth,                          // [in] output equirectangular image width
+	vx_uint32 eqrHeight,                         // [in] output equirectangular image height
+	const StitchCoord2dFloat * camSrcMap,        // [in] camera coordinate mapping: size: [numCamera * eqrWidth * eqrHeight]
+	const vx_uint8 * camIndexBuf,                // [in] camera index of each pixel: size: [eqrWidth * eqrHeight]
+	StitchSimpleRemapEntry * remapMap            // [out] simple remap table: size: [eqrWidth * eqrHeight]
+	);
+
 #endif //__WARP_H__
@@ -31,6 +31,7 @@ THE SOFTWARE.
 #include <stdarg.h>
 #include <map>
 #include <string>
+#include <chrono>
 
 // Version
 #define LS_VERSION             "0.9.3"
@@ -54,6 +55,7 @@ enum {
 #define LOOMIO_MIN_AUX_DATA_CAPACITY          256
 #define LOOMIO_DEFAULT_AUX_DATA_CAPACITY     1024
 #define LOOMIO_MAX_AUX_DATA_CAPACITY         8192
+#define LIVE_STITCH_MAX_BUFFER_RING_SIZE        8
 struct ls_loomio_info {
 	char module[LOOMIO_MAX_LENGTH_MODULE_NAME];
 	char kernelName[LOOMIO_MAX_LENGTH_KERNEL_NAME];
@@ -80,6 +82,8 @@ struct ls_context_t {
 	// magic word and status
 	int  magic;                                 // should be LIVE_STITCH_MAGIC
 	bool feature_enable_reinitialize;           // true if reinitialize feature is enabled
+	bool fuse_input_color_convert;              // true if warp reads the packed YUV camera buffer directly
+	bool fuse_output_color_convert;             // true if merge writes the packed YUV output buffer directly
 	bool initialized;                           // true if initialized
 	bool scheduled;                             // true if scheduled
 	bool reinitialize_required;                 // true if reinitialize required
@@ -115,6 +119,13 @@ struct ls_context_t {
 	vx_uint32   camera_buffer_stride_in_bytes;  // stride of each row in input opencl buffer
 	vx_uint32   overlay_buffer_stride_in_bytes; // stride of each row in overlay opencl buffer (optional)
 	vx_uint32   output_buffer_stride_in_bytes;  // stride of each row in output opencl buffer
+	vx_enum     buffer_memory_type;             // memory type of camera/output/overlay buffers (VX_MEMORY_TYPE_OPENCL/HOST)
+	// camera/output buffer rings swapped in at lsScheduleFrame
+	vx_uint32   camera_buffer_ring_size, output_buffer_ring_size;
+	vx_uint32   camera_buffer_ring_index, output_buffer_ring_index;  // index of buffer used by the next lsScheduleFrame
+	void      * camera_buffer_ring[LIVE_STITCH_MAX_BUFFER_RING_SIZE];
+	void      * output_buffer_ring[LIVE_STITCH_MAX_BUFFER_RING_SIZE];
+	bool        camera_buffer_set, output_buffer_set;                // buffer set by lsSet{Camera|Output}Buffer[Host] (can't be mixed with a ring)
 	// global options
 	vx_uint32  EXPO_COMP, SEAM_FIND;			// exposure comp/ seam find flags from environment variable
 	vx_uint32  SEAM_COST_SELECT;				// seam find cost generation flag from environment variable
@@ -123,12 +134,15 @@ struct ls_context_t {
 	// global OpenVX objects
 	vx_context context;                         // OpenVX context
 	vx_graph graphStitch;                       // OpenVX graph for stitching
+	vx_graph graphExpcompCalc, graphExpcompSolve; // exposure comp gain update graphs: only processed on due frames of expcomp_interval > 1
+	vx_graph graphSeamfind;                       // seam find graph: only processed on frames where the seam of any overlap is due
 	// internal buffer sizes
 	ls_internal_table_size_info table_sizes;    // internal table sizes
 	vx_image rgb_input, rgb_output;
 	// data objects
 	vx_remap overlay_remap;                     // remap table for overlay
-	vx_remap camera_remap;                      // remap table for camera (in simple stitch mode)
+	vx_remap camera_remap;                      // remap table for camera (in simple stitch mode, large camera buffers)
+	vx_array SimpleRemapEntry;                  // compact remap table for camera (in simple stitch mode)
 	vx_image Img_input, Img_output, Img_overlay;
 	vx_image Img_input_rgb, Img_output_rgb, Img_overlay_rgb, Img_overlay_rgba;
 	vx_node InputColorConvertNode, SimpleStitchRemapNode, OutputColorConvertNode;
@@ -139,7 +153,13 @@ struct ls_context_t {
 	vx_node WarpNode, ExpcompComputeGainNode, ExpcompSolveGainNode, ExpcompApplyGainNode, MergeNode;
 	vx_node nodeOverlayRemap, nodeOverlayBlend;
 	vx_float32 alpha, beta;                     // needed for expcomp
-	vx_int32 * A_matrix_initial_value;          // needed for expcomp
+	vx_int32 * A_matrix_initial_value;          // needed for expcomp (A_matrix accumulates from ZERO across frames)
+	vx_uint32 expcomp_interval, expcomp_stagger; // needed for expcomp gain update schedule
+	vx_uint32 expcomp_sample_stride;            // needed for expcomp subsampling of overlap statistics
+	vx_uint32 expcomp_gain_channels;            // needed for expcomp per-channel gains: 1 - luma gain, 3 - R, G, B gains
+	vx_float32 expcomp_smoothing;               // needed for expcomp temporal smoothing of gains
+	vx_scalar expcomp_frame;                    // expcomp frame counter (only used when expcomp_interval > 1)
+	vx_uint32 expcomp_frame_value;
 	//Stitch SEAMFIND DATA OBJECTS
 	vx_array overlap_rect_array, seamfind_valid_array, seamfind_weight_array, seamfind_accum_array, seamfind_pref_array, seamfind_info_array, seamfind_path_array, seamfind_scene_array;
 	vx_image valid_mask_image, warp_luma_image, sobelx_image, sobely_image, sobel_magnitude_s16_image, sobel_magnitude_image, sobel_phase_image, seamfind_weight_image;
@@ -177,6 +197,9 @@ struct ls_context_t {
 	vx_uint8 * overlayIndexBuf;
 	// attributes
 	vx_float32 live_stitch_attr[LIVE_STITCH_ATTR_MAX_COUNT];
+	// initialization timing
+	vx_uint64 init_start_clock, init_phase_clock;
+	vx_float32 init_phase_time[LIVE_STITCH_INIT_PHASE_MAX_COUNT]; // milliseconds spent in each phase of last lsInitialize/lsReinitialize
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -319,6 +342,8 @@ static void ResetLiveStitchGlobalAttributes()
 		g_live_stitch_attr_initialized = true;
 		memset(g_live_stitch_attr, 0, sizeof(g_live_stitch_attr));
 		g_live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP] = 1;
+		g_live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_INTERVAL] = 1;
+		g_live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE] = 1;
 		g_live_stitch_attr[LIVE_STITCH_ATTR_SEAMFIND] = 1;
 		g_live_stitch_attr[LIVE_STITCH_ATTR_SEAM_COST_SELECT] = 1;
 		g_live_stitch_attr[LIVE_STITCH_ATTR_SEAM_REFRESH] = 1;
@@ -362,6 +387,26 @@ static vx_status IsValidContextAndNotInitialized(ls_context stitch)
 	if (stitch->initialized) return VX_ERROR_NOT_SUPPORTED;
 	return VX_SUCCESS;
 }
+static vx_uint64 GetClockInNanoseconds()
+{
+	return (vx_uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static void StartInitTiming(ls_context stitch)
+{
+	memset(stitch->init_phase_time, 0, sizeof(stitch->init_phase_time));
+	stitch->init_start_clock = stitch->init_phase_clock = GetClockInNanoseconds();
+}
+static void MarkInitPhase(ls_context stitch, vx_uint32 phase)
+{
+	// add time elapsed since the previous mark to the phase
+	vx_uint64 clock = GetClockInNanoseconds();
+	stitch->init_phase_time[phase] += (vx_float32)((clock - stitch->init_phase_clock) * 1e-6);
+	stitch->init_phase_clock = clock;
+}
+static void EndInitTiming(ls_context stitch)
+{
+	stitch->init_phase_time[LIVE_STITCH_INIT_PHASE_TOTAL] = (vx_float32)((GetClockInNanoseconds() - stitch->init_start_clock) * 1e-6);
+}
 static const char * GetFileNameSuffix(ls_context stitch, vx_reference ref, bool& isIntermediateTmpData)
 {
 	struct {
@@ -393,6 +438,7 @@ static const char * GetFileNameSuffix(ls_context stitch, vx_reference ref, bool&
 		{ (vx_reference)stitch->blend_mask_image,      false, "blend-mask.raw" },
 		{ (vx_reference)stitch->blend_offsets,         false, "blend-offsets.bin" },
 		{ (vx_reference)stitch->camera_remap,          false, "remap-input.raw" },
+		{ (vx_reference)stitch->SimpleRemapEntry,      false, "remap-table.bin" },
 		{ (vx_reference)stitch->overlay_remap,         false, "remap-overlay.raw" },
 		// intermediate temporary data
 		{ (vx_reference)stitch->rgb_input,             true,  "rgb-input.raw" },
@@ -434,6 +480,7 @@ static vx_status DumpInternalTables(ls_context stitch, const char * fileNamePref
 		(vx_reference)stitch->blend_mask_image,
 		(vx_reference)stitch->blend_offsets,
 		(vx_reference)stitch->camera_remap,
+		(vx_reference)stitch->SimpleRemapEntry,
 		(vx_reference)stitch->overlay_remap,
 		// intermediate temporary data
 		(vx_reference)stitch->rgb_input,
@@ -501,6 +548,7 @@ static vx_status SyncInternalTables(ls_context stitch)
 		(vx_reference)stitch->RGBY2,
 		(vx_reference)stitch->overlay_remap,
 		(vx_reference)stitch->camera_remap,
+		(vx_reference)stitch->SimpleRemapEntry,
 	};
 	for (vx_size i = 0; i < dimof(refList); i++) {
 		if (refList[i]) {
@@ -584,6 +632,33 @@ static vx_status InitializeInternalTablesForRemap(vx_remap remap,
 
 	return VX_SUCCESS;
 }
+static vx_status InitializeInternalTablesForSimpleRemap(vx_array table,
+	vx_uint32 numCamera, vx_uint32 numCameraColumns, vx_uint32 camWidth, vx_uint32 camHeight, vx_uint32 eqrWidth, vx_uint32 eqrHeight,
+	const rig_params * rig_par, const camera_params * cam_par,
+	StitchCoord2dFloat * srcMap, vx_uint32 * validPixelMap, vx_float32 * camIndexTmpBuf, vx_uint8 * camIndexBuf)
+{
+	// compute lens distortion and warp models
+	vx_status status = CalculateLensDistortionAndWarpMaps(numCamera, camWidth, camHeight, eqrWidth, eqrHeight,
+		rig_par, cam_par, validPixelMap, 0, nullptr, srcMap, camIndexTmpBuf, camIndexBuf);
+	if (status != VX_SUCCESS) {
+		vxAddLogEntry((vx_reference)table, status, "ERROR: InitializeInternalTablesForSimpleRemap: CalculateLensDistortionAndWarpMaps() failed (%d)\n", status);
+		return status;
+	}
+
+	{ // initialize remap table: the array already holds one entry for every output pixel
+		StitchSimpleRemapEntry * remapBuf = nullptr;
+		vx_size stride = 0; vx_map_id map_id = 0;
+		ERROR_CHECK_STATUS_(vxMapArrayRange(table, 0, eqrWidth * eqrHeight, &map_id, &stride, (void **)&remapBuf, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0));
+		status = GenerateSimpleRemapBuffer(numCamera, numCameraColumns, camWidth, camHeight, eqrWidth, eqrHeight, srcMap, camIndexBuf, remapBuf);
+		ERROR_CHECK_STATUS_(vxUnmapArrayRange(table, map_id));
+		if (status != VX_SUCCESS) {
+			ls_printf("ERROR: InitializeInternalTablesForSimpleRemap: GenerateSimpleRemapBuffer() failed (%d)\n", status);
+			return status;
+		}
+	}
+
+	return VX_SUCCESS;
+}
 static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 {
 	vx_uint32 numCamera = stitch->num_cameras;
@@ -612,6 +687,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 			vxAddLogEntry((vx_reference)stitch->context, status, "ERROR: AllocateInternalTablesForCamera: CalculateLensDistortionAndWarpMaps() failed (%d)\n", status);
 			return status;
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_LENS_MAPPING);
 		stitch->overlapCount = CalculateValidOverlapRegions(stitch->num_cameras,
 			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
 			stitch->validPixelCamMap, stitch->overlapValid, stitch->validCamOverlapInfo,
@@ -620,6 +696,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 			vxAddLogEntry((vx_reference)stitch->context, status, "ERROR: AllocateInternalTablesForCamera: number of overlaps (%d) greater than 6 not supported\n", stitch->overlapCount);
 			return VX_ERROR_NOT_SUPPORTED;
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_OVERLAP_DETECT);
 	}
 
 	{ // initialize warp tables
@@ -652,6 +729,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 		}
 		ERROR_CHECK_STATUS_(vxTruncateArray(stitch->ValidPixelEntry, warpEntryCount));
 		ERROR_CHECK_STATUS_(vxTruncateArray(stitch->WarpRemapEntry, warpEntryCount));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_WARP_TABLES);
 	}
 
 	{ // initialize merge tables
@@ -682,6 +760,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 		ERROR_CHECK_STATUS_(vxMapImagePatch(stitch->weight_image, &rectMask, 0, &map_id_mask, &addrMask, (void **)&ptr_mask, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
 		GenerateDefaultMergeMaskImage(numCamera, eqrWidth, eqrHeight, camIndexBuf, addrMask.stride_y, ptr_mask);
 		ERROR_CHECK_STATUS_(vxUnmapImagePatch(stitch->weight_image, map_id_mask));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_MERGE_TABLES);
 	}
 
 	if (stitch->EXPO_COMP)
@@ -722,6 +801,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 		ERROR_CHECK_STATUS_(vxTruncateArray(stitch->valid_array, validEntryCount));
 		ERROR_CHECK_STATUS_(vxTruncateArray(stitch->OverlapPixelEntry, overlapEntryCount));
 		ERROR_CHECK_STATUS_(vxWriteMatrix(stitch->overlap_matrix, stitch->overlapMatrixBuf));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_EXPCOMP_TABLES);
 	}
 
 	if (stitch->SEAM_FIND)
@@ -820,6 +900,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 		ERROR_CHECK_STATUS_(vxMapImagePatch(stitch->seamfind_weight_image, &rectMask, 0, &map_id_mask, &addrMask, (void **)&ptr_mask, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
 		GenerateDefaultMergeMaskImage(numCamera, eqrWidth, eqrHeight, camIndexBuf, addrMask.stride_y, ptr_mask);
 		ERROR_CHECK_STATUS_(vxUnmapImagePatch(stitch->seamfind_weight_image, map_id_mask));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_SEAMFIND_TABLES);
 	}
 
 	if (stitch->MULTIBAND_BLEND)
@@ -838,6 +919,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 			ls_printf("ERROR: InitializeInternalTablesForCamera: GenerateBlendBuffers() failed (%d)\n", status);
 			return status;
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_BLEND_TABLES);
 	}
 
 	if (stitch->valid_mask_image)
@@ -878,6 +960,7 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 			ERROR_CHECK_STATUS_(vxUnmapImagePatch(stitch->RGBY2, map_id));
 		}
 	}
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_MASK_IMAGES);
 
 	return VX_SUCCESS;
 }
@@ -906,6 +989,7 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 			vxAddLogEntry((vx_reference)stitch->context, status, "ERROR: AllocateInternalTablesForCamera: CalculateLensDistortionAndWarpMaps() failed (%d)\n", status);
 			return status;
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_LENS_MAPPING);
 		stitch->overlapCount = CalculateValidOverlapRegions(stitch->num_cameras,
 			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
 			stitch->validPixelCamMap, stitch->overlapValid, stitch->validCamOverlapInfo,
@@ -957,6 +1041,7 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 				stitch->multibandBlendOffsetIntoBuffer, &stitch->table_sizes.blendOffsetTableSize);
 		}
 	}
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_OVERLAP_DETECT);
 
 	// disable features if can't be supported with buffer sizes
 	if (stitch->EXPO_COMP) {
@@ -1007,12 +1092,21 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 		ERROR_CHECK_OBJECT_(stitch->OverlapPixelEntry = vxCreateArray(stitch->context, StitchOverlapPixelEntryType, stitch->table_sizes.expCompOverlapTableSize));
 		ERROR_CHECK_OBJECT_(stitch->overlap_matrix = vxCreateMatrix(stitch->context, VX_TYPE_INT32, stitch->num_cameras, stitch->num_cameras));
 		ERROR_CHECK_OBJECT_(stitch->RGBY2 = vxCreateImage(stitch->context, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_RGBX));
-		ERROR_CHECK_OBJECT_(stitch->A_matrix = vxCreateMatrix(stitch->context, VX_TYPE_INT32, stitch->num_cameras, stitch->num_cameras));
-		ERROR_CHECK_OBJECT_(stitch->gain_array = vxCreateArray(stitch->context, VX_TYPE_FLOAT32, stitch->num_cameras));
-		ERROR_CHECK_ALLOC_(stitch->A_matrix_initial_value = new vx_int32[stitch->num_cameras * stitch->num_cameras]());
+		// with per-channel gains, A_matrix has a num_cameras x num_cameras block for each of R, G, B
+		// and gain_array has the R gains of all cameras, followed by G and B gains
+		ERROR_CHECK_OBJECT_(stitch->A_matrix = vxCreateMatrix(stitch->context, VX_TYPE_INT32, stitch->num_cameras, stitch->num_cameras * stitch->expcomp_gain_channels));
+		ERROR_CHECK_OBJECT_(stitch->gain_array = vxCreateArray(stitch->context, VX_TYPE_FLOAT32, stitch->num_cameras * stitch->expcomp_gain_channels));
+		ERROR_CHECK_ALLOC_(stitch->A_matrix_initial_value = new vx_int32[stitch->num_cameras * stitch->num_cameras * stitch->expcomp_gain_channels]());
 		ERROR_CHECK_STATUS_(vxWriteMatrix(stitch->A_matrix, stitch->A_matrix_initial_value));
+		// unit gains until the first solve (with an update interval, frames before the first solve apply these)
+		std::vector<vx_float32> unit_gains(stitch->num_cameras * stitch->expcomp_gain_channels, 1.0f);
+		ERROR_CHECK_STATUS_(vxAddArrayItems(stitch->gain_array, unit_gains.size(), unit_gains.data(), sizeof(vx_float32)));
 		stitch->alpha = 0.01f;
 		stitch->beta = 100.0f;
+		if (stitch->expcomp_interval > 1) {
+			stitch->expcomp_frame_value = 0;
+			ERROR_CHECK_OBJECT_(stitch->expcomp_frame = vxCreateScalar(stitch->context, VX_TYPE_UINT32, &stitch->expcomp_frame_value));
+		}
 	}
 	// create data objects needed by seamfind kernel
 	if (stitch->SEAM_FIND) {
@@ -1031,14 +1125,20 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 		ERROR_CHECK_OBJECT_(stitch->seamfind_pref_array = vxCreateArray(stitch->context, StitchSeamFindPreferenceType, stitch->table_sizes.seamFindPrefInfoTableSize));
 		ERROR_CHECK_OBJECT_(stitch->seamfind_info_array = vxCreateArray(stitch->context, StitchSeamFindInformationType, stitch->table_sizes.seamFindPrefInfoTableSize));
 		ERROR_CHECK_OBJECT_(stitch->seamfind_path_array = vxCreateArray(stitch->context, StitchSeamFindPathEntryType, stitch->table_sizes.seamFindPathTableSize));
-		ERROR_CHECK_OBJECT_(stitch->warp_luma_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
+		// the seam find nodes after scene detect run in graphSeamfind, only on frames where a seam is due:
+		// warp luma is passed from graphStitch, and the gradient images are virtual in graphSeamfind
+		ERROR_CHECK_OBJECT_(stitch->graphSeamfind = vxCreateGraph(stitch->context));
+		if (stitch->live_stitch_attr[LIVE_STITCH_ATTR_PROFILER] == 2.0f) {
+			ERROR_CHECK_STATUS_(vxDirective((vx_reference)stitch->graphSeamfind, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+		}
+		ERROR_CHECK_OBJECT_(stitch->warp_luma_image = vxCreateImage(stitch->context, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
 		if (!stitch->SEAM_COST_SELECT) {
-			ERROR_CHECK_OBJECT_(stitch->sobelx_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
-			ERROR_CHECK_OBJECT_(stitch->sobely_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
-			ERROR_CHECK_OBJECT_(stitch->sobel_magnitude_s16_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
+			ERROR_CHECK_OBJECT_(stitch->sobelx_image = vxCreateVirtualImage(stitch->graphSeamfind, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
+			ERROR_CHECK_OBJECT_(stitch->sobely_image = vxCreateVirtualImage(stitch->graphSeamfind, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
+			ERROR_CHECK_OBJECT_(stitch->sobel_magnitude_s16_image = vxCreateVirtualImage(stitch->graphSeamfind, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_S16));
 		}
-		ERROR_CHECK_OBJECT_(stitch->sobel_magnitude_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
-		ERROR_CHECK_OBJECT_(stitch->sobel_phase_image = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
+		ERROR_CHECK_OBJECT_(stitch->sobel_magnitude_image = vxCreateVirtualImage(stitch->graphSeamfind, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
+		ERROR_CHECK_OBJECT_(stitch->sobel_phase_image = vxCreateVirtualImage(stitch->graphSeamfind, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
 		ERROR_CHECK_OBJECT_(stitch->seamfind_weight_image = vxCreateImage(stitch->context, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
 		ERROR_CHECK_OBJECT_(stitch->current_frame = vxCreateScalar(stitch->context, VX_TYPE_UINT32, &stitch->current_frame_value));
 		if (stitch->SEAM_REFRESH) {
@@ -1047,10 +1147,9 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 			ERROR_CHECK_OBJECT_(stitch->seamfind_scene_array = vxCreateArray(stitch->context, StitchSeamSceneType, stitch->table_sizes.seamFindPrefInfoTableSize));
 			ERROR_CHECK_OBJECT_(stitch->scene_threshold = vxCreateScalar(stitch->context, VX_TYPE_UINT32, &stitch->scene_threshold_value));
 		}
-		if (stitch->SEAM_COST_SELECT) {
-			vx_uint32 cost_enable = 1;
-			ERROR_CHECK_OBJECT_(stitch->seam_cost_enable = vxCreateScalar(stitch->context, VX_TYPE_UINT32, &cost_enable));
-		}
+		// execute flag of the seam find kernels: always set, since graphSeamfind is only processed on due frames
+		vx_uint32 cost_enable = 1;
+		ERROR_CHECK_OBJECT_(stitch->seam_cost_enable = vxCreateScalar(stitch->context, VX_TYPE_UINT32, &cost_enable));
 	}
 	// create data objects needed by multiband blend
 	if (stitch->MULTIBAND_BLEND) {
@@ -1078,6 +1177,7 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 	if (stitch->SEAM_FIND || stitch->EXPO_COMP) {
 		ERROR_CHECK_OBJECT_(stitch->valid_mask_image = vxCreateImage(stitch->context, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras, VX_DF_IMAGE_U8));
 	}
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_CREATION);
 
 	// initialize internal tables
 	vx_status status = InitializeInternalTablesForCamera(stitch);
@@ -1485,6 +1585,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetViewingModule(ls_context stitch
 LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 {
 	ERROR_CHECK_STATUS_(IsValidContextAndNotInitialized(stitch));
+	StartInitTiming(stitch);
 
 	/////////////////////////////////////////////////////////
 	// pick default stitch mode and aux data length
@@ -1493,6 +1594,9 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		stitch->stitching_mode = stitching_mode_quick_and_dirty;
 	if (stitch->live_stitch_attr[LIVE_STITCH_ATTR_ENABLE_REINITIALIZE] == 1.0f)
 		stitch->feature_enable_reinitialize = true;
+	stitch->buffer_memory_type = VX_MEMORY_TYPE_OPENCL;
+	if (stitch->live_stitch_attr[LIVE_STITCH_ATTR_HOST_BUFFERS] == 1.0f)
+		stitch->buffer_memory_type = VX_MEMORY_TYPE_HOST;
 	stitch->loomioAuxDataLength = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_IO_AUX_DATA_CAPACITY];
 	if (stitch->loomioAuxDataLength < (float)LOOMIO_MIN_AUX_DATA_CAPACITY ||
 		stitch->loomioAuxDataLength > (float)LOOMIO_MAX_AUX_DATA_CAPACITY ||
@@ -1540,7 +1644,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		ERROR_CHECK_OBJECT_(stitch->nodeLoomIoCamera = stitchCreateNode(stitch->graphStitch, stitch->loomio_camera.kernelName, params, dimof(params)));
 	}
 	else {
-		// need image created from OpenCL handle
+		// need image created from OpenCL or host handle
 		vx_imagepatch_addressing_t addr_in = { 0 };
 		void *ptr[1] = { nullptr };
 		addr_in.dim_x = stitch->camera_buffer_width;
@@ -1548,7 +1652,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		addr_in.stride_x = (stitch->camera_buffer_format == VX_DF_IMAGE_RGB) ? 3 : 2;
 		addr_in.stride_y = stitch->camera_buffer_stride_in_bytes;
 		if(addr_in.stride_y == 0) addr_in.stride_y = addr_in.stride_x * addr_in.dim_x;
-		ERROR_CHECK_OBJECT_(stitch->Img_input = vxCreateImageFromHandle(stitch->context, stitch->camera_buffer_format, &addr_in, ptr, VX_MEMORY_TYPE_OPENCL));
+		ERROR_CHECK_OBJECT_(stitch->Img_input = vxCreateImageFromHandle(stitch->context, stitch->camera_buffer_format, &addr_in, ptr, stitch->buffer_memory_type));
 	}
 	if (strlen(stitch->loomio_output.kernelName) > 0) {
 		// load OpenVX module (if specified)
@@ -1577,7 +1681,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		ERROR_CHECK_OBJECT_(stitch->nodeLoomIoOutput = stitchCreateNode(stitch->graphStitch, stitch->loomio_output.kernelName, params, dimof(params)));
 	}
 	else {
-		// need image created from OpenCL handle
+		// need image created from OpenCL or host handle
 		vx_imagepatch_addressing_t addr_out = { 0 };
 		void *ptr[1] = { nullptr };
 		addr_out.dim_x = (vx_uint32)(stitch->output_rgb_scale_factor * stitch->output_buffer_width);
@@ -1585,17 +1689,28 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		addr_out.stride_x = (stitch->output_buffer_format == VX_DF_IMAGE_RGB) ? 3 : 2;
 		addr_out.stride_y = stitch->output_buffer_stride_in_bytes;
 		if (addr_out.stride_y == 0) addr_out.stride_y = addr_out.stride_x * addr_out.dim_x;
-		ERROR_CHECK_OBJECT_(stitch->Img_output = vxCreateImageFromHandle(stitch->context, stitch->output_buffer_format, &addr_out, ptr, VX_MEMORY_TYPE_OPENCL));
+		ERROR_CHECK_OBJECT_(stitch->Img_output = vxCreateImageFromHandle(stitch->context, stitch->output_buffer_format, &addr_out, ptr, stitch->buffer_memory_type));
+	}
+	// packed YUV camera/output buffers at full scale can be converted inside warp and merge:
+	// this removes a full-frame RGB intermediate and a kernel launch on each side of the graph
+	if (stitch->stitching_mode == stitching_mode_normal && stitch->live_stitch_attr[LIVE_STITCH_ATTR_FUSE_COLOR_CONVERT] != 0.0f) {
+		stitch->fuse_input_color_convert =
+			(stitch->camera_buffer_format == VX_DF_IMAGE_UYVY || stitch->camera_buffer_format == VX_DF_IMAGE_YUYV) &&
+			stitch->camera_rgb_scale_factor == 1.0f;
+		stitch->fuse_output_color_convert =
+			(stitch->output_buffer_format == VX_DF_IMAGE_UYVY || stitch->output_buffer_format == VX_DF_IMAGE_YUYV) &&
+			stitch->output_rgb_scale_factor == 1.0f && stitch->num_overlays == 0 && strlen(stitch->loomio_viewing.kernelName) == 0;
 	}
 	// create temporary images when extra color conversion is needed
-	if (stitch->camera_buffer_format != VX_DF_IMAGE_RGB) {
+	if (stitch->camera_buffer_format != VX_DF_IMAGE_RGB && !stitch->fuse_input_color_convert) {
 		ERROR_CHECK_OBJECT_(stitch->Img_input_rgb = vxCreateVirtualImage(stitch->graphStitch, stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height, VX_DF_IMAGE_RGB));
 	}
-	if (stitch->output_buffer_format != VX_DF_IMAGE_RGB) {
+	if (stitch->output_buffer_format != VX_DF_IMAGE_RGB && !stitch->fuse_output_color_convert) {
 		vx_uint32 output_img_width = (vx_uint32)(stitch->output_rgb_scale_factor * stitch->output_buffer_width);
 		vx_uint32 output_img_height = (vx_uint32)(stitch->output_rgb_scale_factor * stitch->output_buffer_height);
 		ERROR_CHECK_OBJECT_(stitch->Img_output_rgb = vxCreateVirtualImage(stitch->graphStitch, output_img_width, output_img_height, VX_DF_IMAGE_RGB));
 	}
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_SETUP);
 
 	if (stitch->num_overlays > 0) {
 		// create overlay image
@@ -1620,7 +1735,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 			ERROR_CHECK_OBJECT_(stitch->nodeLoomIoOverlay = stitchCreateNode(stitch->graphStitch, stitch->loomio_overlay.kernelName, params, dimof(params)));
 		}
 		else {
-			// need image created from OpenCL handle
+			// need image created from OpenCL or host handle
 			vx_imagepatch_addressing_t addr_overlay = { 0 };
 			void *ptr_overlay[1] = { nullptr };
 			addr_overlay.dim_x = stitch->overlay_buffer_width;
@@ -1628,12 +1743,13 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 			addr_overlay.stride_x = 4;
 			addr_overlay.stride_y = stitch->overlay_buffer_stride_in_bytes;
 			if (addr_overlay.stride_y == 0) addr_overlay.stride_y = addr_overlay.stride_x * addr_overlay.dim_x;
-			ERROR_CHECK_OBJECT_(stitch->Img_overlay = vxCreateImageFromHandle(stitch->context, VX_DF_IMAGE_RGBX, &addr_overlay, ptr_overlay, VX_MEMORY_TYPE_OPENCL));
+			ERROR_CHECK_OBJECT_(stitch->Img_overlay = vxCreateImageFromHandle(stitch->context, VX_DF_IMAGE_RGBX, &addr_overlay, ptr_overlay, stitch->buffer_memory_type));
 		}
 		// create remap table object and image for overlay warp
 		ERROR_CHECK_OBJECT_(stitch->overlay_remap = vxCreateRemap(stitch->context, stitch->overlay_buffer_width, stitch->overlay_buffer_height, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height));
 		ERROR_CHECK_OBJECT_(stitch->Img_overlay_rgb = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height, VX_DF_IMAGE_RGB));
 		ERROR_CHECK_OBJECT_(stitch->Img_overlay_rgba = vxCreateVirtualImage(stitch->graphStitch, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height, VX_DF_IMAGE_RGBX));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_CREATION);
 		// initialize remap using lens model
 		ERROR_CHECK_STATUS_(AllocateLensModelBuffersForOverlay(stitch));
 		ERROR_CHECK_STATUS_(InitializeInternalTablesForRemap(stitch->overlay_remap, 
@@ -1649,19 +1765,20 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 			if (stitch->overlayIndexTmpBuf) { delete[] stitch->overlayIndexTmpBuf; stitch->overlayIndexTmpBuf = nullptr; }
 			if (stitch->overlayIndexBuf) { delete[] stitch->overlayIndexBuf; stitch->overlayIndexBuf = nullptr; }
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_REMAP_TABLES);
 	}
 
 	////////////////////////////////////////////////////////////////////////
 	// build the input and output processing parts of stitch graph
 	stitch->rgb_input = stitch->Img_input;
-	if (stitch->camera_buffer_format != VX_DF_IMAGE_RGB) {
+	if (stitch->camera_buffer_format != VX_DF_IMAGE_RGB && !stitch->fuse_input_color_convert) {
 		// needs input color conversion
 		stitch->InputColorConvertNode = stitchColorConvertNode(stitch->graphStitch, stitch->rgb_input, stitch->Img_input_rgb);
 		ERROR_CHECK_OBJECT_(stitch->InputColorConvertNode);
 		stitch->rgb_input = stitch->Img_input_rgb;
 	}
 	stitch->rgb_output = stitch->Img_output;
-	if (stitch->output_buffer_format != VX_DF_IMAGE_RGB) {
+	if (stitch->output_buffer_format != VX_DF_IMAGE_RGB && !stitch->fuse_output_color_convert) {
 		// needs output color conversion
 		stitch->OutputColorConvertNode = stitchColorConvertNode(stitch->graphStitch, stitch->Img_output_rgb, stitch->rgb_output);
 		ERROR_CHECK_OBJECT_(stitch->OutputColorConvertNode);
@@ -1694,36 +1811,65 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		};
 		ERROR_CHECK_OBJECT_(stitch->nodeLoomIoViewing = stitchCreateNode(stitch->graphStitch, stitch->loomio_viewing.kernelName, params, dimof(params)));
 	}
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_CREATION);
 
 	/***********************************************************************************************************************************
 	Quick Stitch mode -> Simple stitch
 	************************************************************************************************************************************/
 	if (stitch->stitching_mode == stitching_mode_quick_and_dirty)
 	{
-		// create remap table object
-		ERROR_CHECK_OBJECT_(stitch->camera_remap = vxCreateRemap(stitch->context, stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height));
-		// initialize remap using lens model
 		ERROR_CHECK_STATUS_(AllocateLensModelBuffersForCamera(stitch));
-		ERROR_CHECK_STATUS_(InitializeInternalTablesForRemap(stitch->camera_remap,
-			stitch->num_cameras, stitch->num_camera_columns,
-			stitch->camera_buffer_width / stitch->num_camera_columns,
-			stitch->camera_buffer_height / stitch->num_camera_rows,
-			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
-			&stitch->rig_par, stitch->camera_par, stitch->camSrcMap, stitch->validPixelCamMap,
-			stitch->camIndexTmpBuf, stitch->camIndexBuf));
+		if (stitch->camera_rgb_buffer_width <= STITCH_SIMPLE_REMAP_MAX_BUFFER_DIM && stitch->camera_rgb_buffer_height <= STITCH_SIMPLE_REMAP_MAX_BUFFER_DIM) {
+			// create compact remap table with one Q13.3 entry per output pixel
+			vx_size tableSize = (vx_size)stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height;
+			StitchSimpleRemapEntry invalidEntry = { 0xffff, 0xffff };
+			vx_enum StitchSimpleRemapEntryType;
+			ERROR_CHECK_TYPE_(StitchSimpleRemapEntryType = vxRegisterUserStruct(stitch->context, sizeof(StitchSimpleRemapEntry)));
+			ERROR_CHECK_OBJECT_(stitch->SimpleRemapEntry = vxCreateArray(stitch->context, StitchSimpleRemapEntryType, tableSize));
+			ERROR_CHECK_STATUS_(vxAddArrayItems(stitch->SimpleRemapEntry, tableSize, &invalidEntry, 0));
+			// initialize remap table using lens model
+			ERROR_CHECK_STATUS_(InitializeInternalTablesForSimpleRemap(stitch->SimpleRemapEntry,
+				stitch->num_cameras, stitch->num_camera_columns,
+				stitch->camera_buffer_width / stitch->num_camera_columns,
+				stitch->camera_buffer_height / stitch->num_camera_rows,
+				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+				&stitch->rig_par, stitch->camera_par, stitch->camSrcMap, stitch->validPixelCamMap,
+				stitch->camIndexTmpBuf, stitch->camIndexBuf));
+		}
+		else {
+			// camera buffer is too large for Q13.3 coordinates: create remap table object
+			ERROR_CHECK_OBJECT_(stitch->camera_remap = vxCreateRemap(stitch->context, stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height));
+			// initialize remap using lens model
+			ERROR_CHECK_STATUS_(InitializeInternalTablesForRemap(stitch->camera_remap,
+				stitch->num_cameras, stitch->num_camera_columns,
+				stitch->camera_buffer_width / stitch->num_camera_columns,
+				stitch->camera_buffer_height / stitch->num_camera_rows,
+				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+				&stitch->rig_par, stitch->camera_par, stitch->camSrcMap, stitch->validPixelCamMap,
+				stitch->camIndexTmpBuf, stitch->camIndexBuf));
+		}
 		if (!stitch->feature_enable_reinitialize) {
 			if (stitch->camSrcMap) { delete[] stitch->camSrcMap; stitch->camSrcMap = nullptr; }
 			if (stitch->validPixelCamMap) { delete[] stitch->validPixelCamMap; stitch->validPixelCamMap = nullptr; }
 			if (stitch->camIndexTmpBuf) { delete[] stitch->camIndexTmpBuf; stitch->camIndexTmpBuf = nullptr; }
 			if (stitch->camIndexBuf) { delete[] stitch->camIndexBuf; stitch->camIndexBuf = nullptr; }
 		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_REMAP_TABLES);
 
 		////////////////////////////////////////////////////////////////////////
 		// create and verify graphStitch using simple remap kernel
 		////////////////////////////////////////////////////////////////////////
-		ERROR_CHECK_OBJECT_(stitch->SimpleStitchRemapNode = vxRemapNode(stitch->graphStitch, stitch->rgb_input, stitch->camera_remap, VX_INTERPOLATION_TYPE_BILINEAR, stitch->rgb_output));
+		if (stitch->SimpleRemapEntry) {
+			ERROR_CHECK_OBJECT_(stitch->SimpleStitchRemapNode = stitchSimpleRemapNode(stitch->graphStitch, stitch->rgb_input, stitch->SimpleRemapEntry, stitch->rgb_output));
+		}
+		else {
+			ERROR_CHECK_OBJECT_(stitch->SimpleStitchRemapNode = vxRemapNode(stitch->graphStitch, stitch->rgb_input, stitch->camera_remap, VX_INTERPOLATION_TYPE_BILINEAR, stitch->rgb_output));
+		}
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_CREATION);
 		ERROR_CHECK_STATUS_(vxVerifyGraph(stitch->graphStitch));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_VERIFY);
 		ERROR_CHECK_STATUS_(SyncInternalTables(stitch));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_SYNC_TABLES);
 	}
 	/***********************************************************************************************************************************
 	Normal Stitch mode -> Color Convert, Warp, Expo Comp & Merge
@@ -1735,6 +1881,19 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		////////////////////////////////////////////////////////////////////////
 		if (stitch->num_cameras > 1) {
 			stitch->EXPO_COMP = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP];
+			stitch->expcomp_interval = std::max((vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_INTERVAL], 1u);
+			stitch->expcomp_stagger = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_STAGGER];
+			stitch->expcomp_smoothing = stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_SMOOTHING];
+			if (stitch->expcomp_smoothing < 0.0f || stitch->expcomp_smoothing >= 1.0f) {
+				ls_printf("WARNING: lsInitialize: LIVE_STITCH_ATTR_EXPCOMP_SMOOTHING should be in range [0..1): disabled smoothing\n");
+				stitch->expcomp_smoothing = 0.0f;
+			}
+			stitch->expcomp_sample_stride = std::max((vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE], 1u);
+			if (stitch->expcomp_sample_stride > 16) {
+				ls_printf("WARNING: lsInitialize: LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE should be in range [1..16]: using 16\n");
+				stitch->expcomp_sample_stride = 16;
+			}
+			stitch->expcomp_gain_channels = stitch->live_stitch_attr[LIVE_STITCH_ATTR_EXPCOMP_RGB_GAINS] ? 3 : 1;
 			stitch->SEAM_FIND = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_SEAMFIND];
 			stitch->SEAM_REFRESH = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_SEAM_REFRESH];
 			stitch->SEAM_COST_SELECT = (vx_uint32)stitch->live_stitch_attr[LIVE_STITCH_ATTR_SEAM_COST_SELECT];
@@ -1767,9 +1926,22 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		vx_image merge_input = stitch->RGBY1;
 		vx_image merge_weight = stitch->weight_image;
 		if (stitch->EXPO_COMP) {
-			ERROR_CHECK_OBJECT_(stitch->ExpcompComputeGainNode = stitchExposureCompCalcErrorFnNode(stitch->graphStitch, stitch->num_cameras, stitch->RGBY1, stitch->OverlapPixelEntry, stitch->valid_mask_image, stitch->A_matrix));
-			ERROR_CHECK_OBJECT_(stitch->ExpcompSolveGainNode = stitchExposureCompSolveForGainNode(stitch->graphStitch, stitch->alpha, stitch->beta, stitch->A_matrix, stitch->overlap_matrix, stitch->gain_array));
-			ERROR_CHECK_OBJECT_(stitch->ExpcompApplyGainNode = stitchExposureCompApplyGainNode(stitch->graphStitch, stitch->RGBY1, stitch->gain_array, stitch->valid_array, stitch->RGBY2));
+			// with an update interval, gain updates run in their own graphs after graphStitch on due frames only
+			vx_graph graphCalc = stitch->graphStitch, graphSolve = stitch->graphStitch;
+			if (stitch->expcomp_interval > 1) {
+				ERROR_CHECK_OBJECT_(graphCalc = stitch->graphExpcompCalc = vxCreateGraph(stitch->context));
+				ERROR_CHECK_OBJECT_(graphSolve = stitch->graphExpcompSolve = vxCreateGraph(stitch->context));
+				if (stitch->live_stitch_attr[LIVE_STITCH_ATTR_PROFILER] == 2.0f) {
+					ERROR_CHECK_STATUS_(vxDirective((vx_reference)stitch->graphExpcompCalc, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+					ERROR_CHECK_STATUS_(vxDirective((vx_reference)stitch->graphExpcompSolve, VX_DIRECTIVE_AMD_ENABLE_PROFILE_CAPTURE));
+				}
+			}
+			ERROR_CHECK_OBJECT_(stitch->ExpcompComputeGainNode = stitchExposureCompCalcErrorFnNode(graphCalc, stitch->num_cameras, stitch->RGBY1, stitch->OverlapPixelEntry, stitch->valid_mask_image, stitch->A_matrix,
+				stitch->expcomp_frame, stitch->expcomp_interval, stitch->expcomp_stagger, stitch->expcomp_sample_stride));
+			ERROR_CHECK_OBJECT_(stitch->ExpcompSolveGainNode = stitchExposureCompSolveForGainNode(graphSolve, stitch->alpha, stitch->beta, stitch->A_matrix, stitch->overlap_matrix, stitch->gain_array,
+				stitch->expcomp_frame, stitch->expcomp_interval, stitch->expcomp_stagger, stitch->expcomp_smoothing));
+			ERROR_CHECK_OBJECT_(stitch->ExpcompApplyGainNode = stitchExposureCompApplyGainNode(stitch->graphStitch, stitch->RGBY1, stitch->gain_array, stitch->valid_array, stitch->RGBY2,
+				stitch->expcomp_gain_channels));
 			// update merge input
 			merge_input = stitch->RGBY2;
 		}
@@ -1781,31 +1953,34 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 					stitch->warp_luma_image, stitch->seamfind_info_array, stitch->seamfind_pref_array, stitch->seamfind_scene_array);
 				ERROR_CHECK_OBJECT_(stitch->SeamfindStep1Node);
 			}
+			// the remaining steps are in graphSeamfind: processed after graphStitch on frames where any seam is due,
+			// so the new weights are used from the next frame
+			vx_graph graphSeam = stitch->graphSeamfind;
 			//SeamFind Step 2 - Cost Generation: 0:OpenVX Sobel 1:Optimized Sobel
 			if (!stitch->SEAM_COST_SELECT) {
 				vx_int32 zero = 0; vx_scalar shift;
 				ERROR_CHECK_OBJECT_(shift = vxCreateScalar(stitch->context, VX_TYPE_INT32, &zero));
-				ERROR_CHECK_OBJECT_(stitch->SobelNode = vxSobel3x3Node(stitch->graphStitch, stitch->warp_luma_image, stitch->sobelx_image, stitch->sobely_image));
-				ERROR_CHECK_OBJECT_(stitch->MagnitudeNode = vxMagnitudeNode(stitch->graphStitch, stitch->sobelx_image, stitch->sobely_image, stitch->sobel_magnitude_s16_image));
-				ERROR_CHECK_OBJECT_(stitch->PhaseNode = vxPhaseNode(stitch->graphStitch, stitch->sobelx_image, stitch->sobely_image, stitch->sobel_phase_image));
-				ERROR_CHECK_OBJECT_(stitch->ConvertDepthNode = vxConvertDepthNode(stitch->graphStitch, stitch->sobel_magnitude_s16_image, stitch->sobel_magnitude_image, VX_CONVERT_POLICY_SATURATE, shift));
+				ERROR_CHECK_OBJECT_(stitch->SobelNode = vxSobel3x3Node(graphSeam, stitch->warp_luma_image, stitch->sobelx_image, stitch->sobely_image));
+				ERROR_CHECK_OBJECT_(stitch->MagnitudeNode = vxMagnitudeNode(graphSeam, stitch->sobelx_image, stitch->sobely_image, stitch->sobel_magnitude_s16_image));
+				ERROR_CHECK_OBJECT_(stitch->PhaseNode = vxPhaseNode(graphSeam, stitch->sobelx_image, stitch->sobely_image, stitch->sobel_phase_image));
+				ERROR_CHECK_OBJECT_(stitch->ConvertDepthNode = vxConvertDepthNode(graphSeam, stitch->sobel_magnitude_s16_image, stitch->sobel_magnitude_image, VX_CONVERT_POLICY_SATURATE, shift));
 				ERROR_CHECK_STATUS_(vxReleaseScalar(&shift));
 			}
 			else {
-				ERROR_CHECK_OBJECT_(stitch->SeamfindStep2Node = stitchSeamFindCostGenerateNode(stitch->graphStitch, stitch->seam_cost_enable, stitch->warp_luma_image, stitch->sobel_magnitude_image, stitch->sobel_phase_image));
+				ERROR_CHECK_OBJECT_(stitch->SeamfindStep2Node = stitchSeamFindCostGenerateNode(graphSeam, stitch->seam_cost_enable, stitch->warp_luma_image, stitch->sobel_magnitude_image, stitch->sobel_phase_image));
 			}
 			//SeamFind Step 3 - Cost Accumulate
-			stitch->SeamfindStep3Node = stitchSeamFindCostAccumulateNode(stitch->graphStitch, stitch->current_frame, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+			stitch->SeamfindStep3Node = stitchSeamFindCostAccumulateNode(graphSeam, stitch->current_frame, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
 				stitch->sobel_magnitude_image, stitch->sobel_phase_image, stitch->valid_mask_image, stitch->seamfind_valid_array, stitch->seamfind_pref_array,
-				stitch->seamfind_info_array, stitch->seamfind_accum_array);
+				stitch->seamfind_info_array, stitch->seamfind_accum_array, stitch->seam_cost_enable);
 			ERROR_CHECK_OBJECT_(stitch->SeamfindStep3Node);
 			//SeamFind Step 4 - Path Trace
-			stitch->SeamfindStep4Node = stitchSeamFindPathTraceNode(stitch->graphStitch, stitch->current_frame, stitch->weight_image, stitch->seamfind_info_array, 
-				stitch->seamfind_accum_array, stitch->seamfind_pref_array, stitch->seamfind_path_array);
+			stitch->SeamfindStep4Node = stitchSeamFindPathTraceNode(graphSeam, stitch->current_frame, stitch->weight_image, stitch->seamfind_info_array, 
+				stitch->seamfind_accum_array, stitch->seamfind_pref_array, stitch->seamfind_path_array, stitch->seam_cost_enable);
 			ERROR_CHECK_OBJECT_(stitch->SeamfindStep4Node);
 			//SeamFind Step 5 - Set Weights
-			stitch->SeamfindStep5Node = stitchSeamFindSetWeightsNode(stitch->graphStitch, stitch->current_frame, stitch->num_cameras, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
-				stitch->seamfind_weight_array, stitch->seamfind_path_array, stitch->seamfind_pref_array, stitch->seamfind_weight_image, stitch->SEAM_FLAGS);
+			stitch->SeamfindStep5Node = stitchSeamFindSetWeightsNode(graphSeam, stitch->current_frame, stitch->num_cameras, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+				stitch->seamfind_weight_array, stitch->seamfind_path_array, stitch->seamfind_pref_array, stitch->seamfind_weight_image, stitch->SEAM_FLAGS, stitch->seam_cost_enable);
 			ERROR_CHECK_OBJECT_(stitch->SeamfindStep5Node);
 			// update merge weight image
 			merge_weight = stitch->seamfind_weight_image;
@@ -1846,9 +2021,15 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		// merge node
 		ERROR_CHECK_OBJECT_(stitch->MergeNode = stitchMergeNode(stitch->graphStitch,
 			stitch->cam_id_image, stitch->group1_image, stitch->group2_image, merge_input, merge_weight, stitch->rgb_output));
-		// verify the graph
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_CREATION);
+		// verify the graphs
 		ERROR_CHECK_STATUS_(vxVerifyGraph(stitch->graphStitch));
+		if (stitch->graphExpcompCalc) ERROR_CHECK_STATUS_(vxVerifyGraph(stitch->graphExpcompCalc));
+		if (stitch->graphExpcompSolve) ERROR_CHECK_STATUS_(vxVerifyGraph(stitch->graphExpcompSolve));
+		if (stitch->graphSeamfind) ERROR_CHECK_STATUS_(vxVerifyGraph(stitch->graphSeamfind));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_GRAPH_VERIFY);
 		ERROR_CHECK_STATUS_(SyncInternalTables(stitch));
+		MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_SYNC_TABLES);
 	}
 	/***********************************************************************************************************************************
 	Other Modes
@@ -1871,6 +2052,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 		}
 	}
 
+	EndInitTiming(stitch);
 	return VX_SUCCESS;
 }
 
@@ -1886,10 +2068,21 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch)
 		ls_printf("ERROR: lsReinitialize has been disabled\n");
 		return VX_ERROR_NOT_SUPPORTED;
 	}
+	StartInitTiming(stitch);
 
 	if (stitch->rig_params_updated || stitch->camera_params_updated) {
 		// re-initialize tables for camera
-		if (stitch->camera_remap) {
+		if (stitch->SimpleRemapEntry) {
+			ERROR_CHECK_STATUS_(InitializeInternalTablesForSimpleRemap(stitch->SimpleRemapEntry,
+				stitch->num_cameras, stitch->num_camera_columns,
+				stitch->camera_buffer_width / stitch->num_camera_columns,
+				stitch->camera_buffer_height / stitch->num_camera_rows,
+				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+				&stitch->rig_par, stitch->camera_par, stitch->camSrcMap, stitch->validPixelCamMap,
+				stitch->camIndexTmpBuf, stitch->camIndexBuf));
+			MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_REMAP_TABLES);
+		}
+		else if (stitch->camera_remap) {
 			ERROR_CHECK_STATUS_(InitializeInternalTablesForRemap(stitch->camera_remap,
 				stitch->num_cameras, stitch->num_camera_columns,
 				stitch->camera_buffer_width / stitch->num_camera_columns,
@@ -1897,6 +2090,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch)
 				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
 				&stitch->rig_par, stitch->camera_par, stitch->camSrcMap, stitch->validPixelCamMap,
 				stitch->camIndexTmpBuf, stitch->camIndexBuf));
+			MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_REMAP_TABLES);
 		}
 		else {
 			ERROR_CHECK_STATUS_(InitializeInternalTablesForCamera(stitch));
@@ -1912,9 +2106,11 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch)
 				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
 				&stitch->rig_par, stitch->overlay_par, stitch->overlaySrcMap, stitch->validPixelOverlayMap,
 				stitch->overlayIndexTmpBuf, stitch->overlayIndexBuf));
+			MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_REMAP_TABLES);
 		}
 	}
 	ERROR_CHECK_STATUS_(SyncInternalTables(stitch));
+	MarkInitPhase(stitch, LIVE_STITCH_INIT_PHASE_SYNC_TABLES);
 
 	// clear flags
 	stitch->reinitialize_required = false;
@@ -1922,6 +2118,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch)
 	stitch->camera_params_updated = false;
 	stitch->overlay_params_updated = false;
 
+	EndInitTiming(stitch);
 	return VX_SUCCESS;
 }
 
@@ -1940,6 +2137,18 @@ SHARED_PUBLIC vx_status VX_API_CALL lsReleaseContext(ls_context * pStitch)
 				ls_printf("> stitch graph profile\n"); char fileName[] = "stdout";
 				ERROR_CHECK_STATUS_(vxQueryGraph(stitch->graphStitch, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, fileName, 0));
 			}
+			if (stitch->graphExpcompCalc) {
+				ls_printf("> exposure comp calc graph profile\n"); char fileName[] = "stdout";
+				ERROR_CHECK_STATUS_(vxQueryGraph(stitch->graphExpcompCalc, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, fileName, 0));
+			}
+			if (stitch->graphExpcompSolve) {
+				ls_printf("> exposure comp solve graph profile\n"); char fileName[] = "stdout";
+				ERROR_CHECK_STATUS_(vxQueryGraph(stitch->graphExpcompSolve, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, fileName, 0));
+			}
+			if (stitch->graphSeamfind) {
+				ls_printf("> seam find graph profile\n"); char fileName[] = "stdout";
+				ERROR_CHECK_STATUS_(vxQueryGraph(stitch->graphSeamfind, VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE, fileName, 0));
+			}
 		}
 		// configuration
 		if (stitch->camera_par) delete[] stitch->camera_par;
@@ -1956,6 +2165,7 @@ SHARED_PUBLIC vx_status VX_API_CALL lsReleaseContext(ls_context * pStitch)
 		//Remap
 		if (stitch->overlay_remap) ERROR_CHECK_STATUS_(vxReleaseRemap(&stitch->overlay_remap));
 		if (stitch->camera_remap) ERROR_CHECK_STATUS_(vxReleaseRemap(&stitch->camera_remap));
+		if (stitch->SimpleRemapEntry) ERROR_CHECK_STATUS_(vxReleaseArray(&stitch->SimpleRemapEntry));
 		//Node
 		if (stitch->InputColorConvertNode) ERROR_CHECK_STATUS_(vxReleaseNode(&stitch->InputColorConvertNode));
 		if (stitch->SimpleStitchRemapNode) ERROR_CHECK_STATUS_(vxReleaseNode(&stitch->SimpleStitchRemapNode));
@@ -1975,6 +2185,8 @@ SHARED_PUBLIC vx_status VX_API_CALL lsReleaseContext(ls_context * pStitch)
 		if (stitch->overlap_matrix) ERROR_CHECK_STATUS_(vxReleaseMatrix(&stitch->overlap_matrix));
 		if (stitch->A_matrix) ERROR_CHECK_STATUS_(vxReleaseMatrix(&stitch->A_matrix));
 		if (stitch->A_matrix_initial_value) delete[] stitch->A_matrix_initial_value;
+		//Scalar
+		if (stitch->expcomp_frame) ERROR_CHECK_STATUS_(vxReleaseScalar(&stitch->expcomp_frame));
 		//Array
 		if (stitch->ValidPixelEntry) ERROR_CHECK_STATUS_(vxReleaseArray(&stitch->ValidPixelEntry));
 		if (stitch->WarpRemapEntry) ERROR_CHECK_STATUS_(vxReleaseArray(&stitch->WarpRemapEntry));
@@ -2058,6 +2270,9 @@ SHARED_PUBLIC vx_status VX_API_CALL lsReleaseContext(ls_context * pStitch)
 
 		//Graph & Context
 		if (stitch->graphStitch) ERROR_CHECK_STATUS_(vxReleaseGraph(&stitch->graphStitch));
+		if (stitch->graphExpcompCalc) ERROR_CHECK_STATUS_(vxReleaseGraph(&stitch->graphExpcompCalc));
+		if (stitch->graphExpcompSolve) ERROR_CHECK_STATUS_(vxReleaseGraph(&stitch->graphExpcompSolve));
+		if (stitch->graphSeamfind) ERROR_CHECK_STATUS_(vxReleaseGraph(&stitch->graphSeamfind));
 		if (stitch->context) ERROR_CHECK_STATUS_(vxReleaseContext(&stitch->context));
 
 		// release internal buffers
@@ -2098,10 +2313,20 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBuffer(ls_context stitch,
 	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
 	// check to make sure that LoomIO for camera is not active
 	if (stitch->nodeLoomIoCamera) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_OPENCL) {
+		ls_printf("ERROR: lsSetCameraBuffer: context uses host buffers, use lsSetCameraBufferHost\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	if (stitch->camera_buffer_ring_size > 0) {
+		ls_printf("ERROR: lsSetCameraBuffer: a camera buffer ring is set, remove it with lsSetCameraBufferRing(count=0) first\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
 
 	// switch the user specified OpenCL buffer into image
 	void * ptr_in[] = { input_buffer ? input_buffer[0] : nullptr };
 	ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_input, ptr_in, nullptr, 1));
+	stitch->camera_buffer_set = (ptr_in[0] != nullptr);
 
 	return VX_SUCCESS;
 }
@@ -2110,10 +2335,20 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBuffer(ls_context stitch,
 	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
 	// check to make sure that LoomIO for output is not active
 	if (stitch->nodeLoomIoOutput) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_OPENCL) {
+		ls_printf("ERROR: lsSetOutputBuffer: context uses host buffers, use lsSetOutputBufferHost\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	if (stitch->output_buffer_ring_size > 0) {
+		ls_printf("ERROR: lsSetOutputBuffer: an output buffer ring is set, remove it with lsSetOutputBufferRing(count=0) first\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
 
 	// switch the user specified OpenCL buffer into image
 	void * ptr_out[] = { output_buffer ? output_buffer [0] : nullptr };
 	ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_output, ptr_out, nullptr, 1));
+	stitch->output_buffer_set = (ptr_out[0] != nullptr);
 
 	return VX_SUCCESS;
 }
@@ -2122,6 +2357,10 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOverlayBuffer(ls_context stitch
 	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
 	// check to make sure that LoomIO for overlay is not active
 	if (stitch->nodeLoomIoOverlay) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_OPENCL) {
+		ls_printf("ERROR: lsSetOverlayBuffer: context uses host buffers, use lsSetOverlayBufferHost\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
 
 	// switch the user specified OpenCL buffer into image
 	void * ptr_overlay[] = { overlay_buffer ? overlay_buffer[0] : nullptr };
@@ -2130,6 +2369,253 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOverlayBuffer(ls_context stitch
 	return VX_SUCCESS;
 }
 
+//! \brief Set host buffers
+//     input_buffer   - input host buffer with images from all cameras
+//     overlay_buffer - overlay host buffer with all images
+//     output_buffer  - output host buffer for output equirectangular image
+//   The buffers are swapped into the images without copies.
+//   Use of nullptr will return the control of previously set buffer
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferHost(ls_context stitch, void * input_buffer)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for camera is not active
+	if (stitch->nodeLoomIoCamera) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_HOST) {
+		ls_printf("ERROR: lsSetCameraBufferHost: context uses OpenCL buffers, set LIVE_STITCH_ATTR_HOST_BUFFERS before lsInitialize\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	if (stitch->camera_buffer_ring_size > 0) {
+		ls_printf("ERROR: lsSetCameraBufferHost: a camera buffer ring is set, remove it with lsSetCameraBufferRingHost(count=0) first\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	// switch the user specified host buffer into image
+	void * ptr_in[] = { input_buffer };
+	ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_input, ptr_in, nullptr, 1));
+	stitch->camera_buffer_set = (ptr_in[0] != nullptr);
+
+	return VX_SUCCESS;
+}
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferHost(ls_context stitch, void * output_buffer)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for output is not active
+	if (stitch->nodeLoomIoOutput) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_HOST) {
+		ls_printf("ERROR: lsSetOutputBufferHost: context uses OpenCL buffers, set LIVE_STITCH_ATTR_HOST_BUFFERS before lsInitialize\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	if (stitch->output_buffer_ring_size > 0) {
+		ls_printf("ERROR: lsSetOutputBufferHost: an output buffer ring is set, remove it with lsSetOutputBufferRingHost(count=0) first\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	// switch the user specified host buffer into image
+	void * ptr_out[] = { output_buffer };
+	ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_output, ptr_out, nullptr, 1));
+	stitch->output_buffer_set = (ptr_out[0] != nullptr);
+
+	return VX_SUCCESS;
+}
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOverlayBufferHost(ls_context stitch, void * overlay_buffer)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for overlay is not active
+	if (stitch->nodeLoomIoOverlay) return VX_ERROR_NOT_ALLOCATED;
+	if (stitch->buffer_memory_type != VX_MEMORY_TYPE_HOST) {
+		ls_printf("ERROR: lsSetOverlayBufferHost: context uses OpenCL buffers, set LIVE_STITCH_ATTR_HOST_BUFFERS before lsInitialize\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+
+	// switch the user specified host buffer into image
+	void * ptr_overlay[] = { overlay_buffer };
+	ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_overlay, ptr_overlay, nullptr, 1));
+
+	return VX_SUCCESS;
+}
+
+//! \brief Set a ring of buffers to be swapped into an image at every lsScheduleFrame
+static vx_status SetBufferRing(ls_context stitch, const char * caller, vx_enum memory_type, vx_image image,
+	vx_uint32 count, void * const buffers[], void * ring[], vx_uint32& ring_size, vx_uint32& ring_index, bool buffer_set)
+{
+	if (stitch->scheduled) {
+		ls_printf("ERROR: %s: not allowed while a frame is scheduled\n", caller);
+		return VX_ERROR_GRAPH_SCHEDULED;
+	}
+	if (buffer_set && count > 0) {
+		ls_printf("ERROR: %s: a single buffer is set, release it with a nullptr buffer first\n", caller);
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+	if (stitch->buffer_memory_type != memory_type) {
+		ls_printf("ERROR: %s: buffer memory type doesn't match the context (see LIVE_STITCH_ATTR_HOST_BUFFERS)\n", caller);
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+	if (count > LIVE_STITCH_MAX_BUFFER_RING_SIZE || (count > 0 && !buffers)) {
+		ls_printf("ERROR: %s: invalid number of buffers: %d (upto %d buffers)\n", caller, count, LIVE_STITCH_MAX_BUFFER_RING_SIZE);
+		return VX_ERROR_INVALID_PARAMETERS;
+	}
+	for (vx_uint32 i = 0; i < count; i++) {
+		if (!buffers[i]) {
+			ls_printf("ERROR: %s: buffer#%d is NULL\n", caller, i);
+			return VX_ERROR_INVALID_PARAMETERS;
+		}
+		ring[i] = buffers[i];
+	}
+	bool ring_removed = (ring_size > 0 && count == 0);
+	ring_size = count;
+	ring_index = 0;
+	if (ring_removed) {
+		// return the control of previously set buffer
+		void * ptr[] = { nullptr };
+		ERROR_CHECK_STATUS_(vxSwapImageHandle(image, ptr, nullptr, 1));
+	}
+	return VX_SUCCESS;
+}
+
+//! \brief Set rings of camera/output buffers
+//     count          - number of buffers in the ring (use 0 to remove the ring)
+//     input_buffers  - input buffers with images from all cameras
+//     output_buffers - output buffers for output equirectangular image
+//   lsScheduleFrame switches in the next buffer of each ring in order.
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferRing(ls_context stitch, vx_uint32 count, cl_mem * input_buffers)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for camera is not active
+	if (stitch->nodeLoomIoCamera) return VX_ERROR_NOT_ALLOCATED;
+	return SetBufferRing(stitch, "lsSetCameraBufferRing", VX_MEMORY_TYPE_OPENCL, stitch->Img_input,
+		count, (void * const *)input_buffers, stitch->camera_buffer_ring, stitch->camera_buffer_ring_size, stitch->camera_buffer_ring_index, stitch->camera_buffer_set);
+}
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferRing(ls_context stitch, vx_uint32 count, cl_mem * output_buffers)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for output is not active
+	if (stitch->nodeLoomIoOutput) return VX_ERROR_NOT_ALLOCATED;
+	return SetBufferRing(stitch, "lsSetOutputBufferRing", VX_MEMORY_TYPE_OPENCL, stitch->Img_output,
+		count, (void * const *)output_buffers, stitch->output_buffer_ring, stitch->output_buffer_ring_size, stitch->output_buffer_ring_index, stitch->output_buffer_set);
+}
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferRingHost(ls_context stitch, vx_uint32 count, void ** input_buffers)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for camera is not active
+	if (stitch->nodeLoomIoCamera) return VX_ERROR_NOT_ALLOCATED;
+	return SetBufferRing(stitch, "lsSetCameraBufferRingHost", VX_MEMORY_TYPE_HOST, stitch->Img_input,
+		count, input_buffers, stitch->camera_buffer_ring, stitch->camera_buffer_ring_size, stitch->camera_buffer_ring_index, stitch->camera_buffer_set);
+}
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferRingHost(ls_context stitch, vx_uint32 count, void ** output_buffers)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	// check to make sure that LoomIO for output is not active
+	if (stitch->nodeLoomIoOutput) return VX_ERROR_NOT_ALLOCATED;
+	return SetBufferRing(stitch, "lsSetOutputBufferRingHost", VX_MEMORY_TYPE_HOST, stitch->Img_output,
+		count, output_buffers, stitch->output_buffer_ring, stitch->output_buffer_ring_size, stitch->output_buffer_ring_index, stitch->output_buffer_set);
+}
+
+//! \brief Get index of the ring buffers that will be used by the next lsScheduleFrame
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetBufferRingIndex(ls_context stitch, vx_uint32 * camera_index, vx_uint32 * output_index)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	if (camera_index) *camera_index = stitch->camera_buffer_ring_index;
+	if (output_index) *output_index = stitch->output_buffer_ring_index;
+	return VX_SUCCESS;
+}
+
+//! \brief Get time spent in each phase of the last lsInitialize/lsReinitialize
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetInitializeTiming(ls_context stitch, vx_uint32 phase_offset, vx_uint32 phase_count, vx_float32 * phase_time_msec)
+{
+	ERROR_CHECK_STATUS_(IsValidContext(stitch));
+
+	// bounding check
+	if ((phase_offset + phase_count) > LIVE_STITCH_INIT_PHASE_MAX_COUNT)
+		return VX_ERROR_INVALID_DIMENSION;
+	if (!phase_time_msec && phase_count > 0)
+		return VX_ERROR_INVALID_PARAMETERS;
+
+	memcpy(phase_time_msec, &stitch->init_phase_time[phase_offset], phase_count * sizeof(vx_float32));
+	return VX_SUCCESS;
+}
+
+//! \brief Get the number of executions of each stitch node since lsInitialize
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetNodeExecutionCount(ls_context stitch, vx_uint32 node_offset, vx_uint32 node_count, vx_uint64 * exec_count)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+
+	// bounding check
+	if ((node_offset + node_count) > LIVE_STITCH_NODE_MAX_COUNT)
+		return VX_ERROR_INVALID_DIMENSION;
+	if (!exec_count && node_count > 0)
+		return VX_ERROR_INVALID_PARAMETERS;
+
+	vx_node nodeList[LIVE_STITCH_NODE_MAX_COUNT] = {
+		stitch->WarpNode, stitch->ExpcompComputeGainNode, stitch->ExpcompSolveGainNode, stitch->ExpcompApplyGainNode, stitch->MergeNode,
+		stitch->SeamfindStep1Node, stitch->SeamfindStep2Node ? stitch->SeamfindStep2Node : stitch->SobelNode,
+		stitch->SeamfindStep3Node, stitch->SeamfindStep4Node, stitch->SeamfindStep5Node,
+	};
+	for (vx_uint32 i = 0; i < node_count; i++) {
+		vx_perf_t perf = { 0 };
+		vx_node node = nodeList[node_offset + i];
+		if (node) ERROR_CHECK_STATUS_(vxQueryNode(node, VX_NODE_ATTRIBUTE_PERFORMANCE, &perf, sizeof(perf)));
+		exec_count[i] = perf.num;
+	}
+	return VX_SUCCESS;
+}
+
+//! \brief Get the exposure compensation gains used by the next frame
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetExposureCompGains(ls_context stitch, vx_uint32 count, vx_float32 * gains)
+{
+	ERROR_CHECK_STATUS_(IsValidContextAndInitialized(stitch));
+	if (stitch->scheduled) {
+		ls_printf("ERROR: lsGetExposureCompGains: not allowed while a frame is scheduled\n");
+		return VX_ERROR_GRAPH_SCHEDULED;
+	}
+	if (!stitch->gain_array) {
+		ls_printf("ERROR: lsGetExposureCompGains: exposure compensation is not enabled\n");
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+	if (!gains || count != stitch->num_cameras * stitch->expcomp_gain_channels)
+		return VX_ERROR_INVALID_PARAMETERS;
+	vx_map_id map_id = 0;
+	vx_size stride = 0;
+	vx_float32 * ptr = nullptr;
+	ERROR_CHECK_STATUS_(vxMapArrayRange(stitch->gain_array, 0, count, &map_id, &stride, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+	memcpy(gains, ptr, count * sizeof(vx_float32));
+	ERROR_CHECK_STATUS_(vxUnmapArrayRange(stitch->gain_array, map_id));
+	return VX_SUCCESS;
+}
+
+//! \brief Check if any overlapping camera pair accumulates exposure comp statistics in a phase of the update interval.
+static bool IsExpCompCalcDue(ls_context stitch, vx_uint32 phase)
+{
+	for (vx_uint32 i = 1; i < stitch->num_cameras; i++) {
+		for (vx_uint32 j = 0; j < i; j++) {
+			if (((stitch->validCamOverlapInfo[i] & (1 << j)) || (stitch->validCamOverlapInfo[j] & (1 << i))) && exposure_comp_pair_phase(i, j, stitch->expcomp_interval, stitch->expcomp_stagger) == phase)
+				return true;
+		}
+	}
+	return false;
+}
+
+//! \brief Check if the seam of any overlap is due on a frame: same schedule as the seam find kernels.
+//  The preference table is read after graphStitch, so that scene changes detected in the frame are included.
+static vx_status IsSeamFindDue(ls_context stitch, vx_uint32 current_frame, bool& due)
+{
+	due = false;
+	vx_size numItems = 0;
+	ERROR_CHECK_STATUS_(vxQueryArray(stitch->seamfind_pref_array, VX_ARRAY_NUMITEMS, &numItems, sizeof(numItems)));
+	if (numItems > 0) {
+		vx_map_id map_id = 0;
+		vx_size stride = 0;
+		StitchSeamFindPreference * pref = nullptr;
+		ERROR_CHECK_STATUS_(vxMapArrayRange(stitch->seamfind_pref_array, 0, numItems, &map_id, &stride, (void **)&pref, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+		for (vx_size i = 0; i < numItems && !due; i++) {
+			due = seamfind_is_overlap_due(pref[i], current_frame);
+		}
+		ERROR_CHECK_STATUS_(vxUnmapArrayRange(stitch->seamfind_pref_array, map_id));
+	}
+	return VX_SUCCESS;
+}
+
 //! \brief Schedule next frame
 LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsScheduleFrame(ls_context stitch)
 {
@@ -2148,11 +2634,22 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsScheduleFrame(ls_context stitch)
 		ERROR_CHECK_STATUS_(vxWriteScalarValue(stitch->current_frame, &stitch->current_frame_value));
 		stitch->current_frame_value++;
 	}
+	// exposure comp gain updates are scheduled on its own frame counter
+	if (stitch->expcomp_frame) {
+		ERROR_CHECK_STATUS_(vxWriteScalarValue(stitch->expcomp_frame, &stitch->expcomp_frame_value));
+		stitch->expcomp_frame_value++;
+	}
 
-	// exposure comp expects A_matrix to be initialized to ZERO on GPU
-	if (stitch->EXPO_COMP && stitch->A_matrix) {
-		ERROR_CHECK_STATUS_(vxWriteMatrix(stitch->A_matrix, stitch->A_matrix_initial_value));
-		ERROR_CHECK_STATUS_(vxDirective((vx_reference)stitch->A_matrix, VX_DIRECTIVE_AMD_COPY_TO_OPENCL));
+	// switch in the next buffers from the camera/output buffer rings
+	if (stitch->camera_buffer_ring_size > 0) {
+		void * ptr_in[] = { stitch->camera_buffer_ring[stitch->camera_buffer_ring_index] };
+		ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_input, ptr_in, nullptr, 1));
+		stitch->camera_buffer_ring_index = (stitch->camera_buffer_ring_index + 1) % stitch->camera_buffer_ring_size;
+	}
+	if (stitch->output_buffer_ring_size > 0) {
+		void * ptr_out[] = { stitch->output_buffer_ring[stitch->output_buffer_ring_index] };
+		ERROR_CHECK_STATUS_(vxSwapImageHandle(stitch->Img_output, ptr_out, nullptr, 1));
+		stitch->output_buffer_ring_index = (stitch->output_buffer_ring_index + 1) % stitch->output_buffer_ring_size;
 	}
 
 	// start the graph schedule
@@ -2175,6 +2672,26 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsWaitForCompletion(ls_context stitc
 	ERROR_CHECK_STATUS_(vxWaitGraph(stitch->graphStitch));
 	stitch->scheduled = false;
 
+	// exposure comp gain updates due in this frame: the new gains are applied from the next frame
+	if (stitch->graphExpcompCalc) {
+		vx_uint32 interval = stitch->expcomp_interval, phase = (stitch->expcomp_frame_value - 1) % interval;
+		if (IsExpCompCalcDue(stitch, phase)) {
+			ERROR_CHECK_STATUS_(vxProcessGraph(stitch->graphExpcompCalc));
+		}
+		if (phase == exposure_comp_solve_phase(interval, stitch->expcomp_stagger)) {
+			ERROR_CHECK_STATUS_(vxProcessGraph(stitch->graphExpcompSolve));
+		}
+	}
+
+	// seam find due in this frame: the new seam weights are used from the next frame
+	if (stitch->graphSeamfind) {
+		bool due = false;
+		ERROR_CHECK_STATUS_(IsSeamFindDue(stitch, stitch->current_frame_value - 1, due));
+		if (due) {
+			ERROR_CHECK_STATUS_(vxProcessGraph(stitch->graphSeamfind));
+		}
+	}
+
 	// debug: dump auxiliary data
 	if (stitch->loomioAuxDumpFile) {
 		vx_array auxList[] = { stitch->loomioCameraAuxData, stitch->loomioOverlayAuxData, stitch->loomioOutputAuxData, stitch->loomioViewingAuxData };
@@ -2554,7 +3071,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 			stitch->nodeLoomIoCamera, stitch->nodeLoomIoOverlay, stitch->nodeLoomIoOutput, stitch->nodeLoomIoViewing,
 		};
 		const char * kernelNameList[] = {
-			"com.amd.loomsl.color_convert", "org.khronos.openvx.remap", "com.amd.loomsl.color_convert",
+			"com.amd.loomsl.color_convert", stitch->SimpleRemapEntry ? "com.amd.loomsl.simple_remap" : "org.khronos.openvx.remap", "com.amd.loomsl.color_convert",
 			"com.amd.loomsl.warp", "com.amd.loomsl.expcomp_compute_gainmatrix", "com.amd.loomsl.expcomp_solvegains", "com.amd.loomsl.expcomp_applygains", "com.amd.loomsl.merge",
 			"org.khronos.openvx.sobel_3x3", "org.khronos.openvx.magnitude", "org.khronos.openvx.phase", "org.khronos.openvx.convert_depth",
 			"com.amd.loomsl.seamfind_scene_detect", "com.amd.loomsl.seamfind_cost_generate", "com.amd.loomsl.seamfind_cost_accumulate", "com.amd.loomsl.seamfind_path_trace", "com.amd.loomsl.seamfind_set_weights",
@@ -2625,8 +3142,8 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 				fprintf(fp, "type ExpCompCalcEntryType userstruct:%d\n", (int)sizeof(StitchExpCompCalcEntry));
 				fprintf(fp, "data expCompValidTable = array:ExpCompValidEntryType,%d\n", (int)stitch->table_sizes.expCompValidTableSize);
 				fprintf(fp, "data expCompCalcTable = array:ExpCompCalcEntryType,%d\n", (int)stitch->table_sizes.expCompOverlapTableSize);
-				fprintf(fp, "data expCompGain = array:VX_TYPE_FLOAT32,%d\n", (int)stitch->num_cameras);
-				fprintf(fp, "data expCompAMat = matrix:VX_TYPE_INT32,%d,%d\n", stitch->num_cameras, stitch->num_cameras);
+				fprintf(fp, "data expCompGain = array:VX_TYPE_FLOAT32,%d\n", (int)(stitch->num_cameras * stitch->expcomp_gain_channels));
+				fprintf(fp, "data expCompAMat = matrix:VX_TYPE_INT32,%d,%d\n", stitch->num_cameras, stitch->num_cameras * stitch->expcomp_gain_channels);
 				fprintf(fp, "data expCompCountMat = matrix:VX_TYPE_INT32,%d,%d\n", stitch->num_cameras, stitch->num_cameras);
 				fprintf(fp, "data RGBY2 = image:%d,%d,RGBA\n", stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height * stitch->num_cameras);
 				refNameList[(vx_reference)stitch->valid_array] = "expCompValidTable";
@@ -2634,6 +3151,10 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 				refNameList[(vx_reference)stitch->gain_array] = "expCompGain";
 				refNameList[(vx_reference)stitch->A_matrix] = "expCompAMat";
 				refNameList[(vx_reference)stitch->overlap_matrix] = "expCompCountMat";
+				if (stitch->expcomp_frame) {
+					fprintf(fp, "data expCompCurFrame = scalar:VX_TYPE_UINT32,%u\n", stitch->expcomp_frame_value);
+					refNameList[(vx_reference)stitch->expcomp_frame] = "expCompCurFrame";
+				}
 				refNameList[(vx_reference)stitch->RGBY2] = "RGBY2";
 			}
 			if (stitch->SEAM_FIND) {
@@ -2680,11 +3201,9 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 					refNameList[(vx_reference)stitch->seamfind_scene_array] = "seamFindSceneTable";
 					refNameList[(vx_reference)stitch->scene_threshold] = "seamFindSceneThreshold";
 				}
-				if (stitch->SEAM_COST_SELECT) {
-					vx_uint32 cost_enable = 1;
-					fprintf(fp, "data seamFindCost = scalar:VX_TYPE_UINT32,%d\n", cost_enable);
-					refNameList[(vx_reference)stitch->seam_cost_enable] = "seamFindCost";
-				}
+				vx_uint32 cost_enable = 1;
+				fprintf(fp, "data seamFindCost = scalar:VX_TYPE_UINT32,%d\n", cost_enable);
+				refNameList[(vx_reference)stitch->seam_cost_enable] = "seamFindCost";
 			}
 			if (stitch->MULTIBAND_BLEND) {
 				fprintf(fp, "type BlendValidEntryType userstruct:%d\n", (int)sizeof(StitchBlendValidEntry));
@@ -2696,8 +3215,11 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 				refNameList[(vx_reference)stitch->valid_mask_image] = "validMaskImage";
 			}
 		}
-		fprintf(fp, "data rgb_input = image:%d,%d,RGB2\n", stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height);
-		fprintf(fp, "data rgb_output = image:%d,%d,RGB2\n", stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height);
+		vx_df_image rgb_input_format = VX_DF_IMAGE_RGB, rgb_output_format = VX_DF_IMAGE_RGB;
+		ERROR_CHECK_STATUS_(vxQueryImage(stitch->rgb_input, VX_IMAGE_ATTRIBUTE_FORMAT, &rgb_input_format, sizeof(rgb_input_format)));
+		ERROR_CHECK_STATUS_(vxQueryImage(stitch->rgb_output, VX_IMAGE_ATTRIBUTE_FORMAT, &rgb_output_format, sizeof(rgb_output_format)));
+		fprintf(fp, "data rgb_input = image:%d,%d,%4.4s\n", stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height, (const char *)&rgb_input_format);
+		fprintf(fp, "data rgb_output = image:%d,%d,%4.4s\n", stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height, (const char *)&rgb_output_format);
 		refNameList[(vx_reference)stitch->rgb_input] = "rgb_input";
 		refNameList[(vx_reference)stitch->rgb_output] = "rgb_output";
 		if (stitch->overlay_remap) {
@@ -2714,6 +3236,11 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsExportConfiguration(ls_context sti
 			fprintf(fp, "data remapCamera = remap:%d,%d,%d,%d\n", stitch->camera_rgb_buffer_width, stitch->camera_rgb_buffer_height, stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height);
 			refNameList[(vx_reference)stitch->camera_remap] = "remapCamera";
 		}
+		if (stitch->SimpleRemapEntry) {
+			fprintf(fp, "type SimpleRemapEntryType userstruct:%d\n", (int)sizeof(StitchSimpleRemapEntry));
+			fprintf(fp, "data remapCameraTable = array:SimpleRemapEntryType,%d\n", stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height);
+			refNameList[(vx_reference)stitch->SimpleRemapEntry] = "remapCameraTable";
+		}
 		int genImageCount = 0, genScalarCount = 0;
 		for (auto it = nodeMap.begin(); it != nodeMap.end(); it++) {
 			vx_node node = it->first;
@@ -50,12 +50,19 @@ enum {
 	LIVE_STITCH_ATTR_REDUCE_OVERLAP_REGION  =   11,   // Reduces the overlap region by n*n pixels (default: 0)
 	LIVE_STITCH_ATTR_SEAM_VERT_PRIORITY     =   12,   // Vertical seam priority: -1 to N Flag. -1:Disable 1:highest N:Lowest. (default 0)
 	LIVE_STITCH_ATTR_SEAM_HORT_PRIORITY     =   13,   // Horizontal seam priority: -1 to N Flag. -1:Disable 1:highest N:Lowest. (default 0)
-	LIVE_STITCH_ATTR_SEAM_FREQUENCY         =   14,   // Seam frequecy: 0 - N Frames. Frequency of seam calculation.
+	LIVE_STITCH_ATTR_SEAM_FREQUENCY         =   14,   // Seam frequecy: 0 - N Frames. Frequency of seam calculation, new seams apply from the next frame.
 	LIVE_STITCH_ATTR_SEAM_QUALITY           =   15,   // Seam quality, quality: 0 - N Flag.   0:Disable Edgeness 1:Enable Edgeness (default 0)
 	LIVE_STITCH_ATTR_SEAM_STAGGER           =   16,   // Seam stagger: 0 - N Frames. Stagger the seam calculation by N frames
 	LIVE_STITCH_ATTR_SEAM_LOCK              =   17,   // Seam lock (default: 0)
 	LIVE_STITCH_ATTR_SEAM_FLAGS             =   18,   // Seam flags (default: 0)
 	LIVE_STITCH_ATTR_MULTIBAND_PAD_PIXELS   =   19,   // multiband attribute: padding pixel count (default: 0)
+	LIVE_STITCH_ATTR_HOST_BUFFERS           =   20,   // camera/output/overlay buffers: 0:OpenCL buffers 1:host memory (default: 0)
+	LIVE_STITCH_ATTR_EXPCOMP_INTERVAL       =   21,   // exposure comp: gain update interval: 1 - N frames, gains of N > 1 apply from the next frame (default: 1)
+	LIVE_STITCH_ATTR_EXPCOMP_STAGGER        =   22,   // exposure comp: 0:update all overlaps together 1:stagger overlaps across the interval (default: 0)
+	LIVE_STITCH_ATTR_EXPCOMP_SMOOTHING      =   23,   // exposure comp: weight of previous gains: 0.0 - <1.0 (default: 0.0)
+	LIVE_STITCH_ATTR_FUSE_COLOR_CONVERT     =   24,   // packed YUV camera/output: 0:separate color convert nodes 1:convert inside warp/merge, output may differ by up to 2 (default: 0)
+	LIVE_STITCH_ATTR_EXPCOMP_SAMPLE_STRIDE  =   25,   // exposure comp: use every Nth row pair of overlap pixels for gain statistics: 1 - 16 (default: 1)
+	LIVE_STITCH_ATTR_EXPCOMP_RGB_GAINS      =   26,   // exposure comp: 0:one luma gain per camera 1:separate R, G, B gains per camera (default: 0)
 	LIVE_STITCH_ATTR_IO_AUX_DATA_CAPACITY   =   32,   // LoomIO: auxiliary data buffer size in bytes. Default 1024.
 	// Dynamic LoomSL attributes
 	LIVE_STITCH_ATTR_SEAM_THRESHOLD			=	51,    // seamfind seam refresh Threshold: 0 - 100 percentage change
@@ -66,6 +73,46 @@ enum {
 	LIVE_STITCH_ATTR_MAX_COUNT              =  256    // total number of attributes
 };
 
+//////////////////////////////////////////////////////////////////////
+//! \brief The initialization phases
+//  - lsInitialize and lsReinitialize record time spent in each phase (in milliseconds)
+//  - use lsGetInitializeTiming API to query the breakdown of the last call
+enum {
+	LIVE_STITCH_INIT_PHASE_TOTAL            =    0,   // total time of the last lsInitialize/lsReinitialize call
+	LIVE_STITCH_INIT_PHASE_SETUP            =    1,   // OpenVX context, kernels, LoomIO modules, and camera/output images
+	LIVE_STITCH_INIT_PHASE_LENS_MAPPING     =    2,   // lens distortion and warp maps of cameras
+	LIVE_STITCH_INIT_PHASE_OVERLAP_DETECT   =    3,   // overlap regions and internal table sizes
+	LIVE_STITCH_INIT_PHASE_REMAP_TABLES     =    4,   // remap tables of quick stitch mode and overlays
+	LIVE_STITCH_INIT_PHASE_WARP_TABLES      =    5,   // warp tables
+	LIVE_STITCH_INIT_PHASE_MERGE_TABLES     =    6,   // merge tables and default weight image
+	LIVE_STITCH_INIT_PHASE_EXPCOMP_TABLES   =    7,   // exposure comp tables
+	LIVE_STITCH_INIT_PHASE_SEAMFIND_TABLES  =    8,   // seamfind tables and seamfind weight image
+	LIVE_STITCH_INIT_PHASE_BLEND_TABLES     =    9,   // multiband blend tables
+	LIVE_STITCH_INIT_PHASE_MASK_IMAGES      =   10,   // valid/blend mask images and intermediate images
+	LIVE_STITCH_INIT_PHASE_GRAPH_CREATION   =   11,   // internal data objects and graph nodes
+	LIVE_STITCH_INIT_PHASE_GRAPH_VERIFY     =   12,   // vxVerifyGraph
+	LIVE_STITCH_INIT_PHASE_SYNC_TABLES      =   13,   // copy of internal tables to OpenCL buffers
+	LIVE_STITCH_INIT_PHASE_MAX_COUNT        =   14    // total number of initialization phases
+};
+
+//! \brief The per-frame stitch nodes
+//  - nodes that are skipped on frames with no work (see LIVE_STITCH_ATTR_EXPCOMP_INTERVAL and
+//    LIVE_STITCH_ATTR_SEAM_FREQUENCY) don't count an execution
+//  - use lsGetNodeExecutionCount API to query the number of executions since lsInitialize
+enum {
+	LIVE_STITCH_NODE_WARP                   =    0,   // warp
+	LIVE_STITCH_NODE_EXPCOMP_CALC           =    1,   // exposure comp: overlap statistics
+	LIVE_STITCH_NODE_EXPCOMP_SOLVE          =    2,   // exposure comp: gain solver
+	LIVE_STITCH_NODE_EXPCOMP_APPLY          =    3,   // exposure comp: apply gains
+	LIVE_STITCH_NODE_MERGE                  =    4,   // merge
+	LIVE_STITCH_NODE_SEAMFIND_SCENE_DETECT  =    5,   // seam find: scene change detection (every frame)
+	LIVE_STITCH_NODE_SEAMFIND_COST_GENERATE =    6,   // seam find: cost generate (OpenVX Sobel with LIVE_STITCH_ATTR_SEAM_COST_SELECT=0)
+	LIVE_STITCH_NODE_SEAMFIND_COST_ACCUM    =    7,   // seam find: cost accumulate
+	LIVE_STITCH_NODE_SEAMFIND_PATH_TRACE    =    8,   // seam find: path trace
+	LIVE_STITCH_NODE_SEAMFIND_SET_WEIGHTS   =    9,   // seam find: set weights
+	LIVE_STITCH_NODE_MAX_COUNT              =   10    // total number of nodes
+};
+
 
 //////////////////////////////////////////////////////////////////////
 // Camera Model Parameters
@@ -251,6 +298,31 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch);
 //  - return VX_SUCCESS or error code (see log messages for further details)
 LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch);
 
+//! \brief Query time spent in each phase of the last lsInitialize/lsReinitialize call.
+//     phase_offset    - first LIVE_STITCH_INIT_PHASE_* to query
+//     phase_count     - number of phases to query
+//     phase_time_msec - time spent in each phase in milliseconds
+//  - phases that didn't run in the last call report zero
+//  - LIVE_STITCH_INIT_PHASE_TOTAL is zero when the last call failed
+//  - returns VX_ERROR_INVALID_PARAMETERS when phase_time_msec is NULL and phase_count > 0
+//  - return VX_SUCCESS or error code (see log messages for further details)
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetInitializeTiming(ls_context stitch, vx_uint32 phase_offset, vx_uint32 phase_count, vx_float32 * phase_time_msec);
+
+//! \brief Query the number of executions of each stitch node since lsInitialize.
+//     node_offset     - first LIVE_STITCH_NODE_* to query
+//     node_count      - number of nodes to query
+//     exec_count      - number of executions of each node
+//  - nodes that aren't used by the stitch mode report zero
+//  - return VX_SUCCESS or error code (see log messages for further details)
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetNodeExecutionCount(ls_context stitch, vx_uint32 node_offset, vx_uint32 node_count, vx_uint64 * exec_count);
+
+//! \brief Query the exposure compensation gains used by the next frame.
+//     count           - number of gains: num_cameras, or 3 * num_cameras with LIVE_STITCH_ATTR_EXPCOMP_RGB_GAINS
+//     gains           - gains of all cameras (R gains of all cameras, followed by G and B gains with per-channel gains)
+//  - can't be called while a frame is scheduled
+//  - return VX_SUCCESS or error code (see log messages for further details)
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetExposureCompGains(ls_context stitch, vx_uint32 count, vx_float32 * gains);
+
 //! \brief Set OpenCL buffers
 //     input_buffer   - input opencl buffer with images from all cameras
 //     overlay_buffer - overlay opencl buffer with all images
@@ -261,6 +333,37 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBuffer(ls_context stitch,
 LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBuffer(ls_context stitch, cl_mem * output_buffer);
 LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOverlayBuffer(ls_context stitch, cl_mem * overlay_buffer);
 
+//! \brief Set host buffers
+//     input_buffer   - input host buffer with images from all cameras
+//     overlay_buffer - overlay host buffer with all images
+//     output_buffer  - output host buffer for output equirectangular image
+//   The buffers are used in place (no copies) and must stay valid until control is returned.
+//   Use of nullptr will return the control of previously set buffer
+//  - requires LIVE_STITCH_ATTR_HOST_BUFFERS attribute set to 1 before lsInitialize
+//  - return VX_SUCCESS or error code (see log messages for further details)
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferHost(ls_context stitch, void * input_buffer);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferHost(ls_context stitch, void * output_buffer);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOverlayBufferHost(ls_context stitch, void * overlay_buffer);
+
+//! \brief Set rings of camera/output buffers
+//     count          - number of buffers in the ring (upto 8, use 0 to remove the ring)
+//     input_buffers  - input buffers with images from all cameras
+//     output_buffers - output buffers for output equirectangular image
+//   Every lsScheduleFrame switches in the next buffer of each ring, in order, so the application
+//   can fill the next camera buffer and consume the previous output buffer while a frame is executing.
+//   Use lsGetBufferRingIndex to get the index of the buffers that will be used by the next lsScheduleFrame.
+//   A ring can't be mixed with a single buffer of the same kind: setting a ring while a buffer set with
+//   lsSetCameraBuffer/lsSetOutputBuffer[Host] is held (or the reverse) returns VX_ERROR_NOT_SUPPORTED.
+//   Release the single buffer with nullptr, or remove the ring with count 0, before switching.
+//  - use *Host variants when LIVE_STITCH_ATTR_HOST_BUFFERS attribute is set
+//  - can't be called while a frame is scheduled
+//  - return VX_SUCCESS or error code (see log messages for further details)
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferRing(ls_context stitch, vx_uint32 count, cl_mem * input_buffers);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferRing(ls_context stitch, vx_uint32 count, cl_mem * output_buffers);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraBufferRingHost(ls_context stitch, vx_uint32 count, void ** input_buffers);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetOutputBufferRingHost(ls_context stitch, vx_uint32 count, void ** output_buffers);
+LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsGetBufferRingIndex(ls_context stitch, vx_uint32 * camera_index, vx_uint32 * output_index);
+
 //! \brief Schedule a frame
 //  - only one frame can be scheduled at a time
 //  - every lsScheduleFrame call should be followed by lsWaitForCompletion call